@@ -0,0 +1,663 @@
+#ifndef ALGORITHM_HPP
+# define ALGORITHM_HPP
+
+# include <algorithm>
+# include <climits>
+# include <functional>
+# include <limits>
+# include <stdexcept>
+# include <string>
+# include <pthread.h>
+# include <sched.h>
+# include <unistd.h>
+# include "vector.hpp"
+# include "radix_sort.hpp"
+
+namespace ft
+{
+//실행 정책. 정책을 받는 오버로드는 thread_pool에 범위를 나눠서 넘긴다.
+namespace execution
+{
+struct sequenced_policy {};
+struct parallel_policy {};
+
+static const sequenced_policy	seq = sequenced_policy();
+static const parallel_policy	par = parallel_policy();
+}
+
+//작업 묶음. 묶음에 넣은 작업이 모두 끝나야 wait가 반환된다.
+class task_group
+{
+public:
+	volatile long	_left;
+
+	task_group(void) : _left(0) {}
+};
+
+//워커마다 큐를 하나씩 가지고, 자기 큐가 비면 다른 워커의 큐 앞쪽에서 훔쳐온다.
+class thread_pool
+{
+public:
+	typedef void	(*task_fn)(void *);
+
+	struct task
+	{
+		task_fn		fn;
+		void		*arg;
+		task_group	*group;
+	};
+
+private:
+	struct queue
+	{
+		pthread_mutex_t		lock;
+		ft::vector<task>	tasks;
+		size_t				head;
+	};
+
+	size_t			_nthreads;
+	queue			*_queues;
+	pthread_t		*_threads;
+	pthread_mutex_t	_sleep_lock;
+	pthread_cond_t	_wake;
+	volatile long	_pending;
+	volatile long	_next;
+
+	thread_pool(size_t nthreads_)
+	: _nthreads(nthreads_), _pending(0), _next(0)
+	{
+		pthread_mutex_init(&_sleep_lock, NULL);
+		pthread_cond_init(&_wake, NULL);
+		_queues = new queue[_nthreads];
+		for (size_t i = 0; i < _nthreads; i++)
+		{
+			pthread_mutex_init(&_queues[i].lock, NULL);
+			_queues[i].head = 0;
+		}
+		_threads = new pthread_t[_nthreads];
+		for (size_t i = 0; i < _nthreads; i++)
+		{
+			pthread_create(&_threads[i], NULL, &thread_pool::worker_main, reinterpret_cast<void *>(i));
+			pthread_detach(_threads[i]);
+		}
+	}
+
+	thread_pool(const thread_pool &);
+	thread_pool &operator=(const thread_pool &);
+
+	static thread_pool *&
+	__instance_ptr(void)
+	{
+		static thread_pool *pool = NULL;
+		return pool;
+	}
+
+	//워커 스레드는 자기 번호를, 외부 스레드는 -1을 가진다.
+	static long &
+	__worker_id(void)
+	{
+		static __thread long id = -1;
+		return id;
+	}
+
+	//taskset 등으로 쓸 수 있는 CPU를 줄였으면 그 수만큼만 만든다.
+	static void
+	__create(void)
+	{
+		long n = sysconf(_SC_NPROCESSORS_ONLN);
+#ifdef CPU_COUNT
+		cpu_set_t set;
+
+		if (sched_getaffinity(0, sizeof(set), &set) == 0 && CPU_COUNT(&set) > 0)
+			n = CPU_COUNT(&set);
+#endif
+		if (n < 1)
+			n = 1;
+		__instance_ptr() = new thread_pool(static_cast<size_t>(n));
+	}
+
+	static void *
+	worker_main(void *arg)
+	{
+		thread_pool &pool = thread_pool::instance();
+		__worker_id() = reinterpret_cast<long>(arg);
+		pool.__loop(static_cast<size_t>(__worker_id()));
+		return NULL;
+	}
+
+	void
+	__loop(size_t id)
+	{
+		task t;
+
+		for (;;)
+		{
+			if (this->__pop(id, t) || this->__steal(id + 1, t))
+			{
+				this->__run(t);
+				continue;
+			}
+			pthread_mutex_lock(&_sleep_lock);
+			while (__sync_fetch_and_add(&_pending, 0) <= 0)
+				pthread_cond_wait(&_wake, &_sleep_lock);
+			pthread_mutex_unlock(&_sleep_lock);
+		}
+	}
+
+	//자기 큐에서는 뒤에서 꺼낸다. (가장 최근에 넣은 작업이 캐시에 남아있다.)
+	bool
+	__pop(size_t id, task &out)
+	{
+		queue &q = _queues[id];
+		bool found = false;
+
+		pthread_mutex_lock(&q.lock);
+		if (q.tasks.size() > q.head)
+		{
+			out = q.tasks.back();
+			q.tasks.pop_back();
+			found = true;
+			__sync_sub_and_fetch(&_pending, 1);
+		}
+		if (q.tasks.size() == q.head)
+		{
+			q.tasks.clear();
+			q.head = 0;
+		}
+		pthread_mutex_unlock(&q.lock);
+		return found;
+	}
+
+	//다른 큐에서는 앞에서 훔친다. (가장 큰 덩어리일 가능성이 높다.)
+	bool
+	__steal(size_t start, task &out)
+	{
+		for (size_t k = 0; k < _nthreads; k++)
+		{
+			queue &q = _queues[(start + k) % _nthreads];
+			bool found = false;
+
+			pthread_mutex_lock(&q.lock);
+			if (q.tasks.size() > q.head)
+			{
+				out = q.tasks[q.head++];
+				found = true;
+				__sync_sub_and_fetch(&_pending, 1);
+			}
+			pthread_mutex_unlock(&q.lock);
+			if (found)
+				return true;
+		}
+		return false;
+	}
+
+	void
+	__run(const task &t)
+	{
+		t.fn(t.arg);
+		__sync_sub_and_fetch(&t.group->_left, 1);
+	}
+
+public:
+	static thread_pool &
+	instance(void)
+	{
+		static pthread_once_t once = PTHREAD_ONCE_INIT;
+		pthread_once(&once, &thread_pool::__create);
+		return *__instance_ptr();
+	}
+
+	size_t
+	size(void) const
+	{ return _nthreads; }
+
+	void
+	submit(task_group &group, task_fn fn, void *arg)
+	{
+		task t;
+		long id = __worker_id();
+		size_t target;
+
+		t.fn = fn;
+		t.arg = arg;
+		t.group = &group;
+		__sync_add_and_fetch(&group._left, 1);
+		if (id >= 0)
+			target = static_cast<size_t>(id);
+		else
+			target = static_cast<size_t>(__sync_fetch_and_add(&_next, 1)) % _nthreads;
+		pthread_mutex_lock(&_queues[target].lock);
+		_queues[target].tasks.push_back(t);
+		pthread_mutex_unlock(&_queues[target].lock);
+		pthread_mutex_lock(&_sleep_lock);
+		__sync_add_and_fetch(&_pending, 1);
+		pthread_cond_signal(&_wake);
+		pthread_mutex_unlock(&_sleep_lock);
+	}
+
+	//기다리는 동안 놀지 않고 남은 작업을 대신 처리한다. (작업 안에서 wait해도 교착되지 않는다.)
+	void
+	wait(task_group &group)
+	{
+		task t;
+		long id = __worker_id();
+		size_t start = id >= 0 ? static_cast<size_t>(id) : 0;
+
+		while (__sync_fetch_and_add(&group._left, 0) > 0)
+		{
+			if ((id >= 0 && this->__pop(start, t)) || this->__steal(start, t))
+				this->__run(t);
+			else
+				sched_yield();
+		}
+	}
+};
+
+//범위를 part개로 나눈 덩어리 하나.
+template <class Body>
+struct __chunk_job
+{
+	Body	*body;
+	size_t	part;
+	size_t	begin;
+	size_t	end;
+	bool	failed;
+	std::string	what;
+
+	__chunk_job() : body(0), part(0), begin(0), end(0), failed(false) {}
+
+	//워커 스레드 밖으로 예외가 나가면 terminate되므로 여기서 잡아 기록만 해둔다.
+	static void
+	run(void *arg)
+	{
+		__chunk_job *job = static_cast<__chunk_job *>(arg);
+		try
+		{
+			(*job->body)(job->part, job->begin, job->end);
+		}
+		catch (const std::exception &e)
+		{
+			job->failed = true;
+			job->what = e.what();
+		}
+		catch (...)
+		{
+			job->failed = true;
+			job->what = "ft::__parallel_for: unknown exception";
+		}
+	}
+};
+
+//원소 n개를 몇 덩어리로 나눌지. 덩어리 하나는 grain개 이상.
+inline size_t
+__part_count(size_t n, size_t grain)
+{
+	size_t parts = thread_pool::instance().size() * 4;
+	size_t max_parts = (n + grain - 1) / grain;
+
+	if (parts > max_parts)
+		parts = max_parts;
+	if (parts == 0)
+		parts = 1;
+	return parts;
+}
+
+//[0, n)을 parts개로 나눠 body(part, begin, end)를 병렬로 호출. 첫 덩어리는 호출한 스레드가 처리.
+//덩어리가 예외를 던져도 모든 덩어리가 끝난 뒤에 전파한다. 호출 스레드의 예외는 그대로,
+//워커의 예외는 C++98에서 옮길 방법이 없어 what()을 담은 std::runtime_error로 다시 던진다.
+template <class Body>
+void
+__parallel_for(size_t n, size_t parts, Body &body)
+{
+	if (parts <= 1)
+	{
+		body(0, 0, n);
+		return ;
+	}
+	thread_pool &pool = thread_pool::instance();
+	ft::vector<__chunk_job<Body> > jobs(parts);
+	task_group group;
+
+	for (size_t i = 0; i < parts; i++)
+	{
+		jobs[i].body = &body;
+		jobs[i].part = i;
+		jobs[i].begin = n * i / parts;
+		jobs[i].end = n * (i + 1) / parts;
+	}
+	for (size_t i = 1; i < parts; i++)
+		pool.submit(group, &__chunk_job<Body>::run, &jobs[i]);
+	try
+	{
+		body(0, jobs[0].begin, jobs[0].end);
+	}
+	catch (...)
+	{
+		//jobs와 group은 워커가 아직 쓰고 있으니 다 끝날 때까지 기다린 뒤 풀어준다.
+		pool.wait(group);
+		throw;
+	}
+	pool.wait(group);
+	for (size_t i = 1; i < parts; i++)
+		if (jobs[i].failed)
+			throw std::runtime_error(jobs[i].what);
+}
+
+//이보다 작은 범위는 스레드에 나눠주지 않는다.
+static const size_t __parallel_grain = 4096;
+
+/*
+** for_each
+*/
+template <class It, class F>
+F
+for_each(It first, It last, F f)
+{
+	for (; first != last; ++first)
+		f(*first);
+	return f;
+}
+
+template <class It, class F>
+struct __for_each_body
+{
+	It	first;
+	F	f;
+
+	__for_each_body(It first_, F f_) : first(first_), f(f_) {}
+
+	void
+	operator()(size_t, size_t begin, size_t end)
+	{
+		ft::for_each(first + begin, first + end, f);
+	}
+};
+
+template <class It, class F>
+void
+for_each(const execution::sequenced_policy &, It first, It last, F f)
+{
+	ft::for_each(first, last, f);
+}
+
+template <class It, class F>
+void
+for_each(const execution::parallel_policy &, It first, It last, F f)
+{
+	size_t n = static_cast<size_t>(last - first);
+	__for_each_body<It, F> body(first, f);
+
+	ft::__parallel_for(n, ft::__part_count(n, __parallel_grain), body);
+}
+
+/*
+** transform
+*/
+template <class It, class Out, class Op>
+Out
+transform(It first, It last, Out out, Op op)
+{
+	for (; first != last; ++first, ++out)
+		*out = op(*first);
+	return out;
+}
+
+template <class It, class Out, class Op>
+struct __transform_body
+{
+	It	first;
+	Out	out;
+	Op	op;
+
+	__transform_body(It first_, Out out_, Op op_) : first(first_), out(out_), op(op_) {}
+
+	void
+	operator()(size_t, size_t begin, size_t end)
+	{
+		ft::transform(first + begin, first + end, out + begin, op);
+	}
+};
+
+template <class It, class Out, class Op>
+Out
+transform(const execution::sequenced_policy &, It first, It last, Out out, Op op)
+{
+	return ft::transform(first, last, out, op);
+}
+
+template <class It, class Out, class Op>
+Out
+transform(const execution::parallel_policy &, It first, It last, Out out, Op op)
+{
+	size_t n = static_cast<size_t>(last - first);
+	__transform_body<It, Out, Op> body(first, out, op);
+
+	ft::__parallel_for(n, ft::__part_count(n, __parallel_grain), body);
+	return out + n;
+}
+
+/*
+** reduce
+*/
+template <class It, class T, class Op>
+T
+reduce(It first, It last, T init, Op op)
+{
+	for (; first != last; ++first)
+		init = op(init, *first);
+	return init;
+}
+
+template <class It, class T>
+T
+reduce(It first, It last, T init)
+{
+	return ft::reduce(first, last, init, std::plus<T>());
+}
+
+//덩어리마다 부분합을 따로 구하고, 마지막에 덩어리 순서대로 합친다. (op는 결합법칙만 만족하면 된다.)
+template <class It, class T, class Op>
+struct __reduce_body
+{
+	It				first;
+	Op				op;
+	ft::vector<T>	partial;
+
+	__reduce_body(It first_, Op op_, size_t parts) : first(first_), op(op_), partial(parts) {}
+
+	void
+	operator()(size_t part, size_t begin, size_t end)
+	{
+		It it = first + begin;
+		T acc = *it;
+
+		partial[part] = ft::reduce(++it, first + end, acc, op);
+	}
+};
+
+template <class It, class T, class Op>
+T
+reduce(const execution::sequenced_policy &, It first, It last, T init, Op op)
+{
+	return ft::reduce(first, last, init, op);
+}
+
+template <class It, class T>
+T
+reduce(const execution::sequenced_policy &, It first, It last, T init)
+{
+	return ft::reduce(first, last, init);
+}
+
+template <class It, class T, class Op>
+T
+reduce(const execution::parallel_policy &, It first, It last, T init, Op op)
+{
+	size_t n = static_cast<size_t>(last - first);
+	if (n == 0)
+		return init;
+	size_t parts = ft::__part_count(n, __parallel_grain);
+	__reduce_body<It, T, Op> body(first, op, parts);
+
+	ft::__parallel_for(n, parts, body);
+	for (size_t i = 0; i < parts; i++)
+		init = op(init, body.partial[i]);
+	return init;
+}
+
+template <class It, class T>
+T
+reduce(const execution::parallel_policy &policy, It first, It last, T init)
+{
+	return ft::reduce(policy, first, last, init, std::plus<T>());
+}
+
+/*
+** parallel sort / stable_sort
+*/
+//덩어리마다 따로 정렬.
+template <class It, class T, class Comp>
+struct __sort_chunk_body
+{
+	It		first;
+	T		*buf;
+	Comp	comp;
+	bool	stable;
+
+	__sort_chunk_body(It first_, T *buf_, Comp comp_, bool stable_)
+	: first(first_), buf(buf_), comp(comp_), stable(stable_) {}
+
+	void
+	operator()(size_t, size_t begin, size_t end)
+	{
+		if (stable)
+			ft::__merge_sort(first + begin, first + end, buf + begin, comp);
+		else
+			ft::sort(first + begin, first + end, comp);
+	}
+};
+
+//정렬된 덩어리를 width개씩 짝지어 합친다. part번째 작업은 덩어리 2*width*part부터 담당.
+template <class It, class T, class Comp>
+struct __merge_round_body
+{
+	It							first;
+	T							*buf;
+	Comp						comp;
+	const ft::vector<size_t>	*bounds;
+	size_t						width;
+
+	__merge_round_body(It first_, T *buf_, Comp comp_, const ft::vector<size_t> *bounds_, size_t width_)
+	: first(first_), buf(buf_), comp(comp_), bounds(bounds_), width(width_) {}
+
+	void
+	operator()(size_t, size_t begin, size_t end)
+	{
+		const ft::vector<size_t> &b = *bounds;
+		size_t last_chunk = b.size() - 1;
+
+		for (size_t i = begin; i < end; i++)
+		{
+			size_t lo = i * 2 * width;
+			size_t mid = lo + width;
+			size_t hi = mid + width;
+			if (mid >= last_chunk)
+				continue;
+			if (hi > last_chunk)
+				hi = last_chunk;
+			ft::__merge_adjacent(first + b.at(lo), first + b.at(mid), first + b.at(hi), buf + b.at(lo), comp);
+		}
+	}
+};
+
+template <class It, class Comp>
+void
+__parallel_sort(It first, It last, Comp comp, bool stable)
+{
+	typedef typename ft::iterator_traits<It>::value_type value_type;
+
+	size_t n = static_cast<size_t>(last - first);
+	size_t parts = ft::__part_count(n, __parallel_grain);
+	if (parts <= 1)
+	{
+		if (stable)
+			ft::stable_sort(first, last, comp);
+		else
+			ft::sort(first, last, comp);
+		return ;
+	}
+	ft::vector<value_type> buf(first, last);
+	ft::vector<size_t> bounds(parts + 1);
+	for (size_t i = 0; i <= parts; i++)
+		bounds[i] = n * i / parts;
+
+	__sort_chunk_body<It, value_type, Comp> sorter(first, &buf[0], comp, stable);
+	ft::__parallel_for(n, parts, sorter);
+
+	for (size_t width = 1; width < parts; width *= 2)
+	{
+		size_t merges = (parts + 2 * width - 1) / (2 * width);
+		__merge_round_body<It, value_type, Comp> merger(first, &buf[0], comp, &bounds, width);
+		ft::__parallel_for(merges, merges, merger);
+	}
+}
+
+template <class It, class Comp>
+void
+sort(const execution::sequenced_policy &, It first, It last, Comp comp)
+{
+	ft::sort(first, last, comp);
+}
+
+template <class It>
+void
+sort(const execution::sequenced_policy &, It first, It last)
+{
+	ft::sort(first, last);
+}
+
+template <class It, class Comp>
+void
+sort(const execution::parallel_policy &, It first, It last, Comp comp)
+{
+	ft::__parallel_sort(first, last, comp, false);
+}
+
+template <class It>
+void
+sort(const execution::parallel_policy &policy, It first, It last)
+{
+	ft::sort(policy, first, last, std::less<typename ft::iterator_traits<It>::value_type>());
+}
+
+template <class It, class Comp>
+void
+stable_sort(const execution::sequenced_policy &, It first, It last, Comp comp)
+{
+	ft::stable_sort(first, last, comp);
+}
+
+template <class It>
+void
+stable_sort(const execution::sequenced_policy &, It first, It last)
+{
+	ft::stable_sort(first, last);
+}
+
+template <class It, class Comp>
+void
+stable_sort(const execution::parallel_policy &, It first, It last, Comp comp)
+{
+	ft::__parallel_sort(first, last, comp, true);
+}
+
+template <class It>
+void
+stable_sort(const execution::parallel_policy &policy, It first, It last)
+{
+	ft::stable_sort(policy, first, last, std::less<typename ft::iterator_traits<It>::value_type>());
+}
+
+}
+
+#endif
@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <stdexcept>
+#include <stdlib.h>
+#include "algorithm.hpp"
+#include "tester.hpp"
+
+struct Twice
+{
+	int	operator()(const int &x) const { return x * 2; }
+};
+
+struct Bump
+{
+	void	operator()(int &x) const { ++x; }
+};
+
+//target을 만나면 던진다. 어느 덩어리(호출 스레드/워커)에서 던지는지 target으로 고른다.
+struct ThrowAt
+{
+	int	target;
+
+	explicit ThrowAt(int t) : target(t) {}
+	int	operator()(const int &x) const { if (x == target) throw std::logic_error("ThrowAt"); return x; }
+};
+
+struct ThrowingLess
+{
+	bool	operator()(int a, int b) const { if (a == 12345 || b == 12345) throw std::logic_error("ThrowingLess"); return a < b; }
+};
+
+//첫 값만 비교해서, 같은 키끼리의 순서가 유지되는지 본다.
+struct FirstLess
+{
+	bool	operator()(const ft::pair<int, int> &a, const ft::pair<int, int> &b) const { return a.first < b.first; }
+};
+
+static void
+fill(ft::vector<int> &v, std::vector<int> &ref, size_t n)
+{
+	v.clear();
+	ref.clear();
+	for (size_t i = 0; i < n; i++)
+	{
+		int x = rand() % 100000 - 50000;
+		v.push_back(x);
+		ref.push_back(x);
+	}
+}
+
+static bool
+same(const ft::vector<int> &v, const std::vector<int> &ref)
+{
+	return v.size() == ref.size() && std::equal(ref.begin(), ref.end(), v.begin());
+}
+
+int main(void)
+{
+	srand(42);
+	ft::vector<int> v;
+	std::vector<int> ref;
+	//병렬 오버로드는 __parallel_grain보다 큰 범위에서만 나눠지므로 작은 것과 큰 것을 모두 본다.
+	size_t sizes[] = {0, 1, 17, 4096, 100000};
+
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+	{
+		size_t n = sizes[s];
+
+		fill(v, ref, n);
+		ft::for_each(ft::execution::par, v.begin(), v.end(), Bump());
+		std::for_each(ref.begin(), ref.end(), Bump());
+		FT_CHECK(same(v, ref));
+
+		ft::vector<int> out(n);
+		ft::transform(ft::execution::par, v.begin(), v.end(), out.begin(), Twice());
+		std::transform(ref.begin(), ref.end(), ref.begin(), Twice());
+		FT_CHECK(same(out, ref));
+
+		long long sum = 0;
+		for (size_t i = 0; i < n; i++)
+			sum += ref[i];
+		FT_CHECK(ft::reduce(ft::execution::par, out.begin(), out.end(), 0LL) == sum);
+		FT_CHECK(ft::reduce(ft::execution::seq, out.begin(), out.end(), 0LL) == sum);
+
+		fill(v, ref, n);
+		ft::sort(ft::execution::par, v.begin(), v.end());
+		std::sort(ref.begin(), ref.end());
+		FT_CHECK(same(v, ref));
+
+		fill(v, ref, n);
+		ft::sort(ft::execution::seq, v.begin(), v.end(), std::greater<int>());
+		std::sort(ref.begin(), ref.end(), std::greater<int>());
+		FT_CHECK(same(v, ref));
+
+		ft::vector<ft::pair<int, int> > p;
+		std::vector<std::pair<int, int> > pref;
+		for (size_t i = 0; i < n; i++)
+		{
+			int k = rand() % 50;
+			p.push_back(ft::make_pair(k, static_cast<int>(i)));
+			pref.push_back(std::make_pair(k, static_cast<int>(i)));
+		}
+		ft::stable_sort(ft::execution::par, p.begin(), p.end(), FirstLess());
+		std::stable_sort(pref.begin(), pref.end());
+		bool stable = true;
+		for (size_t i = 0; i < n; i++)
+			stable = stable && p[i].first == pref[i].first && p[i].second == pref[i].second;
+		FT_CHECK(stable);
+	}
+
+	//이미 정렬된 입력과 모두 같은 값. (피벗이 나쁘게 골라지는 경우)
+	fill(v, ref, 50000);
+	std::sort(ref.begin(), ref.end());
+	ft::sort(v.begin(), v.end());
+	ft::sort(ft::execution::par, v.begin(), v.end());
+	FT_CHECK(same(v, ref));
+	ft::vector<int> same_v(50000, 7);
+	ft::sort(ft::execution::par, same_v.begin(), same_v.end());
+	FT_CHECK(same_v.front() == 7 && same_v.back() == 7);
+
+	//덩어리가 예외를 던져도 모든 덩어리가 끝난 뒤 호출 스레드로 전파돼야 한다.
+	const int big = 50000;
+	ft::vector<int> seq(big);
+	for (int i = 0; i < big; i++)
+		seq[i] = i;
+	int targets[] = {0, big / 2, big - 1};
+	for (size_t t = 0; t < sizeof(targets) / sizeof(targets[0]); t++)
+	{
+		bool caught = false;
+		try { ft::for_each(ft::execution::par, seq.begin(), seq.end(), ThrowAt(targets[t])); }
+		catch (const std::logic_error &) { caught = true; }
+		catch (const std::runtime_error &e) { caught = std::string(e.what()) == "ThrowAt"; }
+		FT_CHECK(caught);
+
+		caught = false;
+		ft::vector<int> out(big);
+		try { ft::transform(ft::execution::par, seq.begin(), seq.end(), out.begin(), ThrowAt(targets[t])); }
+		catch (const std::exception &) { caught = true; }
+		FT_CHECK(caught);
+	}
+	{
+		bool caught = false;
+		ft::vector<int> w(seq);
+		try { ft::sort(ft::execution::par, w.begin(), w.end(), ThrowingLess()); }
+		catch (const std::exception &) { caught = true; }
+		FT_CHECK(caught);
+	}
+	//예외 뒤에도 풀은 멀쩡해야 한다.
+	fill(v, ref, 100000);
+	ft::for_each(ft::execution::par, v.begin(), v.end(), Bump());
+	std::for_each(ref.begin(), ref.end(), Bump());
+	FT_CHECK(same(v, ref));
+	return ft_test::result("algorithm");
+}
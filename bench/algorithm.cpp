@@ -0,0 +1,91 @@
+#include <stdlib.h>
+#include <string.h>
+#include "algorithm.hpp"
+#include "bench.hpp"
+
+//main.cpp의 Buffer와 같은 모양.
+#define BUFFER_SIZE 4096
+struct Buffer
+{
+	int idx;
+	char buff[BUFFER_SIZE];
+};
+
+struct Stamp
+{
+	void	operator()(Buffer &b) const { memset(b.buff, b.idx & 0xff, BUFFER_SIZE); }
+};
+
+struct Checksum
+{
+	long	operator()(const Buffer &b) const {
+		long s = 0;
+		for (int i = 0; i < BUFFER_SIZE; i += 64)
+			s += b.buff[i];
+		return s + b.idx;
+	}
+};
+
+struct ByIdx
+{
+	bool	operator()(const Buffer &a, const Buffer &b) const { return a.idx < b.idx; }
+};
+
+struct Square
+{
+	int	operator()(int x) const { return x * x; }
+};
+
+template <class Policy>
+static void
+run(const Policy &policy, const char *name)
+{
+	const size_t nint = 20000000;
+	const size_t nbuf = 16384;
+	ft::vector<int> v(nint);
+	ft::vector<int> out(nint);
+	ft::vector<Buffer> buf(nbuf);
+	ft::vector<long> sums(nbuf);
+	double t;
+
+	std::cout << "-- " << name << " (" << ft::thread_pool::instance().size() << " threads)" << std::endl;
+	srand(1);
+	for (size_t i = 0; i < nint; i++)
+		v[i] = rand();
+	for (size_t i = 0; i < nbuf; i++)
+		buf[i].idx = rand();
+
+	t = ft_bench::now();
+	ft::transform(policy, v.begin(), v.end(), out.begin(), Square());
+	ft_bench::report("vector<int> transform 20M", ft_bench::now() - t);
+	t = ft_bench::now();
+	long long r = ft::reduce(policy, v.begin(), v.end(), 0LL);
+	ft_bench::report("vector<int> reduce 20M", ft_bench::now() - t);
+	ft_bench::keep(r);
+	t = ft_bench::now();
+	ft::sort(policy, v.begin(), v.end());
+	ft_bench::report("vector<int> sort 20M", ft_bench::now() - t);
+	for (size_t i = 0; i < nint; i++)
+		v[i] = rand();
+	t = ft_bench::now();
+	ft::stable_sort(policy, v.begin(), v.end());
+	ft_bench::report("vector<int> stable_sort 20M", ft_bench::now() - t);
+
+	t = ft_bench::now();
+	ft::for_each(policy, buf.begin(), buf.end(), Stamp());
+	ft_bench::report("vector<Buffer> for_each 16K x 4KB", ft_bench::now() - t);
+	t = ft_bench::now();
+	ft::transform(policy, buf.begin(), buf.end(), sums.begin(), Checksum());
+	ft_bench::report("vector<Buffer> transform 16K x 4KB", ft_bench::now() - t);
+	t = ft_bench::now();
+	ft::sort(policy, buf.begin(), buf.end(), ByIdx());
+	ft_bench::report("vector<Buffer> sort 16K x 4KB", ft_bench::now() - t);
+}
+
+//스레드 수는 쓸 수 있는 CPU 수를 따른다. 1~N 코어 확장은 bench/algorithm_scaling.sh가 taskset으로 잰다.
+int main(void)
+{
+	run(ft::execution::seq, "seq");
+	run(ft::execution::par, "par");
+	return 0;
+}
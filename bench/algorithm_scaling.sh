@@ -0,0 +1,10 @@
+#!/bin/sh
+# bench/algorithm을 1개부터 모든 CPU까지 taskset으로 묶어 돌린다. (thread_pool은 허용된 CPU 수만큼 만든다)
+make -s bench/algorithm || exit 1
+n=$(nproc)
+i=1
+while [ $i -le $n ]; do
+	echo "== $i core(s)"
+	taskset -c 0-$((i - 1)) ./bench/algorithm | grep -A7 -- "-- par"
+	i=$((i + 1))
+done
@@ -0,0 +1,76 @@
+#ifndef BENCH_HPP
+# define BENCH_HPP
+
+# include <cstddef>
+# include <ctime>
+# include <iostream>
+# include <memory>
+
+//bench/*.cpp가 함께 쓰는 시계. 결과는 ms로 찍는다.
+namespace ft_bench
+{
+inline double
+now(void)
+{
+	timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+inline void
+report(const char *what, double seconds)
+{
+	std::cout << what << ": " << seconds * 1e3 << " ms" << std::endl;
+}
+
+//최적화로 결과가 지워지지 않게 한다.
+template <class T>
+inline void
+keep(const T &v)
+{
+	__asm__ __volatile__("" : : "g"(&v) : "memory");
+}
+
+//지금 잡혀 있는 바이트 수. 원소당 메모리를 잴 때 쓴다.
+inline size_t &
+live_bytes(void)
+{
+	static size_t n = 0;
+	return n;
+}
+
+template <class T>
+class counting_allocator : public std::allocator<T>
+{
+public:
+	template <class U>
+	struct rebind { typedef counting_allocator<U> other; };
+
+	counting_allocator(void) {}
+	template <class U>
+	counting_allocator(const counting_allocator<U> &) {}
+
+	T *
+	allocate(size_t n, const void * = 0)
+	{
+		live_bytes() += n * sizeof(T);
+		return std::allocator<T>::allocate(n);
+	}
+
+	void
+	deallocate(T *p, size_t n)
+	{
+		live_bytes() -= n * sizeof(T);
+		std::allocator<T>::deallocate(p, n);
+	}
+};
+
+inline void
+report_bytes(const char *what, size_t bytes, size_t n)
+{
+	std::cout << what << ": " << static_cast<double>(bytes) / n << " B/elem" << std::endl;
+}
+}
+
+#endif
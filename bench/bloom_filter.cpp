@@ -0,0 +1,63 @@
+#include <stdlib.h>
+#include "set.hpp"
+#include "bloom_filter.hpp"
+#include "bench.hpp"
+
+//main.cpp의 set count 반복처럼 조회가 대부분 빗나가는 경우. 없는 키 비율 90%, 99%에서 필터 유무를 비교한다.
+#define COUNT 1000000
+
+static double
+probe(const ft::set<int> &s, const ft::vector<int> &keys, long &sum)
+{
+	double t = ft_bench::now();
+	for (size_t i = 0; i < keys.size(); i++)
+		sum += s.count(keys[i]);
+	return ft_bench::now() - t;
+}
+
+int main(void)
+{
+	const int lookups = 2000000;
+	int miss_pct[] = {90, 99};
+	size_t bits[] = {8, 10, 16};
+	ft::set<int> s;
+	ft::vector<int> present;
+	long sum = 0;
+
+	//짝수만 넣으므로 홀수는 확실히 없는 키다.
+	srand(1);
+	while (s.size() < COUNT)
+		s.insert((rand() % (COUNT * 8)) * 2);
+	for (ft::set<int>::iterator it = s.begin(); it != s.end(); ++it)
+		present.push_back(*it);
+
+	//오탐률: 없는 키 중 필터가 있다고 한 비율.
+	for (size_t b = 0; b < sizeof(bits) / sizeof(bits[0]); b++)
+	{
+		ft::bloom_filter<int> f(bits[b]);
+		f.reset(present.size());
+		for (size_t i = 0; i < present.size(); i++)
+			f.insert(present[i]);
+		size_t fp = 0;
+		for (int i = 0; i < lookups; i++)
+			fp += f.may_contain((rand() % (COUNT * 8)) * 2 + 1);
+		std::cout << bits[b] << " bits/key false positive rate: " << 100.0 * fp / lookups << " %" << std::endl;
+	}
+
+	for (size_t p = 0; p < sizeof(miss_pct) / sizeof(miss_pct[0]); p++)
+	{
+		ft::vector<int> keys;
+		for (int i = 0; i < lookups; i++)
+			keys.push_back(rand() % 100 < miss_pct[p] ? (rand() % (COUNT * 8)) * 2 + 1 : present[rand() % present.size()]);
+		std::cout << "-- " << miss_pct[p] << "% misses, " << lookups << " lookups on " << s.size() << " keys" << std::endl;
+		s.disable_filter();
+		double plain = probe(s, keys, sum);
+		ft_bench::report("count, no filter", plain);
+		s.enable_filter();
+		double filtered = probe(s, keys, sum);
+		ft_bench::report("count, filter 10 bits/key", filtered);
+		std::cout << "speedup: " << plain / filtered << "x" << std::endl;
+	}
+	ft_bench::keep(sum);
+	return 0;
+}
@@ -0,0 +1,61 @@
+#include <stdlib.h>
+#include "map.hpp"
+#include "btree_map.hpp"
+#include "bench.hpp"
+
+//main.cpp의 map 작업: 임의 키 약 100만 개를 넣고 찾는다.
+#define MAX_RAM 4294967296
+#define BUFFER_SIZE 4096
+#define COUNT (MAX_RAM / (int)(sizeof(int) + BUFFER_SIZE))
+
+typedef ft_bench::counting_allocator<ft::pair<const int, int> >	alloc_t;
+
+template <class M>
+static void
+run(const char *name)
+{
+	const int lookups = 1000000;
+	double t;
+	size_t before = ft_bench::live_bytes();
+
+	std::cout << "-- " << name << std::endl;
+	srand(1);
+	{
+		M m;
+
+		t = ft_bench::now();
+		for (int i = 0; i < COUNT; ++i)
+			m.insert(ft::make_pair(rand(), rand()));
+		ft_bench::report("insert 1M random", ft_bench::now() - t);
+		ft_bench::report_bytes("memory", ft_bench::live_bytes() - before, m.size());
+
+		long sum = 0;
+		t = ft_bench::now();
+		for (int i = 0; i < lookups; i++)
+			sum += m.count(rand());
+		ft_bench::report("lookup 1M random", ft_bench::now() - t);
+		t = ft_bench::now();
+		for (typename M::iterator it = m.begin(); it != m.end(); ++it)
+			sum += it->second;
+		ft_bench::report("scan", ft_bench::now() - t);
+		t = ft_bench::now();
+		for (int i = 0; i < 1000; i++)
+		{
+			typename M::iterator it = m.lower_bound(rand());
+			for (int j = 0; j < 1000 && it != m.end(); ++j, ++it)
+				sum += it->second;
+		}
+		ft_bench::report("range scan 1000 x 1000", ft_bench::now() - t);
+		ft_bench::keep(sum);
+		t = ft_bench::now();
+	}
+	ft_bench::report("destroy", ft_bench::now() - t);
+}
+
+int main(void)
+{
+	run<ft::map<int, int, std::less<int>, alloc_t> >("ft::map");
+	run<ft::btree_map<int, int, std::less<int>, alloc_t> >("ft::btree_map (256B nodes)");
+	run<ft::btree_map<int, int, std::less<int>, alloc_t, 4096> >("ft::btree_map (4KB nodes)");
+	return 0;
+}
@@ -0,0 +1,73 @@
+#include <stdlib.h>
+#include "map.hpp"
+#include "bench.hpp"
+
+//키 약 2M개의 map을 임의 순서로 채운 뒤 지우고 넣기를 2M번 섞어 노드를 흩어 놓는다.
+//compact() 전후의 전체 순회와, 한 번에 옮기는 경우와 4096개씩 나눠 옮기는 경우를 잰다.
+#define COUNT 2000000
+
+typedef ft::map<int, long>	map_t;
+
+static void
+scatter(map_t &m)
+{
+	srand(1);
+	for (int i = 0; i < COUNT; i++)
+		m.insert(ft::make_pair(rand(), static_cast<long>(i)));
+	for (int i = 0; i < COUNT; i++)
+	{
+		map_t::iterator it = m.lower_bound(rand());
+		if (it == m.end())
+			it = m.begin();
+		m.erase(it);
+		m.insert(ft::make_pair(rand(), static_cast<long>(i)));
+	}
+}
+
+static long
+scan(const map_t &m)
+{
+	long sum = 0;
+
+	for (map_t::const_iterator it = m.begin(); it != m.end(); ++it)
+		sum += it->second;
+	return sum;
+}
+
+int main(void)
+{
+	long sum = 0;
+	double t;
+
+	std::cout << "-- compact() in one call" << std::endl;
+	{
+		map_t m;
+		scatter(m);
+		t = ft_bench::now();
+		sum += scan(m);
+		ft_bench::report("scan before", ft_bench::now() - t);
+		t = ft_bench::now();
+		m.compact();
+		ft_bench::report("compact()", ft_bench::now() - t);
+		t = ft_bench::now();
+		sum += scan(m);
+		ft_bench::report("scan after", ft_bench::now() - t);
+	}
+
+	std::cout << "-- compact(4096) until done" << std::endl;
+	{
+		map_t m;
+		scatter(m);
+		size_t steps = 1;
+		t = ft_bench::now();
+		while (!m.compact(4096))
+			++steps;
+		ft_bench::report("compact(4096), all steps", ft_bench::now() - t);
+		std::cout << "steps: " << steps << std::endl;
+		t = ft_bench::now();
+		sum += scan(m);
+		ft_bench::report("scan after", ft_bench::now() - t);
+	}
+	ft_bench::keep(sum);
+	return 0;
+}
@@ -0,0 +1,70 @@
+#include "cow_vector.hpp"
+#include "bench.hpp"
+
+//읽기 전용으로 넘겨주려고 복사하는 경우와, 복사한 뒤 바로 고치는 경우를 비교한다.
+//같은 원소 수(ROUNDS * size)를 다루도록 복사 횟수를 맞춘다.
+#define TOTAL 100000000
+
+template <class V>
+static long
+read_all(const V &v)
+{
+	long sum = 0;
+
+	for (size_t i = 0; i < v.size(); i++)
+		sum += v[i];
+	return sum;
+}
+
+template <class V>
+static void
+run(const V &src, const char *name)
+{
+	int rounds = static_cast<int>(TOTAL / src.size());
+	long sum = 0;
+	double t;
+
+	t = ft_bench::now();
+	for (int r = 0; r < rounds; r++)
+	{
+		V copy(src);
+		sum += read_all(copy);
+	}
+	std::cout << name << " x" << src.size() << " ";
+	ft_bench::report("copy then read", ft_bench::now() - t);
+	t = ft_bench::now();
+	for (int r = 0; r < rounds; r++)
+	{
+		V copy(src);
+		copy.push_back(r);
+		sum += read_all(copy);
+	}
+	std::cout << name << " x" << src.size() << " ";
+	ft_bench::report("copy then write", ft_bench::now() - t);
+	t = ft_bench::now();
+	for (int r = 0; r < rounds; r++)
+	{
+		V copy(src);
+		sum += copy.size();
+	}
+	std::cout << name << " x" << src.size() << " ";
+	ft_bench::report("copy only", ft_bench::now() - t);
+	ft_bench::keep(sum);
+}
+
+int main(void)
+{
+	size_t sizes[] = {16, 1000, 1000000};
+
+	std::cout << "-- " << TOTAL << " elements handled per row" << std::endl;
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+	{
+		ft::vector<int> v;
+		for (size_t i = 0; i < sizes[s]; i++)
+			v.push_back(static_cast<int>(i));
+		ft::cow_vector<int> cv(v);
+		run(v, "ft::vector     ");
+		run(cv, "ft::cow_vector ");
+	}
+	return 0;
+}
@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <cstdio>
+#include <stdlib.h>
+#include <vector>
+#include "rbt.hpp"
+#include "set.hpp"
+#include "bench.hpp"
+
+//erase_if의 두 길이 어디서 갈리는지 잰다. 하나씩 지우기(probe -1)와 처음부터 다시 만들기(probe 0)를
+//노드가 흩어진 트리와 compact된 트리에서 지우는 비율마다 비교하고, set::erase_if가 고르는 길도 같이 잰다.
+#define COUNT 1000000
+
+typedef ft::rbt<int>	tree_t;
+
+//키를 섞어서 pct%를 지운다.
+struct Drop
+{
+	unsigned	pct;
+
+	bool	operator()(const int &k) const { return (static_cast<unsigned>(k) * 2654435761u >> 8) % 100 < pct; }
+};
+
+template <class Tree>
+static void
+fill(Tree &t, const std::vector<int> &keys, bool compacted)
+{
+	for (size_t i = 0; i < keys.size(); i++)
+		t.insert(keys[i]);
+	if (compacted)
+		t.compact();
+}
+
+int main(void)
+{
+	unsigned pcts[] = {10, 50, 70, 90, 99};
+	std::vector<int> keys;
+	char what[64];
+	size_t sum = 0;
+
+	for (int i = 0; i < COUNT; i++)
+		keys.push_back(i);
+	srand(1);
+	std::random_shuffle(keys.begin(), keys.end());
+	for (int compacted = 0; compacted < 2; compacted++)
+	{
+		std::cout << (compacted ? "-- after compact()" : "-- scattered nodes") << std::endl;
+		for (size_t p = 0; p < sizeof(pcts) / sizeof(pcts[0]); p++)
+		{
+			Drop d = {pcts[p]};
+			double t;
+			{
+				tree_t tree;
+				fill(tree, keys, compacted);
+				t = ft_bench::now();
+				sum += tree.erase_if(d, static_cast<size_t>(-1));
+				std::sprintf(what, "%u%% one by one", pcts[p]);
+				ft_bench::report(what, ft_bench::now() - t);
+			}
+			{
+				tree_t tree;
+				fill(tree, keys, compacted);
+				t = ft_bench::now();
+				sum += tree.erase_if(d, 0);
+				std::sprintf(what, "%u%% rebuild", pcts[p]);
+				ft_bench::report(what, ft_bench::now() - t);
+			}
+			{
+				ft::set<int> s;
+				fill(s, keys, compacted);
+				t = ft_bench::now();
+				sum += s.erase_if(d);
+				std::sprintf(what, "%u%% set::erase_if", pcts[p]);
+				ft_bench::report(what, ft_bench::now() - t);
+			}
+		}
+	}
+	ft_bench::keep(sum);
+	return 0;
+}
@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <stdlib.h>
+#include "map.hpp"
+#include "bench.hpp"
+
+//요청 하나가 키 여러 개를 찾는 상황. 키마다 find와 find_many(섞인 순서, 정렬된 순서)를 비교한다.
+#define COUNT 1000000
+
+int main(void)
+{
+	const size_t total = 2000000;
+	ft::map<int, int> m;
+	size_t batches[] = {8, 16, 64, 256, 1024};
+
+	srand(1);
+	for (int i = 0; i < COUNT; i++)
+		m.insert(ft::make_pair(rand(), i));
+	//절반은 있는 키, 절반은 없는 키.
+	ft::vector<int> present;
+	for (ft::map<int, int>::iterator it = m.begin(); it != m.end(); ++it)
+		present.push_back(it->first);
+	ft::vector<int> probes(total);
+	for (size_t i = 0; i < total; i++)
+		probes[i] = (i & 1) ? rand() : present[rand() % present.size()];
+	ft::vector<ft::map<int, int>::iterator> out(1024);
+
+	std::cout << "-- " << m.size() << " keys, " << total << " lookups" << std::endl;
+	for (size_t b = 0; b < sizeof(batches) / sizeof(batches[0]); b++)
+	{
+		size_t n = batches[b];
+		long sum = 0;
+		double t;
+
+		std::cout << "batch " << n << std::endl;
+		t = ft_bench::now();
+		for (size_t i = 0; i + n <= total; i += n)
+			for (size_t j = 0; j < n; j++)
+				sum += m.find(probes[i + j]) != m.end();
+		ft_bench::report("  find per key", ft_bench::now() - t);
+		t = ft_bench::now();
+		for (size_t i = 0; i + n <= total; i += n)
+		{
+			m.find_many(probes.begin() + i, probes.begin() + i + n, out.begin());
+			for (size_t j = 0; j < n; j++)
+				sum += out[j] != m.end();
+		}
+		ft_bench::report("  find_many", ft_bench::now() - t);
+
+		//정렬 비용도 재는 시간에 넣는다.
+		ft::vector<int> batch(n);
+		t = ft_bench::now();
+		for (size_t i = 0; i + n <= total; i += n)
+		{
+			std::copy(probes.begin() + i, probes.begin() + i + n, batch.begin());
+			std::sort(batch.begin(), batch.end());
+			m.find_many(batch.begin(), batch.end(), out.begin(), true);
+			for (size_t j = 0; j < n; j++)
+				sum += out[j] != m.end();
+		}
+		ft_bench::report("  sort + find_many(sorted)", ft_bench::now() - t);
+
+		//이웃한 키 묶음(범위 조회 같은 경우). 여기서 이어 찾기가 이득이다.
+		t = ft_bench::now();
+		for (size_t i = 0; i + n <= total; i += n)
+		{
+			size_t at = static_cast<size_t>(probes[i]) % (present.size() - n);
+			for (size_t j = 0; j < n; j++)
+				sum += m.find(present[at + j]) != m.end();
+		}
+		ft_bench::report("  neighbours: find per key", ft_bench::now() - t);
+		t = ft_bench::now();
+		for (size_t i = 0; i + n <= total; i += n)
+		{
+			size_t at = static_cast<size_t>(probes[i]) % (present.size() - n);
+			m.find_many(present.begin() + at, present.begin() + at + n, out.begin(), true);
+			for (size_t j = 0; j < n; j++)
+				sum += out[j] != m.end();
+		}
+		ft_bench::report("  neighbours: find_many(sorted)", ft_bench::now() - t);
+		ft_bench::keep(sum);
+	}
+	return 0;
+}
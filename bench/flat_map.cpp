@@ -0,0 +1,59 @@
+#include <stdlib.h>
+#include "map.hpp"
+#include "flat_map.hpp"
+#include "bench.hpp"
+
+//한 번 채우고 여러 번 찾는 표. 키는 main.cpp처럼 rand().
+#define COUNT 1000000
+
+typedef ft::map<int, int, std::less<int>, ft_bench::counting_allocator<ft::pair<const int, int> > >	map_t;
+
+int main(void)
+{
+	const int lookups = 1000000;
+	ft::vector<ft::pair<int, int> > in;
+	double t;
+	long sum = 0;
+
+	srand(1);
+	for (int i = 0; i < COUNT; i++)
+		in.push_back(ft::make_pair(rand(), rand()));
+
+	std::cout << "-- ft::map" << std::endl;
+	{
+		map_t m;
+		t = ft_bench::now();
+		for (size_t i = 0; i < in.size(); i++)
+			m.insert(in[i]);
+		ft_bench::report("build 1M (insert one by one)", ft_bench::now() - t);
+		ft_bench::report_bytes("memory", ft_bench::live_bytes(), m.size());
+		srand(2);
+		t = ft_bench::now();
+		for (int i = 0; i < lookups; i++)
+			sum += m.count(rand());
+		ft_bench::report("lookup 1M random", ft_bench::now() - t);
+		t = ft_bench::now();
+		for (map_t::iterator it = m.begin(); it != m.end(); ++it)
+			sum += it->second;
+		ft_bench::report("scan", ft_bench::now() - t);
+	}
+
+	std::cout << "-- ft::flat_map" << std::endl;
+	{
+		t = ft_bench::now();
+		ft::flat_map<int, int> m(in.begin(), in.end());
+		ft_bench::report("build 1M (sort then unique)", ft_bench::now() - t);
+		ft_bench::report_bytes("memory", m.keys().capacity() * sizeof(int) + m.values().capacity() * sizeof(int), m.size());
+		srand(2);
+		t = ft_bench::now();
+		for (int i = 0; i < lookups; i++)
+			sum += m.count(rand());
+		ft_bench::report("lookup 1M random", ft_bench::now() - t);
+		t = ft_bench::now();
+		for (ft::flat_map<int, int>::iterator it = m.begin(); it != m.end(); ++it)
+			sum += it->second;
+		ft_bench::report("scan", ft_bench::now() - t);
+	}
+	ft_bench::keep(sum);
+	return 0;
+}
@@ -0,0 +1,51 @@
+#include <stdlib.h>
+#include "set.hpp"
+#include "flat_set.hpp"
+#include "frozen_set.hpp"
+#include "bench.hpp"
+
+//main.cpp의 set count 반복처럼 임의의 rand() 값으로 찾는다. 대부분은 없는 키다.
+template <class S>
+static double
+probe(const S &s, int lookups, long &sum)
+{
+	srand(2);
+	double t = ft_bench::now();
+	for (int i = 0; i < lookups; i++)
+		sum += s.count(rand());
+	return ft_bench::now() - t;
+}
+
+static void
+run(int n)
+{
+	const int lookups = 2000000;
+	ft::set<int> s;
+	long sum = 0;
+	double t;
+
+	std::cout << "-- " << n << " keys, " << lookups << " probes" << std::endl;
+	srand(1);
+	for (int i = 0; i < n; i++)
+		s.insert(rand());
+	t = ft_bench::now();
+	ft::frozen_set<int> f(s);
+	ft_bench::report("freeze (O(n) from ft::set)", ft_bench::now() - t);
+	ft::flat_set<int> flat(s.begin(), s.end());
+
+	double base = probe(s, lookups, sum);
+	ft_bench::report("ft::set count", base);
+	double sorted = probe(flat, lookups, sum);
+	ft_bench::report("ft::flat_set count (binary search)", sorted);
+	double eytz = probe(f, lookups, sum);
+	ft_bench::report("ft::frozen_set count (Eytzinger)", eytz);
+	std::cout << "speedup over ft::set: " << base / eytz << "x" << std::endl;
+	ft_bench::keep(sum);
+}
+
+int main(void)
+{
+	run(1000000);
+	run(10000000);
+	return 0;
+}
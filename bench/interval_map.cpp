@@ -0,0 +1,79 @@
+#include <stdlib.h>
+#include <vector>
+#include "interval_map.hpp"
+#include "bench.hpp"
+
+//구간 10^6개. 점 하나를 덮는 구간(stabbing)과 짧은 구간에 겹치는 구간을 찾는다.
+//비교 대상은 같은 구간을 담은 배열을 처음부터 끝까지 훑는 것.
+#define COUNT 1000000
+#define SPAN 100000000
+#define QUERIES 1000
+
+typedef ft::interval_map<int, int>	imap_t;
+
+//찾은 개수만 센다.
+struct counter
+{
+	size_t	*n;
+
+	counter	&operator*(void) { return *this; }
+	counter	&operator++(void) { return *this; }
+	counter	operator++(int) { return *this; }
+	template <class It>
+	counter	&operator=(const It &) { ++*n; return *this; }
+};
+
+int main(void)
+{
+	std::vector<std::pair<int, int> > spans;
+	std::vector<int> points;
+	imap_t m;
+	size_t found = 0;
+	double t;
+
+	srand(1);
+	for (int i = 0; i < COUNT; i++)
+	{
+		int lo = rand() % SPAN;
+		//대부분은 짧고 가끔 긴 구간이 섞인다.
+		int len = rand() % 16 ? rand() % 1000 : rand() % 1000000;
+		spans.push_back(std::make_pair(lo, lo + len));
+	}
+	for (int i = 0; i < QUERIES; i++)
+		points.push_back(rand() % SPAN);
+
+	t = ft_bench::now();
+	for (size_t i = 0; i < spans.size(); i++)
+		m.insert(spans[i].first, spans[i].second, static_cast<int>(i));
+	ft_bench::report("build 1M intervals", ft_bench::now() - t);
+
+	std::cout << "-- stabbing, 1000 points" << std::endl;
+	t = ft_bench::now();
+	for (int q = 0; q < QUERIES; q++)
+	{
+		counter c = {&found};
+		m.find_stabbing(points[q], c);
+	}
+	ft_bench::report("interval_map", ft_bench::now() - t);
+	t = ft_bench::now();
+	for (int q = 0; q < QUERIES; q++)
+		for (size_t i = 0; i < spans.size(); i++)
+			found += spans[i].first <= points[q] && points[q] <= spans[i].second;
+	ft_bench::report("linear scan", ft_bench::now() - t);
+
+	std::cout << "-- overlaps with [p, p + 10000], 1000 queries" << std::endl;
+	t = ft_bench::now();
+	for (int q = 0; q < QUERIES; q++)
+	{
+		counter c = {&found};
+		m.find_overlaps(points[q], points[q] + 10000, c);
+	}
+	ft_bench::report("interval_map", ft_bench::now() - t);
+	t = ft_bench::now();
+	for (int q = 0; q < QUERIES; q++)
+		for (size_t i = 0; i < spans.size(); i++)
+			found += spans[i].first <= points[q] + 10000 && points[q] <= spans[i].second;
+	ft_bench::report("linear scan", ft_bench::now() - t);
+	ft_bench::keep(found);
+	return 0;
+}
@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <list>
+#include <stdlib.h>
+#include <vector>
+#include "map.hpp"
+#include "lru_map.hpp"
+#include "bench.hpp"
+
+//키 10^6개, Zipf(theta 0.9) 분포로 get하고 없으면 put하기를 5*10^6번.
+//비교 대상은 ft::map<int, std::list::iterator>와 std::list로 사용 순서를 따로 두는 흔한 구현.
+#define COUNT 1000000
+#define OPS 5000000
+
+typedef std::list<ft::pair<int, int> >	order_t;
+
+//흔한 LRU 캐시: 목록 앞이 가장 최근이고, map은 키에서 목록 칸으로 간다.
+struct list_lru
+{
+	ft::map<int, order_t::iterator>	index;
+	order_t							order;
+	size_t							capacity;
+	size_t							hits;
+	size_t							evictions;
+
+	explicit list_lru(size_t cap) : capacity(cap), hits(0), evictions(0) {}
+
+	void
+	touch(int k)
+	{
+		ft::map<int, order_t::iterator>::iterator it = index.find(k);
+
+		if (it != index.end())
+		{
+			++hits;
+			order.splice(order.begin(), order, it->second);
+			return ;
+		}
+		order.push_front(ft::make_pair(k, k));
+		index.insert(ft::make_pair(k, order.begin()));
+		if (order.size() > capacity)
+		{
+			index.erase(order.back().first);
+			order.pop_back();
+			++evictions;
+		}
+	}
+};
+
+static void
+zipf(double theta, std::vector<int> &out)
+{
+	std::vector<int> keys;
+	std::vector<double> cdf(COUNT);
+	double total = 0;
+
+	for (int i = 0; i < COUNT; i++)
+		keys.push_back(i);
+	std::random_shuffle(keys.begin(), keys.end());
+	for (int r = 0; r < COUNT; r++)
+	{
+		total += 1.0 / std::pow(static_cast<double>(r + 1), theta);
+		cdf[r] = total;
+	}
+	for (int i = 0; i < OPS; i++)
+	{
+		double u = (static_cast<double>(rand()) / RAND_MAX) * total;
+		size_t r = std::lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+		out.push_back(keys[r < keys.size() ? r : keys.size() - 1]);
+	}
+}
+
+int main(void)
+{
+	size_t caps[] = {10000, 100000};
+	std::vector<int> ops;
+	char what[64];
+	double t;
+
+	srand(1);
+	zipf(0.9, ops);
+	for (size_t c = 0; c < sizeof(caps) / sizeof(caps[0]); c++)
+	{
+		std::cout << "-- capacity " << caps[c] << std::endl;
+		{
+			list_lru l(caps[c]);
+			t = ft_bench::now();
+			for (size_t i = 0; i < ops.size(); i++)
+				l.touch(ops[i]);
+			std::sprintf(what, "map+list (hits %lu, evictions %lu)",
+				static_cast<unsigned long>(l.hits), static_cast<unsigned long>(l.evictions));
+			ft_bench::report(what, ft_bench::now() - t);
+		}
+		{
+			ft::lru_map<int, int> m(caps[c]);
+			t = ft_bench::now();
+			for (size_t i = 0; i < ops.size(); i++)
+				if (m.get(ops[i]) == m.end())
+					m.put(ops[i], ops[i]);
+			std::sprintf(what, "lru_map (hits %lu, evictions %lu)",
+				static_cast<unsigned long>(m.hits()), static_cast<unsigned long>(m.evictions()));
+			ft_bench::report(what, ft_bench::now() - t);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,86 @@
+#include <stdlib.h>
+#include <vector>
+#include "persistent_map.hpp"
+#include "bench.hpp"
+
+//쓰기가 이어지는 동안 보고용 판을 떠 두는 경우. 지금은 ft::map 복사로 판을 뜬다.
+#define COUNT 1000000
+#define UPDATES 1000000
+#define VERSIONS 100
+
+typedef ft_bench::counting_allocator<ft::pair<const int, int> >	alloc_t;
+typedef ft::map<int, int, std::less<int>, alloc_t>				map_t;
+typedef ft::persistent_map<int, int, std::less<int>, alloc_t>	pmap_t;
+
+int main(void)
+{
+	ft::vector<int> keys;
+	long sum = 0;
+	double t;
+
+	srand(40);
+	for (int i = 0; i < UPDATES; i++)
+		keys.push_back(rand() % COUNT);
+
+	map_t m;
+	for (int k = 0; k < COUNT; k++)
+		m[k] = k;
+	size_t base = ft_bench::live_bytes();
+	pmap_t p(m);
+	size_t pbase = ft_bench::live_bytes() - base;
+	std::cout << "-- " << COUNT << " keys" << std::endl;
+	ft_bench::report_bytes("ft::map", base, COUNT);
+	ft_bench::report_bytes("persistent_map", pbase, COUNT);
+
+	//판 하나 뜨기.
+	t = ft_bench::now();
+	{
+		map_t copy(m);
+		ft_bench::keep(copy);
+	}
+	ft_bench::report("snapshot, ft::map copy", ft_bench::now() - t);
+	t = ft_bench::now();
+	for (int i = 0; i < 1000; i++)
+	{
+		pmap_t snap = p.snapshot();
+		ft_bench::keep(snap);
+	}
+	ft_bench::report("snapshot, persistent_map x1000", ft_bench::now() - t);
+
+	//값 바꾸기와 찾기.
+	t = ft_bench::now();
+	for (int i = 0; i < UPDATES; i++)
+		m[keys[i]] = i;
+	ft_bench::report("update, ft::map operator[]", ft_bench::now() - t);
+	t = ft_bench::now();
+	for (int i = 0; i < UPDATES; i++)
+		p.insert_or_assign(keys[i], i);
+	ft_bench::report("update, persistent_map insert_or_assign", ft_bench::now() - t);
+	t = ft_bench::now();
+	for (int i = 0; i < UPDATES; i++)
+		sum += m.find(keys[i])->second;
+	ft_bench::report("find, ft::map", ft_bench::now() - t);
+	t = ft_bench::now();
+	for (int i = 0; i < UPDATES; i++)
+		sum += p.find(keys[i])->second;
+	ft_bench::report("find, persistent_map", ft_bench::now() - t);
+
+	//판을 남겨 두며 쓰기를 이어 간다. 남은 판 하나가 더 잡는 메모리는 그 사이에 바뀐 경로뿐이다.
+	int per_version[] = {1, 100, 10000};
+	for (size_t w = 0; w < sizeof(per_version) / sizeof(per_version[0]); w++)
+	{
+		std::vector<pmap_t> kept;
+		size_t before = ft_bench::live_bytes();
+		for (int v = 0; v < VERSIONS; v++)
+		{
+			kept.push_back(p.snapshot());
+			for (int i = 0; i < per_version[w]; i++)
+				p.insert_or_assign(keys[(v * per_version[w] + i) % UPDATES], v);
+		}
+		std::cout << VERSIONS << " versions, " << per_version[w] << " writes apart: "
+			<< (ft_bench::live_bytes() - before) / VERSIONS << " B/version (ft::map copy: "
+			<< base << " B)" << std::endl;
+	}
+	ft_bench::keep(sum);
+	return 0;
+}
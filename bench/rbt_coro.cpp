@@ -0,0 +1,76 @@
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include "rbt_coro.hpp"
+#include "rbt.hpp"
+#include "bench.hpp"
+
+//rbt_coro_test.cpp와 같은 C++98 모양의 할당자.
+template <class T>
+struct legacy_allocator
+{
+	typedef T			value_type;
+	typedef T*			pointer;
+	typedef const T*	const_pointer;
+	typedef T&			reference;
+	typedef const T&	const_reference;
+	typedef std::size_t	size_type;
+
+	template <class U>
+	struct rebind { typedef legacy_allocator<U> other; };
+
+	legacy_allocator(void) {}
+	template <class U>
+	legacy_allocator(const legacy_allocator<U> &) {}
+
+	T *allocate(std::size_t n) { return static_cast<T *>(::operator new(n * sizeof(T))); }
+	void deallocate(T *p, std::size_t) { ::operator delete(p); }
+	void construct(T *p, const T &v) { new (p) T(v); }
+	void destroy(T *p) { p->~T(); }
+	std::size_t max_size(void) const { return static_cast<std::size_t>(-1) / sizeof(T); }
+};
+
+typedef ft::rbt<int, std::less<int>, legacy_allocator<int> >	tree_t;
+
+//노드 40B x 16M = 약 640MB. 이 머신의 LLC(300MB)보다 크다.
+#define COUNT 16000000
+
+int main(void)
+{
+	const int lookups = 2000000;
+	std::size_t widths[] = {1, 4, 8, 16, 32, 64};
+	tree_t tree;
+	long sum = 0;
+	double t;
+
+	std::srand(1);
+	for (int i = 0; i < COUNT; i++)
+		tree.insert(std::rand());
+	std::cout << "-- " << tree.size() << " keys, " << lookups << " lookups" << std::endl;
+
+	std::srand(2);
+	t = ft_bench::now();
+	for (int i = 0; i < lookups; i++)
+		sum += tree.find(std::rand()) != tree.end();
+	ft_bench::report("find", ft_bench::now() - t);
+
+	tree_t::node *end = tree.end();
+	for (std::size_t w = 0; w < sizeof(widths) / sizeof(widths[0]); w++)
+	{
+		ft::coro::lookup_scheduler<tree_t::node> sched(widths[w]);
+		std::srand(2);
+		t = ft_bench::now();
+		//이벤트 루프처럼 조금씩 넣고 한 번씩 돌린다.
+		for (int i = 0; i < lookups; i++)
+		{
+			sched.submit(ft::coro::find(tree, std::rand()), [&sum, end](tree_t::node *n) { sum += n != end; });
+			if (sched.pending() >= widths[w])
+				sched.poll();
+		}
+		sched.run();
+		std::cout << "scheduler width " << widths[w];
+		ft_bench::report("", ft_bench::now() - t);
+	}
+	ft_bench::keep(sum);
+	return 0;
+}
@@ -0,0 +1,171 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "rcu_map.hpp"
+#include "bench.hpp"
+
+//설정 표처럼 자주 읽고 가끔 바꾸는 맵. 쓰는 스레드가 계속 도는 동안 읽는 스레드 수를 늘린다.
+#define KEYS 100000
+#define READS 2000000
+
+typedef ft::rcu_map<int, int>	rcu_t;
+
+//비교용: 읽기/쓰기 잠금 하나로 감싼 ft::map.
+struct rwlock_map
+{
+	pthread_rwlock_t	lock;
+	ft::map<int, int>	map;
+
+	rwlock_map(void) { pthread_rwlock_init(&lock, NULL); }
+	~rwlock_map() { pthread_rwlock_destroy(&lock); }
+
+	bool
+	find(int k, int &out)
+	{
+		pthread_rwlock_rdlock(&lock);
+		ft::map<int, int>::iterator it = map.find(k);
+		bool found = it != map.end();
+		if (found)
+			out = it->second;
+		pthread_rwlock_unlock(&lock);
+		return found;
+	}
+
+	void
+	set(int k, int v)
+	{
+		pthread_rwlock_wrlock(&lock);
+		map[k] = v;
+		pthread_rwlock_unlock(&lock);
+	}
+};
+
+struct Set
+{
+	int	k;
+	int	v;
+
+	void	operator()(ft::map<int, int> &m) const { m[k] = v; }
+};
+
+static void
+set(rcu_t &m, int k, int v)
+{
+	Set s = {k, v};
+	m.update(s);
+}
+
+static void
+set(rwlock_map &m, int k, int v)
+{ m.set(k, v); }
+
+template <class M>
+struct job
+{
+	M				*map;
+	int				reads;
+	unsigned int	seed;
+	long			hits;
+	volatile int	*stop;
+	long			writes;
+};
+
+template <class M>
+static void *
+reader(void *arg)
+{
+	job<M> *j = static_cast<job<M> *>(arg);
+	int v;
+
+	for (int i = 0; i < j->reads; i++)
+		j->hits += j->map->find(rand_r(&j->seed) % KEYS, v);
+	return NULL;
+}
+
+//스냅샷 하나로 64번씩 읽는다. 세대 진입 값을 나눠 낸다.
+static void *
+snapshot_reader(void *arg)
+{
+	job<rcu_t> *j = static_cast<job<rcu_t> *>(arg);
+
+	for (int i = 0; i < j->reads; i += 64)
+	{
+		rcu_t::snapshot snap = j->map->read();
+		for (int n = 0; n < 64; n++)
+			j->hits += snap->count(rand_r(&j->seed) % KEYS);
+	}
+	return NULL;
+}
+
+//읽기가 끝날 때까지 20ms마다 키 하나를 바꾼다. (분에 몇 번 수준보다 훨씬 잦다)
+template <class M>
+static void *
+writer(void *arg)
+{
+	job<M> *j = static_cast<job<M> *>(arg);
+
+	while (!__sync_fetch_and_add(j->stop, 0))
+	{
+		set(*j->map, rand_r(&j->seed) % KEYS, static_cast<int>(j->writes));
+		++j->writes;
+		usleep(20000);
+	}
+	return NULL;
+}
+
+template <class M>
+static void
+run(M &m, const char *name, int readers, void *(*read_fn)(void *) = reader<M>)
+{
+	pthread_t th[65];
+	job<M> jobs[65];
+	volatile int stop = 0;
+	double t = ft_bench::now();
+
+	for (int i = 0; i <= readers; i++)
+	{
+		job<M> j = {&m, READS / readers, static_cast<unsigned int>(i + 1), 0, &stop, 0};
+		jobs[i] = j;
+	}
+	pthread_create(&th[readers], NULL, writer<M>, &jobs[readers]);
+	for (int i = 0; i < readers; i++)
+		pthread_create(&th[i], NULL, read_fn, &jobs[i]);
+	for (int i = 0; i < readers; i++)
+		pthread_join(th[i], NULL);
+	double elapsed = ft_bench::now() - t;
+	__sync_lock_test_and_set(&stop, 1);
+	pthread_join(th[readers], NULL);
+	std::cout << name << " readers x" << readers << ": " << READS / elapsed / 1e6 << " M reads/s ("
+		<< jobs[readers].writes << " writes)" << std::endl;
+}
+
+int main(void)
+{
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	int max_readers = cpus < 8 ? 8 : static_cast<int>(cpus < 64 ? cpus : 64);
+	ft::map<int, int> init;
+	rwlock_map locked;
+
+	for (int k = 0; k < KEYS; k++)
+		init[k] = k;
+	rcu_t rcu(init);
+	locked.map = init;
+	//쓰기 한 번의 값: rcu_map은 판 전체를 복사한다.
+	double t = ft_bench::now();
+	for (int i = 0; i < 20; i++)
+		set(rcu, i, i);
+	ft_bench::report("rcu_map update (per write)", (ft_bench::now() - t) / 20);
+	t = ft_bench::now();
+	for (int i = 0; i < 20; i++)
+		set(locked, i, i);
+	ft_bench::report("rwlock+ft::map write (per write)", (ft_bench::now() - t) / 20);
+	std::cout << "-- " << KEYS << " keys, " << READS << " reads, " << cpus << " CPUs" << std::endl;
+	for (int readers = 1; readers <= max_readers; readers *= 2)
+	{
+		run(locked, "rwlock+ft::map", readers);
+		run(rcu, "rcu_map       ", readers);
+		run(rcu, "rcu_map read()", readers, snapshot_reader);
+	}
+	ft::epoch::synchronize();
+	return 0;
+}
@@ -0,0 +1,130 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "map.hpp"
+#include "skiplist_map.hpp"
+#include "bench.hpp"
+
+//전체 작업량을 스레드 수로 나눠 돌린다. 시간이 줄면 그만큼 처리량이 는 것이다.
+#define KEYS 1000000
+#define OPS 4000000
+
+//뮤텍스 하나로 감싼 ft::map.
+struct locked_map
+{
+	pthread_mutex_t		lock;
+	ft::map<int, int>	map;
+
+	locked_map(void) { pthread_mutex_init(&lock, NULL); }
+	~locked_map() { pthread_mutex_destroy(&lock); }
+
+	bool
+	find(int k)
+	{
+		pthread_mutex_lock(&lock);
+		bool found = map.find(k) != map.end();
+		pthread_mutex_unlock(&lock);
+		return found;
+	}
+
+	void
+	insert(int k)
+	{
+		pthread_mutex_lock(&lock);
+		map.insert(ft::make_pair(k, k));
+		pthread_mutex_unlock(&lock);
+	}
+
+	void
+	erase(int k)
+	{
+		pthread_mutex_lock(&lock);
+		map.erase(k);
+		pthread_mutex_unlock(&lock);
+	}
+};
+
+struct lockfree_map
+{
+	ft::skiplist_map<int, int>	map;
+
+	bool	find(int k) { return map.count(k) != 0; }
+	void	insert(int k) { map.insert(ft::make_pair(k, k)); }
+	void	erase(int k) { map.erase(k); }
+};
+
+template <class M>
+struct job
+{
+	M				*map;
+	int				ops;
+	int				write_pct;
+	unsigned int	seed;
+	long			hits;
+};
+
+//쓰기는 넣기와 지우기를 반씩 해서 크기가 그대로 유지된다.
+template <class M>
+static void *
+worker(void *arg)
+{
+	job<M> *j = static_cast<job<M> *>(arg);
+
+	for (int i = 0; i < j->ops; i++)
+	{
+		int k = rand_r(&j->seed) % KEYS;
+		if (static_cast<int>(rand_r(&j->seed) % 100) < j->write_pct)
+		{
+			if (k & 1)
+				j->map->insert(k);
+			else
+				j->map->erase(k);
+		}
+		else
+			j->hits += j->map->find(k);
+	}
+	return NULL;
+}
+
+template <class M>
+static void
+run(M &m, const char *name, int threads, int write_pct)
+{
+	pthread_t th[64];
+	job<M> jobs[64];
+	double t = ft_bench::now();
+
+	for (int i = 0; i < threads; i++)
+	{
+		job<M> j = {&m, OPS / threads, write_pct, static_cast<unsigned int>(i + 1), 0};
+		jobs[i] = j;
+		pthread_create(&th[i], NULL, worker<M>, &jobs[i]);
+	}
+	for (int i = 0; i < threads; i++)
+		pthread_join(th[i], NULL);
+	std::cout << name << " " << (100 - write_pct) << "/" << write_pct << " x" << threads;
+	ft_bench::report("", ft_bench::now() - t);
+}
+
+int main(void)
+{
+	int mixes[] = {5, 50};
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	int max_threads = cpus < 8 ? 8 : static_cast<int>(cpus < 64 ? cpus : 64);
+	locked_map locked;
+	lockfree_map lockfree;
+
+	for (int k = 0; k < KEYS; k += 2)
+	{
+		locked.insert(k);
+		lockfree.insert(k);
+	}
+	std::cout << "-- " << OPS << " ops over " << KEYS << " keys, " << cpus << " CPUs" << std::endl;
+	for (int m = 0; m < 2; m++)
+		for (int threads = 1; threads <= max_threads; threads *= 2)
+		{
+			run(locked, "mutex+ft::map", threads, mixes[m]);
+			run(lockfree, "skiplist_map ", threads, mixes[m]);
+		}
+	return 0;
+}
@@ -0,0 +1,68 @@
+#include <stdlib.h>
+#include "vector.hpp"
+#include "soa_vector.hpp"
+#include "bench.hpp"
+
+//main.cpp의 vector 부분: 4 KB짜리 Buffer를 채우고 idx만 건드린다.
+//main.cpp는 4 GB를 채우지만 여기서는 200000개(약 800 MB)로 줄였다.
+#define BUFFER_SIZE 4096
+#define COUNT 200000
+#define SCANS 10
+
+struct Buffer
+{
+	int idx;
+	char buff[BUFFER_SIZE];
+};
+
+struct Payload
+{
+	char buff[BUFFER_SIZE];
+};
+
+int main(void)
+{
+	double t;
+	long sum = 0;
+
+	std::cout << "-- ft::vector<Buffer>" << std::endl;
+	{
+		ft::vector<Buffer> v;
+		t = ft_bench::now();
+		for (int i = 0; i < COUNT; i++)
+			v.push_back(Buffer());
+		ft_bench::report("push_back 200k", ft_bench::now() - t);
+		srand(1);
+		t = ft_bench::now();
+		for (int i = 0; i < COUNT; i++)
+			v[rand() % COUNT].idx = 5;
+		ft_bench::report("idx = 5 at 200k random rows", ft_bench::now() - t);
+		t = ft_bench::now();
+		for (int s = 0; s < SCANS; s++)
+			for (size_t i = 0; i < v.size(); i++)
+				sum += v[i].idx;
+		ft_bench::report("scan idx x10", ft_bench::now() - t);
+	}
+
+	std::cout << "-- ft::soa_vector<int, Payload>" << std::endl;
+	{
+		ft::soa_vector<int, Payload> v;
+		t = ft_bench::now();
+		for (int i = 0; i < COUNT; i++)
+			v.push_back(0, Payload());
+		ft_bench::report("push_back 200k", ft_bench::now() - t);
+		srand(1);
+		t = ft_bench::now();
+		int *idx = v.column<0>();
+		for (int i = 0; i < COUNT; i++)
+			idx[rand() % COUNT] = 5;
+		ft_bench::report("idx = 5 at 200k random rows", ft_bench::now() - t);
+		t = ft_bench::now();
+		for (int s = 0; s < SCANS; s++)
+			for (size_t i = 0; i < v.size(); i++)
+				sum += idx[i];
+		ft_bench::report("scan idx x10", ft_bench::now() - t);
+	}
+	ft_bench::keep(sum);
+	return 0;
+}
@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <stdlib.h>
+#include <vector>
+#include "map.hpp"
+#include "bench.hpp"
+
+//키 10^6개, Zipf 분포로 치우친 조회 5*10^6번. 레드블랙과 splay_balance를 비교한다.
+//splay는 non-const find로 찾아야 찾은 키를 루트로 올린다. const find는 모양을 그대로 둔다.
+#define COUNT 1000000
+#define LOOKUPS 5000000
+
+typedef ft::map<int, int>	rb_t;
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::__no_monoid, ft::splay_balance>	splay_t;
+
+//순위 r(0부터)가 뽑힐 확률은 1/(r+1)^theta에 비례한다. 순위와 키의 대응은 섞어 둔다.
+static void
+zipf(double theta, const std::vector<int> &keys, std::vector<int> &out)
+{
+	std::vector<double> cdf(keys.size());
+	double total = 0;
+
+	for (size_t r = 0; r < keys.size(); r++)
+	{
+		total += 1.0 / std::pow(static_cast<double>(r + 1), theta);
+		cdf[r] = total;
+	}
+	out.clear();
+	for (int i = 0; i < LOOKUPS; i++)
+	{
+		double u = (static_cast<double>(rand()) / RAND_MAX) * total;
+		size_t r = std::lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+		out.push_back(keys[r < keys.size() ? r : keys.size() - 1]);
+	}
+}
+
+template <class M>
+static void
+run(const char *name, double theta, const std::vector<int> &keys, const std::vector<int> &lookups)
+{
+	M m;
+	const M &cm = m;
+	long sum = 0;
+	char what[64];
+
+	for (size_t i = 0; i < keys.size(); i++)
+		m.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+	double t = ft_bench::now();
+	for (size_t i = 0; i < lookups.size(); i++)
+		sum += cm.find(lookups[i])->second;
+	std::sprintf(what, "theta %.2f %s const find", theta, name);
+	ft_bench::report(what, ft_bench::now() - t);
+	t = ft_bench::now();
+	for (size_t i = 0; i < lookups.size(); i++)
+		sum += m.find(lookups[i])->second;
+	std::sprintf(what, "theta %.2f %s find", theta, name);
+	ft_bench::report(what, ft_bench::now() - t);
+	ft_bench::keep(sum);
+}
+
+int main(void)
+{
+	double thetas[] = {0.99, 1.2, 1.5};
+	std::vector<int> keys;
+	std::vector<int> lookups;
+
+	srand(1);
+	for (int i = 0; i < COUNT; i++)
+		keys.push_back(i);
+	std::random_shuffle(keys.begin(), keys.end());
+	for (size_t i = 0; i < sizeof(thetas) / sizeof(thetas[0]); i++)
+	{
+		zipf(thetas[i], keys, lookups);
+		run<rb_t>("red-black", thetas[i], keys, lookups);
+		run<splay_t>("splay", thetas[i], keys, lookups);
+	}
+	return 0;
+}
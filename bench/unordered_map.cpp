@@ -0,0 +1,53 @@
+#include <stdlib.h>
+#include <tr1/unordered_map>
+#include "map.hpp"
+#include "unordered_map.hpp"
+#include "bench.hpp"
+
+//main.cpp의 map 부분: rand() 키로 채우고, rand() 키로 operator[] 하고, count로 있는지 본다.
+//operator[]는 없는 키를 넣으므로 main.cpp처럼 크기가 늘어난다.
+//std::unordered_map은 C++11이라 같은 구현인 std::tr1::unordered_map과 비교한다.
+#define COUNT 1000000
+
+typedef ft::pair<const int, int>	value_t;
+typedef ft::map<int, int, std::less<int>, ft_bench::counting_allocator<value_t> >	map_t;
+typedef ft::unordered_map<int, int, ft::hash<int>, std::equal_to<int>, ft_bench::counting_allocator<value_t> >	umap_t;
+typedef std::tr1::unordered_map<int, int, std::tr1::hash<int>, std::equal_to<int>,
+	ft_bench::counting_allocator<std::pair<const int, int> > >	std_umap_t;
+
+template <class M>
+static void
+run(const char *name)
+{
+	double t;
+	long sum = 0;
+
+	std::cout << "-- " << name << std::endl;
+	ft_bench::live_bytes() = 0;
+	{
+		M m;
+		srand(1);
+		t = ft_bench::now();
+		for (int i = 0; i < COUNT; i++)
+			m.insert(typename M::value_type(rand(), rand()));
+		ft_bench::report("insert 1M random", ft_bench::now() - t);
+		ft_bench::report_bytes("memory", ft_bench::live_bytes(), m.size());
+		t = ft_bench::now();
+		for (int i = 0; i < COUNT; i++)
+			sum += m[rand()];
+		ft_bench::report("operator[] 1M random", ft_bench::now() - t);
+		t = ft_bench::now();
+		for (int i = 0; i < COUNT; i++)
+			sum += m.count(rand());
+		ft_bench::report("count 1M random", ft_bench::now() - t);
+	}
+	ft_bench::keep(sum);
+}
+
+int main(void)
+{
+	run<map_t>("ft::map");
+	run<umap_t>("ft::unordered_map");
+	run<std_umap_t>("std::tr1::unordered_map");
+	return 0;
+}
@@ -0,0 +1,133 @@
+#ifndef BLOOM_FILTER_CLASS_HPP
+# define BLOOM_FILTER_CLASS_HPP
+
+# include <functional>
+# include "hash.hpp"
+# include "vector.hpp"
+
+namespace ft
+{
+//ft::hash<T>가 특수화되어 있는지. (정의되지 않은 hash<T>는 sizeof가 실패한다)
+template <class T>
+struct is_hashable
+{
+private:
+	template <class U>
+	static char	__test(int (*)[sizeof(ft::hash<U>)]);
+	template <class U>
+	static long	__test(...);
+
+public:
+	static const bool	value = sizeof(__test<T>(0)) == 1;
+};
+
+//필터가 "없다"고 답하려면 Compare로 같은 키가 같은 해시를 가져야 한다.
+//ft::hash는 == 기준이라 std::less<Key>로 정렬된 컨테이너에서만 믿을 수 있다.
+template <class Key, class Compare>
+struct __filter_usable
+{
+	static const bool	value = ft::is_hashable<Key>::value && ft::is_same<Compare, std::less<Key> >::value;
+};
+
+//필터를 쓸 수 없는 map/set에서 enable_filter를 부르면 여기서 컴파일이 멈춘다.
+template <bool Usable>
+struct __filter_needs_hash_and_std_less;
+
+template <>
+struct __filter_needs_hash_and_std_less<true> {};
+
+//블록 블룸 필터. 키 하나는 512비트(8워드) 블록 하나에만 들어가고, 각 워드에 한 비트씩 8비트를 켠다.
+//조회 한 번에 캐시라인 하나만 읽는다. 없다고 하면 확실히 없고, 있다고 하면 아마 있다.
+//지운 키의 비트는 끌 수 없으므로 stale()이 쌓이면 컨테이너가 다시 만든다.
+template <class Key, class Hash = ft::hash<Key>, bool Enabled = ft::is_hashable<Key>::value>
+class bloom_filter
+{
+private:
+	enum { block_words = 8 };
+
+	ft::vector<unsigned long long>	_bits;
+	size_t							_block_mask;
+	size_t							_bits_per_key;
+	size_t							_capacity;
+	size_t							_stale;
+	Hash							_hash;
+
+	//해시의 위쪽 32비트로 블록을 고른다.
+	size_t
+	__block(unsigned long long h) const
+	{ return static_cast<size_t>((h >> 32) & _block_mask) * block_words; }
+
+	//각 워드에서 켤 비트. 해시를 한 번 더 섞어 6비트씩 잘라 쓴다.
+	static unsigned long long
+	__bit(unsigned long long pattern, int word)
+	{ return 1ULL << ((pattern >> (6 * word)) & 63); }
+
+public:
+	explicit bloom_filter(size_t bits_per_key_ = 10)
+	: _block_mask(0), _bits_per_key(bits_per_key_ == 0 ? 1 : bits_per_key_), _capacity(0), _stale(0)
+	{ this->reset(0); }
+
+	//키 n개를 넣을 크기로 비우고 다시 잡는다.
+	void
+	reset(size_t n)
+	{
+		size_t blocks = 1;
+
+		while (blocks * block_words * 64 < n * _bits_per_key)
+			blocks *= 2;
+		_bits.assign(blocks * block_words, 0ULL);
+		_block_mask = blocks - 1;
+		_capacity = n;
+		_stale = 0;
+	}
+
+	void
+	insert(const Key &k)
+	{
+		unsigned long long h = _hash(k);
+		unsigned long long pattern = ft::__hash_mix(h);
+		unsigned long long *b = _bits.data() + this->__block(h);
+
+		for (int i = 0; i < block_words; i++)
+			b[i] |= __bit(pattern, i);
+	}
+
+	bool
+	may_contain(const Key &k) const
+	{
+		unsigned long long h = _hash(k);
+		unsigned long long pattern = ft::__hash_mix(h);
+		const unsigned long long *b = _bits.data() + this->__block(h);
+		unsigned long long miss = 0;
+
+		for (int i = 0; i < block_words; i++)
+			miss |= __bit(pattern, i) & ~b[i];
+		return miss == 0;
+	}
+
+	//지웠지만 비트가 남아 있는 키의 수.
+	void	note_erase(size_t n) { _stale += n; }
+	size_t	stale(void) const { return _stale; }
+	size_t	capacity(void) const { return _capacity; }
+	size_t	bits_per_key(void) const { return _bits_per_key; }
+};
+
+//해시가 없거나 Compare가 std::less가 아닌 키. enable_filter가 막히므로 실제로 만들어지지 않는다.
+template <class Key, class Hash>
+class bloom_filter<Key, Hash, false>
+{
+public:
+	explicit bloom_filter(size_t = 10) {}
+
+	void	reset(size_t) {}
+	void	insert(const Key &) {}
+	bool	may_contain(const Key &) const { return true; }
+	void	note_erase(size_t) {}
+	size_t	stale(void) const { return 0; }
+	size_t	capacity(void) const { return 0; }
+	size_t	bits_per_key(void) const { return 0; }
+};
+
+}
+
+#endif
@@ -0,0 +1,118 @@
+#include <map>
+#include <set>
+#include <string>
+#include <pthread.h>
+#include <stdlib.h>
+#include "map.hpp"
+#include "set.hpp"
+#include "tester.hpp"
+
+//절댓값으로 비교한다. -3과 3이 같은 키인데 ft::hash는 다르게 보므로 필터를 켤 수 없어야 한다.
+struct AbsLess
+{
+	bool	operator()(int a, int b) const { return (a < 0 ? -a : a) < (b < 0 ? -b : b); }
+};
+
+static const ft::map<int, int>	*g_shared;
+static int						g_miscount;
+
+//필터가 켜진 map을 여러 스레드가 const로만 읽는다. (TSan으로 돌리면 경쟁이 없어야 한다)
+static void *
+reader(void *arg)
+{
+	long seed = reinterpret_cast<long>(arg);
+	int bad = 0;
+
+	for (int i = 0; i < 20000; i++)
+	{
+		int k = static_cast<int>((seed * 7919 + i * 104729L) % 40000);
+		if (g_shared->count(k) != static_cast<size_t>(k % 2 == 0 && k < 20000))
+			++bad;
+	}
+	__sync_fetch_and_add(&g_miscount, bad);
+	return NULL;
+}
+
+int main(void)
+{
+	srand(21);
+	FT_CHECK((ft::__filter_usable<int, std::less<int> >::value));
+	FT_CHECK((ft::__filter_usable<std::string, std::less<std::string> >::value));
+	FT_CHECK(!(ft::__filter_usable<int, AbsLess>::value));
+	FT_CHECK(!(ft::__filter_usable<int, std::greater<int> >::value));
+	FT_CHECK(!(ft::__filter_usable<ft::pair<int, int>, std::less<ft::pair<int, int> > >::value));
+
+	//필터를 켤 수 없는 타입도 복사와 대입은 된다. 조회는 Compare를 그대로 따른다.
+	ft::set<int, AbsLess> abs;
+	abs.insert(3);
+	ft::set<int, AbsLess> abs_copy(abs);
+	abs_copy = abs;
+	FT_CHECK(!abs_copy.filter_enabled() && abs_copy.count(-3) == 1);
+
+	//섞인 삽입, 삭제, 조회 동안 필터가 있는 것을 없다고 하면 안 된다.
+	ft::set<int> s;
+	ft::map<int, int> m;
+	std::set<int> ref;
+	s.enable_filter();
+	m.enable_filter(16);
+	FT_CHECK(s.filter_enabled() && m.filter_enabled());
+	for (int i = 0; i < 200000; i++)
+	{
+		int k = rand() % 30000;
+		int op = rand() % 3;
+		if (op == 0)
+		{
+			size_t n = ref.erase(k);
+			FT_CHECK(s.erase(k) == n && m.erase(k) == n);
+		}
+		else if (op == 1)
+		{
+			ref.insert(k);
+			s.insert(k);
+			m[k] = k;
+		}
+		else
+			FT_CHECK(s.count(k) == ref.count(k) && m.count(k) == ref.count(k));
+	}
+	FT_CHECK(s.size() == ref.size() && m.size() == ref.size());
+
+	//대부분을 지워서 다시 만들게 한 뒤에도 맞다.
+	s.erase(s.begin(), s.lower_bound(29000));
+	ref.erase(ref.begin(), ref.lower_bound(29000));
+	bool ok = true;
+	for (int k = 0; k < 30000; k++)
+		ok = ok && s.count(k) == ref.count(k) && (s.find(k) != s.end()) == (ref.count(k) == 1);
+	FT_CHECK(ok);
+
+	ft::set<int> copy(s);
+	ft::set<int> assigned;
+	assigned.enable_filter();
+	assigned = s;
+	FT_CHECK(copy.filter_enabled() && copy.size() == ref.size() && copy.count(29500) == ref.count(29500));
+	FT_CHECK(assigned.size() == ref.size() && assigned.count(*ref.begin()) == 1);
+	copy.clear();
+	FT_CHECK(copy.count(29500) == 0);
+	copy.insert(5);
+	FT_CHECK(copy.count(5) == 1);
+	s.swap(copy);
+	FT_CHECK(s.count(5) == 1 && copy.count(*ref.rbegin()) == 1);
+	s.disable_filter();
+	FT_CHECK(!s.filter_enabled() && s.count(5) == 1);
+
+	//지운 키가 쌓인 뒤 const 조회만 하는 스레드들.
+	ft::map<int, int> shared;
+	shared.enable_filter();
+	for (int i = 0; i < 40000; i++)
+		shared[i] = i;
+	for (int i = 0; i < 40000; i++)
+		if (i % 2 || i >= 20000)
+			shared.erase(i);
+	g_shared = &shared;
+	pthread_t th[4];
+	for (long t = 0; t < 4; t++)
+		pthread_create(&th[t], NULL, reader, reinterpret_cast<void *>(t));
+	for (int t = 0; t < 4; t++)
+		pthread_join(th[t], NULL);
+	FT_CHECK(g_miscount == 0);
+	return ft_test::result("bloom_filter");
+}
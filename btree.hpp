@@ -0,0 +1,689 @@
+#ifndef BTREE_CLASS_HPP
+# define BTREE_CLASS_HPP
+
+# include <functional>
+# include "utils.hpp"
+
+namespace ft
+{
+//생성자 없이 T를 n개 담을 수 있는 정렬된 저장공간.
+template <size_t Bytes>
+union __raw_storage
+{
+	char		buf[Bytes];
+	long double	align_ld;
+	void		*align_ptr;
+	long		align_l;
+};
+
+struct __btree_node
+{
+	bool	leaf;
+	int		count;
+};
+
+//잎 노드. 값을 정렬된 배열로 직접 들고 있고, 옆 잎과 양방향으로 이어져 있다.
+//분할 전에 한 칸이 넘칠 수 있도록 Slots + 1칸을 잡는다.
+template <class Value, int Slots>
+struct __btree_leaf : __btree_node
+{
+	__btree_leaf					*prev;
+	__btree_leaf					*next;
+	__raw_storage<sizeof(Value) * (Slots + 1)>	storage;
+
+	Value*
+	vals(void)
+	{ return reinterpret_cast<Value *>(storage.buf); }
+};
+
+//내부 노드. 키 count개와 자식 count + 1개. keys[i]는 children[i + 1]의 가장 작은 키 이하이다.
+template <class Key, int Slots>
+struct __btree_inner : __btree_node
+{
+	__raw_storage<sizeof(Key) * (Slots + 1)>	storage;
+	__btree_node								*children[Slots + 2];
+
+	Key*
+	keys(void)
+	{ return reinterpret_cast<Key *>(storage.buf); }
+};
+
+template <class Tree, class Value>
+class __btree_iterator;
+
+//B+트리. 노드 하나가 대략 NodeBytes바이트라 한 번 내려갈 때 연속된 몇 캐시라인만 읽는다.
+//값은 잎에만 있고 잎끼리 이어져 있어서 범위 순회는 배열을 훑는 것과 같다.
+template <class Value, class Key, class KeyOfValue, class Compare, class Alloc, size_t NodeBytes = 256>
+class btree
+{
+public:
+	static const int	leaf_slots = NodeBytes / sizeof(Value) < 4 ? 4 : static_cast<int>(NodeBytes / sizeof(Value));
+	static const int	inner_slots = NodeBytes / (sizeof(Key) + sizeof(void *)) < 4 ? 4 : static_cast<int>(NodeBytes / (sizeof(Key) + sizeof(void *)));
+
+	typedef __btree_leaf<Value, leaf_slots>		leaf_type;
+	typedef __btree_inner<Key, inner_slots>		inner_type;
+	typedef __btree_iterator<btree, Value>			iterator;
+	typedef __btree_iterator<btree, const Value>	const_iterator;
+
+	__btree_node	*_root;
+	leaf_type		*_head;
+	leaf_type		*_tail;
+
+private:
+	//루트부터 내려온 경로. path[d]의 pidx[d]번째 자식으로 내려갔다.
+	enum { max_depth = 64 };
+
+	size_t			_size;
+	Compare			_comp;
+	KeyOfValue		_key_of;
+	typename Alloc::template rebind<Value>::other		_alloc;
+	typename Alloc::template rebind<Key>::other			_key_alloc;
+	typename Alloc::template rebind<leaf_type>::other	_leaf_alloc;
+	typename Alloc::template rebind<inner_type>::other	_inner_alloc;
+
+	static const int	min_leaf = leaf_slots / 2;
+	static const int	min_inner = inner_slots / 2;
+
+	leaf_type*
+	__new_leaf(void)
+	{
+		leaf_type *n = _leaf_alloc.allocate(1);
+		n->leaf = true;
+		n->count = 0;
+		n->prev = NULL;
+		n->next = NULL;
+		return n;
+	}
+
+	inner_type*
+	__new_inner(void)
+	{
+		inner_type *n = _inner_alloc.allocate(1);
+		n->leaf = false;
+		n->count = 0;
+		return n;
+	}
+
+	const Key &
+	__key(leaf_type *l, int i) const
+	{ return _key_of(l->vals()[i]); }
+
+	//노드 안에서 이진탐색. k보다 작지 않은 첫 위치.
+	int
+	__leaf_lower(leaf_type *l, const Key &k) const
+	{
+		int lo = 0, hi = l->count;
+		while (lo < hi)
+		{
+			int mid = (lo + hi) / 2;
+			if (_comp(this->__key(l, mid), k))
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		return lo;
+	}
+
+	int
+	__leaf_upper(leaf_type *l, const Key &k) const
+	{
+		int lo = 0, hi = l->count;
+		while (lo < hi)
+		{
+			int mid = (lo + hi) / 2;
+			if (_comp(k, this->__key(l, mid)))
+				hi = mid;
+			else
+				lo = mid + 1;
+		}
+		return lo;
+	}
+
+	//k가 들어있을 자식 번호. (k 이하인 구분키의 개수)
+	int
+	__child_index(inner_type *n, const Key &k) const
+	{
+		Key *keys = n->keys();
+		int lo = 0, hi = n->count;
+		while (lo < hi)
+		{
+			int mid = (lo + hi) / 2;
+			if (_comp(k, keys[mid]))
+				hi = mid;
+			else
+				lo = mid + 1;
+		}
+		return lo;
+	}
+
+	leaf_type*
+	__descend(const Key &k, inner_type **path, int *pidx, int &depth) const
+	{
+		__btree_node *n = _root;
+
+		depth = 0;
+		while (!n->leaf)
+		{
+			inner_type *in = static_cast<inner_type *>(n);
+			int i = this->__child_index(in, k);
+			if (path != NULL)
+			{
+				path[depth] = in;
+				pidx[depth] = i;
+			}
+			++depth;
+			n = in->children[i];
+		}
+		return static_cast<leaf_type *>(n);
+	}
+
+	//배열 안에서 [from, count)를 한 칸 오른쪽/왼쪽으로 민다. (값은 복사 후 파괴)
+	template <class T, class A>
+	static void
+	__shift_right(T *arr, int from, int count, A &alloc)
+	{
+		for (int i = count; i > from; --i)
+		{
+			alloc.construct(arr + i, arr[i - 1]);
+			alloc.destroy(arr + i - 1);
+		}
+	}
+
+	template <class T, class A>
+	static void
+	__shift_left(T *arr, int from, int count, A &alloc)
+	{
+		for (int i = from; i + 1 < count; ++i)
+		{
+			alloc.construct(arr + i, arr[i + 1]);
+			alloc.destroy(arr + i + 1);
+		}
+	}
+
+	template <class T, class A>
+	static void
+	__move_range(T *dst, T *src, int n, A &alloc)
+	{
+		for (int i = 0; i < n; ++i)
+		{
+			alloc.construct(dst + i, src[i]);
+			alloc.destroy(src + i);
+		}
+	}
+
+	static void
+	__shift_children_right(inner_type *n, int from)
+	{
+		for (int i = n->count + 1; i > from; --i)
+			n->children[i] = n->children[i - 1];
+	}
+
+	static void
+	__shift_children_left(inner_type *n, int from)
+	{
+		for (int i = from; i < n->count + 1; ++i)
+			n->children[i] = n->children[i + 1];
+	}
+
+	//left 오른쪽에 right가 새로 생겼다. 부모에 구분키 sep을 넣고, 넘치면 부모도 나눈다.
+	void
+	__insert_into_parent(inner_type **path, int *pidx, int d, __btree_node *left, const Key &sep, __btree_node *right)
+	{
+		if (d == 0)
+		{
+			inner_type *root = this->__new_inner();
+			_key_alloc.construct(root->keys(), sep);
+			root->children[0] = left;
+			root->children[1] = right;
+			root->count = 1;
+			_root = root;
+			return ;
+		}
+		inner_type *p = path[d - 1];
+		int i = pidx[d - 1];
+		__shift_right(p->keys(), i, p->count, _key_alloc);
+		_key_alloc.construct(p->keys() + i, sep);
+		__shift_children_right(p, i + 1);
+		p->children[i + 1] = right;
+		++p->count;
+		if (p->count <= inner_slots)
+			return ;
+
+		//가운데 키는 위로 올리고 나머지를 반으로 나눈다.
+		inner_type *r = this->__new_inner();
+		int mid = p->count / 2;
+		Key up(p->keys()[mid]);
+		__move_range(r->keys(), p->keys() + mid + 1, p->count - mid - 1, _key_alloc);
+		for (int j = mid + 1; j <= p->count; ++j)
+			r->children[j - mid - 1] = p->children[j];
+		r->count = p->count - mid - 1;
+		_key_alloc.destroy(p->keys() + mid);
+		p->count = mid;
+		this->__insert_into_parent(path, pidx, d - 1, p, up, r);
+	}
+
+	//n의 i번째 키와 i + 1번째 자식을 지운다.
+	void
+	__remove_from_inner(inner_type *n, int i)
+	{
+		_key_alloc.destroy(n->keys() + i);
+		__shift_left(n->keys(), i, n->count, _key_alloc);
+		__shift_children_left(n, i + 1);
+		--n->count;
+	}
+
+	void
+	__unlink_leaf(leaf_type *l)
+	{
+		if (l->prev)
+			l->prev->next = l->next;
+		else
+			_head = l->next;
+		if (l->next)
+			l->next->prev = l->prev;
+		else
+			_tail = l->prev;
+		_leaf_alloc.deallocate(l, 1);
+	}
+
+	void
+	__rebalance_leaf(inner_type **path, int *pidx, int d, leaf_type *l)
+	{
+		if (d == 0)
+		{
+			if (l->count == 0)
+			{
+				_leaf_alloc.deallocate(l, 1);
+				_root = NULL;
+				_head = NULL;
+				_tail = NULL;
+			}
+			return ;
+		}
+		if (l->count >= min_leaf)
+			return ;
+		inner_type *p = path[d - 1];
+		int i = pidx[d - 1];
+		leaf_type *left = i > 0 ? static_cast<leaf_type *>(p->children[i - 1]) : NULL;
+		leaf_type *right = i < p->count ? static_cast<leaf_type *>(p->children[i + 1]) : NULL;
+
+		//형제에게 여유가 있으면 하나 빌려온다.
+		if (left && left->count > min_leaf)
+		{
+			__shift_right(l->vals(), 0, l->count, _alloc);
+			_alloc.construct(l->vals(), left->vals()[left->count - 1]);
+			_alloc.destroy(left->vals() + left->count - 1);
+			--left->count;
+			++l->count;
+			p->keys()[i - 1] = this->__key(l, 0);
+			return ;
+		}
+		if (right && right->count > min_leaf)
+		{
+			_alloc.construct(l->vals() + l->count, right->vals()[0]);
+			_alloc.destroy(right->vals());
+			__shift_left(right->vals(), 0, right->count, _alloc);
+			--right->count;
+			++l->count;
+			p->keys()[i] = this->__key(right, 0);
+			return ;
+		}
+		//아니면 합친다.
+		if (left)
+		{
+			__move_range(left->vals() + left->count, l->vals(), l->count, _alloc);
+			left->count += l->count;
+			this->__remove_from_inner(p, i - 1);
+			this->__unlink_leaf(l);
+		}
+		else
+		{
+			__move_range(l->vals() + l->count, right->vals(), right->count, _alloc);
+			l->count += right->count;
+			this->__remove_from_inner(p, i);
+			this->__unlink_leaf(right);
+		}
+		this->__rebalance_inner(path, pidx, d - 1);
+	}
+
+	void
+	__rebalance_inner(inner_type **path, int *pidx, int d)
+	{
+		inner_type *n = path[d];
+
+		if (d == 0)
+		{
+			if (n->count == 0)
+			{
+				_root = n->children[0];
+				_inner_alloc.deallocate(n, 1);
+			}
+			return ;
+		}
+		if (n->count >= min_inner)
+			return ;
+		inner_type *p = path[d - 1];
+		int i = pidx[d - 1];
+		inner_type *left = i > 0 ? static_cast<inner_type *>(p->children[i - 1]) : NULL;
+		inner_type *right = i < p->count ? static_cast<inner_type *>(p->children[i + 1]) : NULL;
+
+		if (left && left->count > min_inner)
+		{
+			//부모의 구분키를 내리고 왼쪽 형제의 마지막 키를 올린다.
+			__shift_right(n->keys(), 0, n->count, _key_alloc);
+			_key_alloc.construct(n->keys(), p->keys()[i - 1]);
+			__shift_children_right(n, 0);
+			n->children[0] = left->children[left->count];
+			++n->count;
+			p->keys()[i - 1] = left->keys()[left->count - 1];
+			_key_alloc.destroy(left->keys() + left->count - 1);
+			--left->count;
+			return ;
+		}
+		if (right && right->count > min_inner)
+		{
+			_key_alloc.construct(n->keys() + n->count, p->keys()[i]);
+			n->children[n->count + 1] = right->children[0];
+			++n->count;
+			p->keys()[i] = right->keys()[0];
+			_key_alloc.destroy(right->keys());
+			__shift_left(right->keys(), 0, right->count, _key_alloc);
+			__shift_children_left(right, 0);
+			--right->count;
+			return ;
+		}
+		if (left)
+			this->__merge_inner(p, i - 1, left, n);
+		else
+			this->__merge_inner(p, i, n, right);
+		this->__rebalance_inner(path, pidx, d - 1);
+	}
+
+	//p의 i번째 구분키를 사이에 두고 right를 left에 합친다.
+	void
+	__merge_inner(inner_type *p, int i, inner_type *left, inner_type *right)
+	{
+		_key_alloc.construct(left->keys() + left->count, p->keys()[i]);
+		__move_range(left->keys() + left->count + 1, right->keys(), right->count, _key_alloc);
+		for (int j = 0; j <= right->count; ++j)
+			left->children[left->count + 1 + j] = right->children[j];
+		left->count += right->count + 1;
+		this->__remove_from_inner(p, i);
+		_inner_alloc.deallocate(right, 1);
+	}
+
+	void
+	__free_node(__btree_node *n)
+	{
+		if (n->leaf)
+		{
+			leaf_type *l = static_cast<leaf_type *>(n);
+			for (int i = 0; i < l->count; ++i)
+				_alloc.destroy(l->vals() + i);
+			_leaf_alloc.deallocate(l, 1);
+			return ;
+		}
+		inner_type *in = static_cast<inner_type *>(n);
+		for (int i = 0; i <= in->count; ++i)
+			this->__free_node(in->children[i]);
+		for (int i = 0; i < in->count; ++i)
+			_key_alloc.destroy(in->keys() + i);
+		_inner_alloc.deallocate(in, 1);
+	}
+
+	//잎의 끝을 가리키면 다음 잎의 처음으로 옮긴다.
+	iterator
+	__normalize(leaf_type *l, int i) const
+	{
+		if (i == l->count)
+		{
+			l = l->next;
+			i = 0;
+		}
+		return iterator(this, l, i);
+	}
+
+public:
+	btree(const Compare &comp_ = Compare(), const Alloc &alloc_ = Alloc())
+	: _root(NULL), _head(NULL), _tail(NULL), _size(0), _comp(comp_),
+	  _alloc(alloc_), _key_alloc(alloc_), _leaf_alloc(alloc_), _inner_alloc(alloc_) {}
+
+	~btree()
+	{ this->clear(); }
+
+	size_t
+	size(void) const
+	{ return _size; }
+
+	size_t
+	max_size(void) const
+	{ return _alloc.max_size(); }
+
+	Compare
+	key_comp(void) const
+	{ return _comp; }
+
+	Alloc
+	get_allocator(void) const
+	{ return Alloc(_alloc); }
+
+	iterator
+	begin(void) const
+	{ return iterator(this, _head, 0); }
+
+	iterator
+	end(void) const
+	{ return iterator(this, NULL, 0); }
+
+	ft::pair<iterator, bool>
+	insert(const Value &val)
+	{
+		inner_type *path[max_depth];
+		int pidx[max_depth];
+		int depth;
+		const Key &k = _key_of(val);
+
+		if (_root == NULL)
+		{
+			_head = _tail = this->__new_leaf();
+			_root = _head;
+		}
+		leaf_type *l = this->__descend(k, path, pidx, depth);
+		int pos = this->__leaf_lower(l, k);
+		if (pos < l->count && !_comp(k, this->__key(l, pos)))
+			return ft::make_pair(iterator(this, l, pos), false);
+
+		__shift_right(l->vals(), pos, l->count, _alloc);
+		_alloc.construct(l->vals() + pos, val);
+		++l->count;
+		++_size;
+		if (l->count <= leaf_slots)
+			return ft::make_pair(iterator(this, l, pos), true);
+
+		//잎이 넘치면 반으로 나눠 오른쪽 절반을 새 잎으로 옮긴다.
+		leaf_type *r = this->__new_leaf();
+		int mid = l->count / 2;
+		__move_range(r->vals(), l->vals() + mid, l->count - mid, _alloc);
+		r->count = l->count - mid;
+		l->count = mid;
+		r->next = l->next;
+		r->prev = l;
+		if (l->next)
+			l->next->prev = r;
+		else
+			_tail = r;
+		l->next = r;
+		Key sep(this->__key(r, 0));
+		this->__insert_into_parent(path, pidx, depth, l, sep, r);
+		if (pos < mid)
+			return ft::make_pair(iterator(this, l, pos), true);
+		return ft::make_pair(iterator(this, r, pos - mid), true);
+	}
+
+	size_t
+	erase(const Key &k)
+	{
+		inner_type *path[max_depth];
+		int pidx[max_depth];
+		int depth;
+
+		if (_root == NULL)
+			return 0;
+		leaf_type *l = this->__descend(k, path, pidx, depth);
+		int pos = this->__leaf_lower(l, k);
+		if (pos == l->count || _comp(k, this->__key(l, pos)))
+			return 0;
+		_alloc.destroy(l->vals() + pos);
+		__shift_left(l->vals(), pos, l->count, _alloc);
+		--l->count;
+		--_size;
+		this->__rebalance_leaf(path, pidx, depth, l);
+		return 1;
+	}
+
+	iterator
+	find(const Key &k) const
+	{
+		iterator it = this->lower_bound(k);
+
+		if (it == this->end() || _comp(k, _key_of(*it)))
+			return this->end();
+		return it;
+	}
+
+	iterator
+	lower_bound(const Key &k) const
+	{
+		int depth;
+
+		if (_root == NULL)
+			return this->end();
+		leaf_type *l = this->__descend(k, NULL, NULL, depth);
+		return this->__normalize(l, this->__leaf_lower(l, k));
+	}
+
+	iterator
+	upper_bound(const Key &k) const
+	{
+		int depth;
+
+		if (_root == NULL)
+			return this->end();
+		leaf_type *l = this->__descend(k, NULL, NULL, depth);
+		return this->__normalize(l, this->__leaf_upper(l, k));
+	}
+
+	void
+	clear(void)
+	{
+		if (_root != NULL)
+			this->__free_node(_root);
+		_root = NULL;
+		_head = NULL;
+		_tail = NULL;
+		_size = 0;
+	}
+
+	void
+	swap(btree &x)
+	{
+		std::swap(_root, x._root);
+		std::swap(_head, x._head);
+		std::swap(_tail, x._tail);
+		std::swap(_size, x._size);
+		std::swap(_comp, x._comp);
+	}
+};
+
+//(잎, 칸 번호) 반복자. end는 잎이 NULL이고, end에서 --하면 마지막 잎으로 간다.
+template <class Tree, class Value>
+class __btree_iterator
+{
+public:
+	typedef Value								value_type;
+	typedef ptrdiff_t							difference_type;
+	typedef value_type&							reference;
+	typedef value_type*							pointer;
+	typedef std::bidirectional_iterator_tag		iterator_category;
+	typedef typename Tree::leaf_type			leaf_type;
+
+	const Tree	*_tree;
+	leaf_type	*_leaf;
+	int			_idx;
+
+	__btree_iterator(void) : _tree(NULL), _leaf(NULL), _idx(0) {}
+
+	__btree_iterator(const Tree *tree_, leaf_type *leaf_, int idx_)
+	: _tree(tree_), _leaf(leaf_), _idx(idx_) {}
+
+	template <class V>
+	__btree_iterator(const __btree_iterator<Tree, V> &src)
+	: _tree(src._tree), _leaf(src._leaf), _idx(src._idx) {}
+
+	reference
+	operator*(void) const
+	{ return _leaf->vals()[_idx]; }
+
+	pointer
+	operator->(void) const
+	{ return &this->operator*(); }
+
+	__btree_iterator &
+	operator++(void)
+	{
+		if (++_idx == _leaf->count)
+		{
+			_leaf = _leaf->next;
+			_idx = 0;
+		}
+		return *this;
+	}
+
+	__btree_iterator
+	operator++(int)
+	{
+		__btree_iterator tmp(*this);
+		++(*this);
+		return tmp;
+	}
+
+	__btree_iterator &
+	operator--(void)
+	{
+		if (_leaf == NULL)
+		{
+			_leaf = _tree->_tail;
+			_idx = _leaf->count - 1;
+		}
+		else if (_idx == 0)
+		{
+			_leaf = _leaf->prev;
+			_idx = _leaf->count - 1;
+		}
+		else
+			--_idx;
+		return *this;
+	}
+
+	__btree_iterator
+	operator--(int)
+	{
+		__btree_iterator tmp(*this);
+		--(*this);
+		return tmp;
+	}
+
+	template <class V>
+	bool
+	operator==(const __btree_iterator<Tree, V> &rhs) const
+	{ return _leaf == rhs._leaf && _idx == rhs._idx; }
+
+	template <class V>
+	bool
+	operator!=(const __btree_iterator<Tree, V> &rhs) const
+	{ return !(*this == rhs); }
+};
+
+}
+
+#endif
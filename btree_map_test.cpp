@@ -0,0 +1,136 @@
+#include <map>
+#include <memory>
+#include <set>
+#include <stdlib.h>
+#include "btree_map.hpp"
+#include "btree_set.hpp"
+#include "tester.hpp"
+
+//상태가 있는 할당자. 복사본이 같은 id를 물려받는지 본다.
+template <class T>
+class TagAlloc : public std::allocator<T>
+{
+public:
+	template <class U>
+	struct rebind { typedef TagAlloc<U> other; };
+
+	int	id;
+
+	TagAlloc(int id_ = 0) : id(id_) {}
+	template <class U>
+	TagAlloc(const TagAlloc<U> &src) : id(src.id) {}
+};
+
+typedef ft::btree_map<int, int>		map_t;
+//노드가 작으면 나누기와 합치기가 자주 일어난다.
+typedef ft::btree_map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, 64>	small_t;
+
+template <class M>
+static bool
+same(const M &m, const std::map<int, int> &ref)
+{
+	if (m.size() != ref.size())
+		return false;
+	std::map<int, int>::const_iterator r = ref.begin();
+	for (typename M::const_iterator it = m.begin(); it != m.end(); ++it, ++r)
+		if (it->first != r->first || it->second != r->second)
+			return false;
+	std::map<int, int>::const_reverse_iterator rr = ref.rbegin();
+	for (typename M::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it, ++rr)
+		if (it->first != rr->first)
+			return false;
+	return true;
+}
+
+template <class M>
+static void
+churn(M &m, std::map<int, int> &ref, int ops, int range)
+{
+	for (int i = 0; i < ops; i++)
+	{
+		int k = rand() % range;
+		switch (rand() % 5)
+		{
+		case 0:
+			FT_CHECK(m.erase(k) == ref.erase(k));
+			break;
+		case 1:
+		{
+			typename M::iterator lb = m.lower_bound(k);
+			std::map<int, int>::iterator rlb = ref.lower_bound(k);
+			FT_CHECK((lb == m.end()) == (rlb == ref.end()));
+			if (lb != m.end() && rlb != ref.end())
+				FT_CHECK(lb->first == rlb->first);
+			FT_CHECK(m.count(k) == ref.count(k));
+			break;
+		}
+		default:
+			m[k] = i;
+			ref[k] = i;
+		}
+	}
+}
+
+int main(void)
+{
+	srand(11);
+	map_t m;
+	small_t s;
+	std::map<int, int> ref;
+	std::map<int, int> sref;
+
+	churn(m, ref, 300000, 50000);
+	churn(s, sref, 300000, 5000);
+	FT_CHECK(same(m, ref));
+	FT_CHECK(same(s, sref));
+
+	//구간 지우기와 정렬된 힌트 삽입.
+	map_t::iterator first = m.lower_bound(10000);
+	map_t::iterator last = m.lower_bound(20000);
+	m.erase(first, last);
+	ref.erase(ref.lower_bound(10000), ref.lower_bound(20000));
+	FT_CHECK(same(m, ref));
+	map_t::iterator hint = m.end();
+	for (int i = 60000; i < 61000; i++)
+	{
+		hint = m.insert(hint, ft::make_pair(i, i));
+		ref[i] = i;
+	}
+	FT_CHECK(same(m, ref));
+	FT_CHECK(m.equal_range(60500).first->first == 60500);
+	FT_CHECK(m.upper_bound(60999) == m.end());
+	FT_CHECK(m.rbegin()->first == 60999 && m.rbegin()->second == 60999);
+
+	map_t copy(m);
+	map_t assigned;
+	assigned = m;
+	FT_CHECK(same(copy, ref) && same(assigned, ref));
+	m.clear();
+	FT_CHECK(m.empty() && m.begin() == m.end() && same(copy, ref));
+	m.swap(copy);
+	FT_CHECK(same(m, ref) && copy.empty());
+
+	//복사 생성은 원본의 할당자를 가져간다.
+	typedef ft::btree_map<int, int, std::less<int>, TagAlloc<ft::pair<const int, int> > >	tagged_t;
+	tagged_t tagged(std::less<int>(), TagAlloc<ft::pair<const int, int> >(7));
+	tagged[1] = 1;
+	tagged_t tagged_copy(tagged);
+	FT_CHECK(tagged.get_allocator().id == 7 && tagged_copy.get_allocator().id == 7);
+	FT_CHECK(tagged_copy.size() == 1 && tagged_copy[1] == 1);
+
+	ft::btree_set<int> bs;
+	std::set<int> bsref;
+	for (int i = 0; i < 100000; i++)
+	{
+		int k = rand() % 30000;
+		if (rand() % 3 == 0)
+			FT_CHECK(bs.erase(k) == bsref.erase(k));
+		else
+			FT_CHECK(bs.insert(k).second == bsref.insert(k).second);
+	}
+	FT_CHECK(bs.size() == bsref.size() && std::equal(bsref.begin(), bsref.end(), bs.begin()));
+	ft::btree_set<int, std::less<int>, TagAlloc<int> > tset(std::less<int>(), TagAlloc<int>(3));
+	ft::btree_set<int, std::less<int>, TagAlloc<int> > tset_copy(tset);
+	FT_CHECK(tset_copy.get_allocator().id == 3);
+	return ft_test::result("btree_map");
+}
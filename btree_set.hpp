@@ -0,0 +1,372 @@
+#ifndef BTREE_SET_CLASS_HPP
+# define BTREE_SET_CLASS_HPP
+
+# include <stdexcept>
+# include "btree.hpp"
+# include "vector.hpp"
+# include "reverse_iterator.hpp"
+
+namespace ft
+{
+//ft::set과 같은 인터페이스의 B+트리 셋. 노드 하나에 여러 값을 모아두어서
+//조회 한 번에 건드리는 캐시라인 수가 rbt보다 훨씬 적고, 순회는 잎 배열을 차례로 읽는다.
+//삽입과 삭제는 노드 안의 값을 옮기므로 반복자는 수정 후 무효가 된다.
+template < class Key, class Compare = std::less<Key>,
+		class Alloc = std::allocator< Key >, size_t NodeBytes = 256 >
+class btree_set
+{
+public:
+	typedef Key											key_type;
+	typedef Key											value_type;
+	typedef Compare										key_compare;
+	typedef Compare										value_compare;
+
+	typedef Alloc										allocator_type;
+	typedef typename allocator_type::reference			reference;
+	typedef typename allocator_type::const_reference	const_reference;
+	typedef typename allocator_type::pointer			pointer;
+	typedef typename allocator_type::const_pointer		const_pointer;
+	typedef ptrdiff_t									difference_type;
+	typedef size_t										size_type;
+
+private:
+	typedef ft::btree<value_type, key_type, ft::__identity<value_type>, key_compare, allocator_type, NodeBytes>	tree_type;
+
+public:
+	typedef typename tree_type::const_iterator			iterator;
+	typedef typename tree_type::const_iterator			const_iterator;
+	typedef ft::reverse_iterator<iterator>				reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	explicit btree_set(const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	template <class Ite>
+	btree_set(typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+			Ite last, const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	btree_set(const btree_set &src);
+	virtual ~btree_set(void);
+
+	btree_set	&operator=(btree_set const &rhs);
+
+	iterator				begin(void);
+	const_iterator			begin(void) const;
+	iterator				end(void);
+	const_iterator			end(void) const;
+	reverse_iterator		rbegin(void);
+	const_reverse_iterator	rbegin(void) const;
+	reverse_iterator		rend(void);
+	const_reverse_iterator	rend(void) const;
+
+	size_type	size(void) const;
+	size_type	max_size(void) const;
+	bool		empty(void) const;
+
+	ft::pair<iterator, bool>	insert(const value_type &val);
+	iterator					insert(iterator position, const value_type &val);
+	template <class Ite> void	insert(Ite first, Ite last);
+
+	void		erase(iterator position);
+	size_type	erase(const key_type &k);
+	void		erase(iterator first, iterator last);
+
+	void		swap(btree_set &x);
+	void		clear(void);
+
+	key_compare		key_comp(void) const;
+	value_compare	value_comp(void) const;
+
+	allocator_type	get_allocator(void) const;
+
+	iterator		find(const key_type &k);
+	const_iterator	find(const key_type &k) const;
+	size_type		count(const key_type &k) const;
+
+	iterator		lower_bound(const key_type &k);
+	const_iterator	lower_bound(const key_type &k) const;
+	iterator		upper_bound(const key_type &k);
+	const_iterator	upper_bound(const key_type &k) const;
+	pair<const_iterator,const_iterator>	equal_range(const key_type &k) const;
+	pair<iterator,iterator>				equal_range(const key_type &k);
+
+private:
+	tree_type		_tree;
+
+};
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+btree_set<Key, Compare, Alloc, NodeBytes>::btree_set(const key_compare &comp,
+		const allocator_type &alloc) : _tree(comp, alloc)
+{
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes> template <class Ite>
+btree_set<Key, Compare, Alloc, NodeBytes>::btree_set(
+	typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+	Ite last, const key_compare &comp, const allocator_type &alloc) : \
+		_tree(comp, alloc)
+{
+	this->insert(first, last);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+btree_set<Key, Compare, Alloc, NodeBytes>::btree_set(btree_set const &src) : \
+		_tree(src._tree.key_comp(), src._tree.get_allocator())
+{
+	this->insert(src.begin(), src.end());
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+btree_set<Key, Compare, Alloc, NodeBytes>::~btree_set(void) {
+	this->clear();
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+btree_set<Key, Compare, Alloc, NodeBytes>&
+btree_set<Key, Compare, Alloc, NodeBytes>::operator=(btree_set const &rhs) {
+	if (this == &rhs)
+		return (*this);
+	this->clear();
+	this->insert(rhs.begin(), rhs.end());
+	return (*this);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::begin(void) {
+	return this->_tree.begin();
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::const_iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::begin(void) const {
+	return this->_tree.begin();
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::end(void) {
+	return this->_tree.end();
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::const_iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::end(void) const {
+	return this->_tree.end();
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::reverse_iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::rbegin(void) {
+	return reverse_iterator(this->end());
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::const_reverse_iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::rbegin(void) const {
+	return const_reverse_iterator(this->end());
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::reverse_iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::rend(void) {
+	return reverse_iterator(this->begin());
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::const_reverse_iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::rend(void) const {
+	return const_reverse_iterator(this->begin());
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::size_type
+btree_set<Key, Compare, Alloc, NodeBytes>::size(void) const {
+	return this->_tree.size();
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::size_type
+btree_set<Key, Compare, Alloc, NodeBytes>::max_size(void) const {
+	return this->_tree.max_size();
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+bool	btree_set<Key, Compare, Alloc, NodeBytes>::empty(void) const {
+	return (this->_tree.size() == 0);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+ft::pair<typename btree_set<Key, Compare, Alloc, NodeBytes>::iterator, bool>
+btree_set<Key, Compare, Alloc, NodeBytes>::insert(const value_type &val) {
+	return this->_tree.insert(val);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::insert(iterator, const value_type &val) {
+	return this->_tree.insert(val).first;
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes> template <class Ite>
+void	btree_set<Key, Compare, Alloc, NodeBytes>::insert(Ite first, Ite last) {
+	while (first != last)
+		this->_tree.insert(*first++);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+void	btree_set<Key, Compare, Alloc, NodeBytes>::erase(iterator position)
+{
+	this->_tree.erase(*position);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::size_type
+btree_set<Key, Compare, Alloc, NodeBytes>::erase(const key_type &k)
+{
+	return this->_tree.erase(k);
+}
+
+//지우면 노드가 합쳐져 반복자가 무효가 되므로 키를 먼저 모아둔다.
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+void	btree_set<Key, Compare, Alloc, NodeBytes>::erase(iterator first, iterator last)
+{
+	ft::vector<key_type> keys;
+
+	for (; first != last; ++first)
+		keys.push_back(*first);
+	for (size_type i = 0; i < keys.size(); i++)
+		this->_tree.erase(keys[i]);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+void	btree_set<Key, Compare, Alloc, NodeBytes>::swap(btree_set &x) {
+	this->_tree.swap(x._tree);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+void	btree_set<Key, Compare, Alloc, NodeBytes>::clear(void)
+{
+	this->_tree.clear();
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::key_compare
+btree_set<Key, Compare, Alloc, NodeBytes>::key_comp(void) const {
+	return this->_tree.key_comp();
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::value_compare
+btree_set<Key, Compare, Alloc, NodeBytes>::value_comp(void) const {
+	return this->_tree.key_comp();
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::allocator_type
+btree_set<Key, Compare, Alloc, NodeBytes>::get_allocator(void) const {
+	return this->_tree.get_allocator();
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::find(const key_type &k)
+{
+	return this->_tree.find(k);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::const_iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::find(const key_type &k) const
+{
+	return this->_tree.find(k);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::size_type
+btree_set<Key, Compare, Alloc, NodeBytes>::count(const key_type &k) const
+{
+	return this->_tree.find(k) != this->_tree.end();
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::lower_bound(const key_type &k) {
+	return this->_tree.lower_bound(k);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::const_iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::lower_bound(const key_type &k) const {
+	return this->_tree.lower_bound(k);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::upper_bound(const key_type &k) {
+	return this->_tree.upper_bound(k);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+typename btree_set<Key, Compare, Alloc, NodeBytes>::const_iterator
+btree_set<Key, Compare, Alloc, NodeBytes>::upper_bound(const key_type &k) const {
+	return this->_tree.upper_bound(k);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+ft::pair<typename btree_set<Key, Compare, Alloc, NodeBytes>::const_iterator, typename btree_set<Key, Compare, Alloc, NodeBytes>::const_iterator>
+btree_set<Key, Compare, Alloc, NodeBytes>::equal_range(const key_type &k) const {
+	return ft::pair<const_iterator, const_iterator>(lower_bound(k),upper_bound(k));
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+ft::pair<typename btree_set<Key, Compare, Alloc, NodeBytes>::iterator, typename btree_set<Key, Compare, Alloc, NodeBytes>::iterator>
+btree_set<Key, Compare, Alloc, NodeBytes>::equal_range(const key_type &k) {
+	return ft::pair<iterator, iterator>(lower_bound(k),upper_bound(k));
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+bool	operator==(const btree_set<Key, Compare, Alloc, NodeBytes> &lhs,
+					const btree_set<Key, Compare, Alloc, NodeBytes> &rhs)
+{
+	return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+bool	operator!=(const btree_set<Key, Compare, Alloc, NodeBytes> &lhs,
+					const btree_set<Key, Compare, Alloc, NodeBytes> &rhs) {
+	return !(lhs == rhs);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+bool	operator< (const btree_set<Key, Compare, Alloc, NodeBytes> &lhs,
+					const btree_set<Key, Compare, Alloc, NodeBytes> &rhs) {
+	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+bool	operator<=(const btree_set<Key, Compare, Alloc, NodeBytes> &lhs,
+					const btree_set<Key, Compare, Alloc, NodeBytes> &rhs) {
+	return !(rhs < lhs);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+bool	operator> (const btree_set<Key, Compare, Alloc, NodeBytes> &lhs,
+					const btree_set<Key, Compare, Alloc, NodeBytes> &rhs) {
+	return (rhs < lhs);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+bool	operator>=(const btree_set<Key, Compare, Alloc, NodeBytes> &lhs,
+					const btree_set<Key, Compare, Alloc, NodeBytes> &rhs) {
+	return !(lhs < rhs);
+}
+
+template <class Key, class Compare, class Alloc, size_t NodeBytes>
+void	swap(btree_set<Key, Compare, Alloc, NodeBytes> &x, btree_set<Key, Compare, Alloc, NodeBytes> &y) {
+	x.swap(y);
+}
+
+}
+
+#endif
@@ -0,0 +1,151 @@
+#include <memory>
+#include <string>
+#include <pthread.h>
+#include "map.hpp"
+#include "set.hpp"
+#include "multimap.hpp"
+#include "interval_map.hpp"
+#include "reclaimer.hpp"
+#include "tester.hpp"
+
+//해제는 reclaimer 스레드에서 일어나므로 원자적으로 센다.
+static volatile long	g_nodes = 0;
+static volatile long	g_values = 0;
+
+template <class T>
+class CountAlloc : public std::allocator<T>
+{
+public:
+	template <class U>
+	struct rebind { typedef CountAlloc<U> other; };
+
+	CountAlloc(void) {}
+	template <class U>
+	CountAlloc(const CountAlloc<U> &) {}
+
+	T *
+	allocate(size_t n, const void * = 0)
+	{
+		__sync_fetch_and_add(&g_nodes, static_cast<long>(n));
+		return std::allocator<T>::allocate(n);
+	}
+
+	void
+	deallocate(T *p, size_t n)
+	{
+		__sync_fetch_and_sub(&g_nodes, static_cast<long>(n));
+		std::allocator<T>::deallocate(p, n);
+	}
+};
+
+//소멸자가 불렸는지 센다.
+struct Tracked
+{
+	std::string	s;
+
+	Tracked(void) : s("x") { __sync_fetch_and_add(&g_values, 1); }
+	Tracked(const Tracked &src) : s(src.s) { __sync_fetch_and_add(&g_values, 1); }
+	~Tracked() { __sync_fetch_and_sub(&g_values, 1); }
+	Tracked	&operator=(const Tracked &rhs) { s = rhs.s; return *this; }
+};
+
+typedef ft::map<int, Tracked, std::less<int>, CountAlloc<ft::pair<const int, Tracked> > >	map_t;
+typedef ft::set<int, std::less<int>, CountAlloc<int> >										set_t;
+typedef ft::map<int, int, std::less<int>, CountAlloc<ft::pair<const int, int> >, ft::sum_monoid<long> >	sum_t;
+
+static void *
+clearer(void *arg)
+{
+	long id = reinterpret_cast<long>(arg);
+	int bad = 0;
+
+	for (int round = 0; round < 20; round++)
+	{
+		map_t m;
+		for (int k = 0; k < 2000; k++)
+			m.insert(ft::make_pair(k, Tracked()));
+		m.clear_async();
+		if (!m.empty() || m.begin() != m.end())
+			++bad;
+		m.insert(ft::make_pair(static_cast<int>(id), Tracked()));
+		if (m.size() != 1 || m.begin()->first != id)
+			++bad;
+	}
+	return bad ? reinterpret_cast<void *>(1) : NULL;
+}
+
+int main(void)
+{
+	long base_values = g_values;
+
+	//비우는 즉시 빈 맵처럼 동작하고, 남은 노드와 값은 뒤에서 모두 해제된다.
+	{
+		map_t m;
+		for (int k = 0; k < 100000; k++)
+			m.insert(ft::make_pair(k, Tracked()));
+		m.clear_async();
+		FT_CHECK(m.empty() && m.size() == 0 && m.begin() == m.end() && m.find(5) == m.end());
+		m.insert(ft::make_pair(7, Tracked()));
+		FT_CHECK(m.size() == 1 && m.count(7) == 1 && m.count(5) == 0);
+		m.clear_async();
+		m.clear_async();
+		FT_CHECK(m.empty());
+
+		//필터를 켠 집합은 비운 뒤 새 키를 놓치지 않는다.
+		set_t s;
+		s.enable_filter();
+		for (int k = 0; k < 50000; k++)
+			s.insert(k);
+		s.clear_async();
+		FT_CHECK(s.empty() && s.count(10) == 0);
+		s.insert(10);
+		FT_CHECK(s.count(10) == 1 && s.filter_enabled());
+
+		//요약값도 빈 트리에서 다시 시작한다.
+		sum_t sum;
+		for (int k = 0; k < 10000; k++)
+			sum.insert_or_assign(k, 1);
+		sum.clear_async();
+		FT_CHECK(sum.aggregate() == 0);
+		sum.insert_or_assign(3, 4);
+		FT_CHECK(sum.aggregate() == 4);
+
+		ft::multimap<int, int> mm;
+		ft::interval_map<int, int> im;
+		for (int k = 0; k < 10000; k++)
+		{
+			mm.insert(ft::make_pair(k % 10, k));
+			im.insert(k, k + 5, k);
+		}
+		mm.clear_async();
+		im.clear_async();
+		FT_CHECK(mm.empty() && mm.count(1) == 0 && im.empty() && !im.overlaps(0, 100));
+		im.insert(1, 2, 3);
+		FT_CHECK(im.overlaps(2, 9));
+
+		//비운 뒤 compact를 하다 만 트리도 넘길 수 있다.
+		for (int k = 0; k < 5000; k++)
+			m.insert(ft::make_pair(k, Tracked()));
+		FT_CHECK(!m.compact(100));
+		m.clear_async();
+		FT_CHECK(m.empty() && m.compact());
+	}
+
+	//여러 스레드가 동시에 넘긴다.
+	pthread_t th[4];
+	for (long t = 0; t < 4; t++)
+		pthread_create(&th[t], NULL, clearer, reinterpret_cast<void *>(t));
+	bool ok = true;
+	for (int t = 0; t < 4; t++)
+	{
+		void *bad;
+		pthread_join(th[t], &bad);
+		ok = ok && bad == NULL;
+	}
+	FT_CHECK(ok);
+
+	ft::reclaimer::instance().drain();
+	FT_CHECK(g_values == base_values);
+	FT_CHECK(g_nodes == 0);
+	return ft_test::result("clear_async");
+}
@@ -0,0 +1,184 @@
+#include <iterator>
+#include <map>
+#include <set>
+#include <vector>
+#include <stdlib.h>
+#include "map.hpp"
+#include "set.hpp"
+#include "multimap.hpp"
+#include "interval_map.hpp"
+#include "tester.hpp"
+
+typedef ft::map<int, int>	map_t;
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::sum_monoid<long> >	sum_t;
+
+struct Third
+{
+	bool	operator()(const ft::pair<const int, int> &p) const { return p.first % 3 == 0; }
+};
+
+static bool
+same(const map_t &m, const std::map<int, int> &ref)
+{
+	if (m.size() != ref.size())
+		return false;
+	std::map<int, int>::const_iterator r = ref.begin();
+	for (map_t::const_iterator it = m.begin(); it != m.end(); ++it, ++r)
+		if (it->first != r->first || it->second != r->second)
+			return false;
+	return true;
+}
+
+//다 옮긴 뒤에는 키 순서로 이웃한 원소가 메모리에서도 이웃한다.
+template <class M>
+static bool
+laid_out(const M &m)
+{
+	typename M::const_iterator it = m.begin();
+	const char *prev = NULL;
+	ptrdiff_t step = 0;
+
+	for (; it != m.end(); ++it)
+	{
+		const char *cur = reinterpret_cast<const char *>(&*it);
+		if (prev != NULL)
+		{
+			if (step == 0)
+				step = cur - prev;
+			if (step <= 0 || cur - prev != step)
+				return false;
+		}
+		prev = cur;
+	}
+	return true;
+}
+
+//한 번에 조금씩 옮기는 사이사이 넣고 지운다. 옮기는 중인 자리(커서)의 노드도 지운다.
+static void
+churn_while_compacting(map_t &m, std::map<int, int> &ref, size_t step)
+{
+	int round = 0;
+
+	while (!m.compact(step))
+	{
+		for (int i = 0; i < 20; i++)
+		{
+			int k = rand() % 20000;
+			if (rand() % 2)
+				FT_CHECK(m.erase(k) == ref.erase(k));
+			else
+				FT_CHECK(m.insert(ft::make_pair(k, round)).second == ref.insert(std::make_pair(k, round)).second);
+		}
+		++round;
+	}
+}
+
+int main(void)
+{
+	srand(47);
+	map_t m;
+	std::map<int, int> ref;
+
+	for (int i = 0; i < 20000; i++)
+	{
+		int k = rand() % 20000;
+		m[k] = i;
+		ref[k] = i;
+		if (i % 3 == 0)
+		{
+			int e = rand() % 20000;
+			FT_CHECK(m.erase(e) == ref.erase(e));
+		}
+	}
+
+	//한 번에 다 옮긴다.
+	FT_CHECK(!laid_out(m));
+	FT_CHECK(m.compact());
+	FT_CHECK(same(m, ref) && laid_out(m));
+	FT_CHECK(m.compact());
+
+	//조금씩 옮기는 사이의 쓰기. 그 뒤로도 트리는 멀쩡하고, 다음 전체 compact는 다시 줄을 세운다.
+	churn_while_compacting(m, ref, 64);
+	FT_CHECK(same(m, ref));
+	while (!m.compact(1000))
+		;
+	FT_CHECK(same(m, ref) && laid_out(m));
+
+	//블록 안의 노드를 모두 지우고, 옮기는 도중에 비우거나 바꾸거나 한꺼번에 지운다.
+	m.erase(m.begin(), m.end());
+	ref.clear();
+	FT_CHECK(m.empty() && m.compact());
+	for (int k = 0; k < 5000; k++)
+	{
+		m[k] = k;
+		ref[k] = k;
+	}
+	FT_CHECK(!m.compact(100));
+	map_t other;
+	other[1] = 1;
+	m.swap(other);
+	FT_CHECK(m.size() == 1 && other.size() == 5000);
+	while (!other.compact(300))
+		;
+	FT_CHECK(same(other, ref) && laid_out(other));
+	FT_CHECK(!other.compact(100));
+	Third third;
+	other.erase_if(third);
+	for (int k = 0; k < 5000; k += 3)
+		ref.erase(k);
+	while (!other.compact(300))
+		;
+	FT_CHECK(same(other, ref));
+	FT_CHECK(!other.compact(10));
+	other.clear();
+	FT_CHECK(other.empty() && other.compact());
+	map_t copy_src;
+	for (int k = 0; k < 1000; k++)
+		copy_src[k] = k;
+	copy_src.compact(200);
+	map_t copy(copy_src);
+	copy_src = copy;
+	FT_CHECK(copy.size() == 1000 && copy_src == copy && copy_src.compact());
+
+	//다른 컨테이너도 옮긴 뒤 같은 답을 낸다. 요약값과 _max도 따라 고쳐진다.
+	{
+		ft::set<int> s;
+		std::set<int> sref;
+		for (int i = 0; i < 5000; i++)
+		{
+			int k = rand() % 10000;
+			s.insert(k);
+			sref.insert(k);
+		}
+		FT_CHECK(s.compact() && laid_out(s) && s.size() == sref.size() && ft::equal(s.begin(), s.end(), sref.begin()));
+
+		ft::multimap<int, int> mm;
+		for (int i = 0; i < 3000; i++)
+			mm.insert(ft::make_pair(i % 100, i));
+		FT_CHECK(mm.compact() && laid_out(mm) && mm.count(7) == 30 && mm.find(7)->second == 7);
+
+		sum_t sum;
+		long total = 0;
+		for (int i = 0; i < 4000; i++)
+		{
+			sum.insert_or_assign(i, i % 17);
+			total += i % 17;
+		}
+		while (!sum.compact(100))
+			sum.insert_or_assign(rand() % 4000, 0);
+		long expect = 0;
+		for (sum_t::iterator it = sum.begin(); it != sum.end(); ++it)
+			expect += it->second;
+		FT_CHECK(sum.aggregate() == expect && sum.aggregate(0, 4000) == expect && expect <= total);
+
+		ft::interval_map<int, int> im;
+		for (int i = 0; i < 2000; i++)
+			im.insert(i, i + (i % 50 == 0 ? 500 : 2), i);
+		FT_CHECK(im.compact() && laid_out(im));
+		std::vector<ft::interval_map<int, int>::iterator> found;
+		im.find_stabbing(1499, std::back_inserter(found));
+		//[1497, 1499]에 걸치는 짧은 구간 3개와 1000부터 1450까지 50마다 넣은 긴 구간 10개.
+		FT_CHECK(found.size() == 3 + 10);
+	}
+	return ft_test::result("compact");
+}
@@ -0,0 +1,363 @@
+#ifndef COW_VECTOR_CLASS_HPP
+# define COW_VECTOR_CLASS_HPP
+
+# include "vector.hpp"
+
+namespace ft
+{
+//여러 cow_vector가 함께 쓰는 버퍼. refs는 원자적으로 센다.
+//shareable이 false면 누군가 원소를 고칠 수 있는 참조나 반복자를 받아 갔으므로 더 이상 나눠 주지 않는다.
+template <class T, class Alloc>
+struct __cow_block
+{
+	volatile long			refs;
+	volatile bool			shareable;
+	ft::vector<T, Alloc>	data;
+
+	__cow_block(void) : refs(1), shareable(true) {}
+	explicit __cow_block(const ft::vector<T, Alloc> &src) : refs(1), shareable(true), data(src) {}
+};
+
+//복사하면 버퍼를 함께 쓰고, 처음으로 고칠 때 그 복사본만 따로 떼어 낸다. (copy-on-write)
+//const 접근은 나눠 쓴 버퍼를 그대로 읽는다. const가 아닌 operator[], begin(), data() 등은 먼저 떼어 내고,
+//돌려준 참조로 고칠 수 있으므로 그 버퍼는 다시 나눠 주지 않는다. (이후의 복사는 바로 깊은 복사를 한다)
+//참조 수는 원자적이라 복사본은 다른 스레드로 넘겨도 된다. 한 객체를 여러 스레드가 함께 고치는 것은 안 된다.
+template< typename T, typename Alloc = std::allocator<T> >
+class cow_vector
+{
+public:
+	typedef ft::vector<T, Alloc>						vector_type;
+	typedef T											value_type;
+	typedef Alloc										allocator_type;
+	typedef typename allocator_type::reference			reference;
+	typedef typename allocator_type::const_reference	const_reference;
+	typedef typename allocator_type::pointer			pointer;
+	typedef typename allocator_type::const_pointer		const_pointer;
+	typedef ptrdiff_t									difference_type;
+	typedef size_t										size_type;
+	typedef typename vector_type::iterator				iterator;
+	typedef typename vector_type::const_iterator		const_iterator;
+	typedef typename vector_type::reverse_iterator		reverse_iterator;
+	typedef typename vector_type::const_reverse_iterator	const_reverse_iterator;
+
+private:
+	typedef ft::__cow_block<T, Alloc>	block_type;
+
+	block_type	*_block;
+
+public:
+	cow_vector()
+	: _block(new block_type())
+	{ }
+
+	cow_vector(size_type count, const T& value = T())
+	: _block(new block_type(vector_type(count, value)))
+	{ }
+
+	template<class Iter_type>
+	cow_vector(Iter_type first, Iter_type last,
+			typename ft::enable_if<!ft::is_integral<Iter_type>::value>::type* = 0)
+	: _block(new block_type(vector_type(first, last)))
+	{ }
+
+	explicit cow_vector(const vector_type& src)
+	: _block(new block_type(src))
+	{ }
+
+	cow_vector(const cow_vector& other)
+	: _block(__share(other._block))
+	{ }
+
+	cow_vector &
+	operator=(const cow_vector& x)
+	{
+		block_type *b = __share(x._block);
+
+		__release(this->_block);
+		this->_block = b;
+		return *this;
+	}
+
+	virtual ~cow_vector()
+	{ __release(this->_block); }
+
+	size_type
+	size() const
+	{ return _block->data.size(); }
+
+	size_type
+	max_size() const
+	{ return _block->data.max_size(); }
+
+	void
+	resize(size_type n, value_type val = value_type())
+	{ this->__detach().resize(n, val); }
+
+	size_type
+	capacity() const
+	{ return _block->data.capacity(); }
+
+	bool
+	empty() const
+	{ return _block->data.empty(); }
+
+	void
+	reserve(size_type n)
+	{ this->__detach().reserve(n); }
+
+	//버퍼를 통째로 새로 채우므로 나눠 쓰던 버퍼는 복사하지 않고 놓는다.
+	template <class Iter_type>
+	void
+	assign(Iter_type first, Iter_type last,
+			typename ft::enable_if<!ft::is_integral<Iter_type>::value>::type* = 0)
+	{
+		block_type *b = new block_type(vector_type(first, last));
+
+		__release(this->_block);
+		this->_block = b;
+	}
+
+	void
+	assign(size_type n, const value_type& val)
+	{
+		block_type *b = new block_type(vector_type(n, val));
+
+		__release(this->_block);
+		this->_block = b;
+	}
+
+	void
+	push_back(const value_type& val)
+	{ this->__detach().push_back(val); }
+
+	void
+	pop_back()
+	{ this->__detach().pop_back(); }
+
+	iterator
+	insert(iterator position, const value_type& val)
+	{
+		size_type i = position - this->begin();
+
+		return this->__leak().insert(_block->data.begin() + i, val);
+	}
+
+	void
+	insert(iterator position, size_type n, const value_type& val)
+	{
+		size_type i = position - this->begin();
+
+		this->__detach().insert(_block->data.begin() + i, n, val);
+	}
+
+	template <class Iter_type>
+	void
+	insert(iterator position, Iter_type first, Iter_type last,
+			typename ft::enable_if<!ft::is_integral<Iter_type>::value>::type* = 0)
+	{
+		size_type i = position - this->begin();
+
+		this->__detach().insert(_block->data.begin() + i, first, last);
+	}
+
+	iterator
+	erase(iterator position)
+	{
+		size_type i = position - this->begin();
+
+		return this->__leak().erase(_block->data.begin() + i);
+	}
+
+	iterator
+	erase(iterator first, iterator last)
+	{
+		size_type i = first - this->begin();
+		size_type j = last - this->begin();
+
+		return this->__leak().erase(_block->data.begin() + i, _block->data.begin() + j);
+	}
+
+	void
+	swap(cow_vector& x)
+	{ std::swap(this->_block, x._block); }
+
+	//나눠 쓰는 중이면 복사하지 않고 빈 버퍼로 바꾼다.
+	void
+	clear()
+	{
+		if (__refs(_block) == 1)
+		{
+			_block->data.clear();
+			return ;
+		}
+		block_type *b = new block_type();
+
+		__release(this->_block);
+		this->_block = b;
+	}
+
+	reference
+	operator[](size_type offset)
+	{ return this->__leak().data()[offset]; }
+
+	const_reference
+	operator[](size_type offset) const
+	{ return this->vec().data()[offset]; }
+
+	iterator
+	begin(void)
+	{ return this->__leak().begin(); }
+
+	const_iterator
+	begin(void) const
+	{ return this->vec().begin(); }
+
+	iterator
+	end(void)
+	{ return this->__leak().end(); }
+
+	const_iterator
+	end(void) const
+	{ return this->vec().end(); }
+
+	reverse_iterator
+	rbegin(void)
+	{ return reverse_iterator(this->end()); }
+
+	const_reverse_iterator
+	rbegin(void) const
+	{ return const_reverse_iterator(this->end()); }
+
+	reverse_iterator
+	rend(void)
+	{ return reverse_iterator(this->begin()); }
+
+	const_reverse_iterator
+	rend(void) const
+	{ return const_reverse_iterator(this->begin()); }
+
+	pointer
+	data(void)
+	{ return this->__leak().data(); }
+
+	const_pointer
+	data(void) const
+	{ return this->vec().data(); }
+
+	reference
+	at(size_type pos)
+	{ return this->__leak().at(pos); }
+
+	const_reference
+	at(size_type pos) const
+	{ return this->vec().at(pos); }
+
+	reference
+	front()
+	{ return this->__leak().front(); }
+
+	const_reference
+	front() const
+	{ return this->vec().front(); }
+
+	reference
+	back()
+	{ return this->__leak().back(); }
+
+	const_reference
+	back() const
+	{ return this->vec().back(); }
+
+	allocator_type
+	get_allocator(void) const
+	{ return _block->data.get_allocator(); }
+
+	//이 버퍼를 함께 쓰는 cow_vector의 수.
+	long
+	use_count(void) const
+	{ return __refs(_block); }
+
+	//떼어 내지 않고 읽기만 한다.
+	const vector_type &
+	vec(void) const
+	{ return _block->data; }
+
+private:
+	//혼자 남았는지 볼 때는 acquire로 읽어, 놓고 간 복사본의 읽기가 끝난 뒤에 고치게 한다.
+	static long
+	__refs(const block_type *b)
+	{ return __atomic_load_n(&b->refs, __ATOMIC_ACQUIRE); }
+
+	static block_type *
+	__share(block_type *b)
+	{
+		if (!b->shareable)
+			return new block_type(b->data);
+		__sync_fetch_and_add(&b->refs, 1);
+		return b;
+	}
+
+	static void
+	__release(block_type *b)
+	{
+		if (__sync_sub_and_fetch(&b->refs, 1) == 0)
+			delete b;
+	}
+
+	//혼자 쓰는 버퍼로 만든다. 다른 복사본이 있으면 이 객체만 새 버퍼로 옮긴다.
+	vector_type &
+	__detach(void)
+	{
+		if (__refs(_block) != 1)
+		{
+			block_type *b = new block_type(_block->data);
+
+			__release(this->_block);
+			this->_block = b;
+		}
+		return _block->data;
+	}
+
+	//떼어 낸 뒤 고칠 수 있는 참조를 내보내므로 이후로는 나눠 주지 않는다.
+	vector_type &
+	__leak(void)
+	{
+		vector_type &v = this->__detach();
+
+		_block->shareable = false;
+		return v;
+	}
+
+};
+
+template< class T, class Alloc >
+void
+swap(ft::cow_vector<T,Alloc>& lhs, ft::cow_vector<T,Alloc>& rhs)
+{ lhs.swap(rhs); }
+
+template <class T, class Alloc>
+bool operator==(const ft::cow_vector<T,Alloc>& lhs, const ft::cow_vector<T,Alloc>& rhs)
+{ return lhs.vec() == rhs.vec(); }
+
+template <class T, class Alloc>
+bool operator!=(const ft::cow_vector<T,Alloc>& lhs, const ft::cow_vector<T,Alloc>& rhs)
+{ return !(lhs == rhs); }
+
+template <class T, class Alloc>
+bool operator<(const ft::cow_vector<T,Alloc>& lhs, const ft::cow_vector<T,Alloc>& rhs)
+{ return lhs.vec() < rhs.vec(); }
+
+template <class T, class Alloc>
+bool operator<=(const ft::cow_vector<T,Alloc>& lhs, const ft::cow_vector<T,Alloc>& rhs)
+{ return !(rhs < lhs); }
+
+template <class T, class Alloc>
+bool operator>(const ft::cow_vector<T,Alloc>& lhs, const ft::cow_vector<T,Alloc>& rhs)
+{ return rhs < lhs; }
+
+template <class T, class Alloc>
+bool operator>=(const ft::cow_vector<T,Alloc>& lhs, const ft::cow_vector<T,Alloc>& rhs)
+{ return !(lhs < rhs); }
+
+}
+#endif
@@ -0,0 +1,144 @@
+#include <vector>
+#include <pthread.h>
+#include <stdlib.h>
+#include "cow_vector.hpp"
+#include "tester.hpp"
+
+typedef ft::cow_vector<int>	vec_t;
+
+static bool
+same(const vec_t &v, const std::vector<int> &ref)
+{
+	if (v.size() != ref.size())
+		return false;
+	for (size_t i = 0; i < ref.size(); i++)
+		if (v[i] != ref[i])
+			return false;
+	return true;
+}
+
+//한 원본의 복사본을 여러 스레드가 만들고 고치고 버린다. 원본은 그대로여야 한다.
+static vec_t	g_src;
+
+static void *
+copier(void *arg)
+{
+	long id = reinterpret_cast<long>(arg);
+	int bad = 0;
+
+	for (int i = 0; i < 3000; i++)
+	{
+		vec_t mine(g_src);
+		const vec_t &view = mine;
+		if (view[i % 100] != i % 100)
+			++bad;
+		if (i % 3 == 0)
+		{
+			mine.push_back(static_cast<int>(id));
+			if (mine.size() != 101 || mine.back() != id)
+				++bad;
+		}
+	}
+	return bad ? reinterpret_cast<void *>(1) : NULL;
+}
+
+int main(void)
+{
+	srand(41);
+	{
+		vec_t a(5, 7);
+		vec_t b(a);
+		const vec_t &cb = b;
+
+		//복사와 const 읽기는 버퍼를 함께 쓴다.
+		FT_CHECK(a.use_count() == 2 && cb[4] == 7 && cb.front() == 7 && cb.at(0) == 7);
+		FT_CHECK(a.use_count() == 2 && a.vec().data() == b.vec().data() && a == b);
+
+		//처음 고치는 쪽만 떼어 낸다.
+		b.push_back(8);
+		FT_CHECK(a.use_count() == 1 && b.use_count() == 1 && a.size() == 5 && b.size() == 6);
+
+		//고칠 수 있는 참조를 내준 버퍼는 다시 나눠 주지 않는다.
+		int &r = b[0];
+		vec_t c(b);
+		r = 42;
+		FT_CHECK(b[0] == 42 && c[0] == 7 && c.use_count() == 1);
+
+		//나눠 쓰던 버퍼를 비우거나 새로 채워도 다른 복사본은 그대로다.
+		vec_t d(a);
+		d.clear();
+		FT_CHECK(d.empty() && a.size() == 5);
+		vec_t e(a);
+		int vals[] = {1, 2, 3};
+		e.assign(vals, vals + 3);
+		FT_CHECK(e.size() == 3 && e[2] == 3 && a.size() == 5 && a.use_count() == 1);
+		e = a;
+		FT_CHECK(e.use_count() == 2 && e == a);
+		e.swap(c);
+		FT_CHECK(c == a && e[0] == 7 && e.size() == 6);
+	}
+
+	//std::vector와 같은 결과를 내고, 중간에 떠 둔 복사본은 바뀌지 않는다.
+	{
+		vec_t v;
+		std::vector<int> ref;
+		vec_t kept;
+		std::vector<int> kept_ref;
+		bool ok = true;
+		for (int i = 0; i < 20000; i++)
+		{
+			if (i % 500 == 0)
+			{
+				ok = ok && same(kept, kept_ref);
+				kept = v;
+				kept_ref = ref;
+			}
+			size_t pos = ref.empty() ? 0 : rand() % ref.size();
+			switch (rand() % 6)
+			{
+			case 0:
+				if (!ref.empty())
+				{
+					v.erase(v.begin() + pos);
+					ref.erase(ref.begin() + pos);
+				}
+				break;
+			case 1:
+				v.insert(v.begin() + pos, i);
+				ref.insert(ref.begin() + pos, i);
+				break;
+			case 2:
+				if (!ref.empty())
+				{
+					v[pos] = -i;
+					ref[pos] = -i;
+				}
+				break;
+			case 3:
+				v.resize(ref.size() / 2 + 1, i);
+				ref.resize(ref.size() / 2 + 1, i);
+				break;
+			default:
+				v.push_back(i);
+				ref.push_back(i);
+			}
+		}
+		FT_CHECK(ok && same(v, ref) && same(kept, kept_ref));
+	}
+
+	for (int i = 0; i < 100; i++)
+		g_src.push_back(i);
+	pthread_t th[4];
+	for (long t = 0; t < 4; t++)
+		pthread_create(&th[t], NULL, copier, reinterpret_cast<void *>(t));
+	bool ok = true;
+	for (int t = 0; t < 4; t++)
+	{
+		void *bad;
+		pthread_join(th[t], &bad);
+		ok = ok && bad == NULL;
+	}
+	const vec_t &src = g_src;
+	FT_CHECK(ok && src.use_count() == 1 && src.size() == 100 && src[99] == 99);
+	return ft_test::result("cow_vector");
+}
@@ -0,0 +1,243 @@
+#ifndef EPOCH_CLASS_HPP
+# define EPOCH_CLASS_HPP
+
+# include <cstddef>
+# include <pthread.h>
+# include <sched.h>
+
+namespace ft
+{
+//나중에 지울 객체 하나.
+struct __epoch_retired
+{
+	void				*ptr;
+	void				(*del)(void *);
+	__epoch_retired		*next;
+};
+
+//스레드마다 하나. 스레드가 끝나면 in_use를 내려 다른 스레드가 물려받고, 지우지 않는다.
+//limbo[i]에는 전역 세대가 limbo_epoch[i]일 때 떼어 낸 객체들이 모인다.
+struct __epoch_record
+{
+	volatile unsigned long	epoch;
+	volatile int			active;
+	volatile int			in_use;
+	int						depth;
+	size_t					retired;
+	__epoch_retired			*limbo[3];
+	unsigned long			limbo_epoch[3];
+	__epoch_record			*next;
+};
+
+//세대 기반 메모리 회수. 공유 자료를 읽는 동안은 enter/leave(또는 epoch_guard)로 감싼다.
+//떼어 낸 노드는 retire로 넘기면, 그때 들어와 있던 스레드가 모두 나간 뒤(전역 세대가 2 오른 뒤)에 지워진다.
+class epoch
+{
+public:
+	static void
+	enter(void)
+	{
+		__epoch_record *rec = __self();
+
+		if (rec->depth++ > 0)
+			return ;
+		__atomic_store_n(&rec->active, 1, __ATOMIC_SEQ_CST);
+		__atomic_store_n(&rec->epoch, __now(), __ATOMIC_SEQ_CST);
+		__collect(rec);
+	}
+
+	static void
+	leave(void)
+	{
+		__epoch_record *rec = __self();
+
+		if (--rec->depth > 0)
+			return ;
+		__atomic_store_n(&rec->active, 0, __ATOMIC_RELEASE);
+	}
+
+	//ptr은 이미 어디에서도 닿을 수 없어야 한다. 안전해지면 del(ptr)을 부른다.
+	static void
+	retire(void *ptr, void (*del)(void *))
+	{
+		__epoch_record *rec = __self();
+		unsigned long e = __now();
+		int b = static_cast<int>(e % 3);
+		__epoch_retired *r = new __epoch_retired;
+
+		//같은 칸의 이전 목록은 최소 세 세대 전 것이라 바로 지워도 된다.
+		if (rec->limbo[b] != NULL && rec->limbo_epoch[b] != e)
+			__free_list(rec, b);
+		r->ptr = ptr;
+		r->del = del;
+		r->next = rec->limbo[b];
+		rec->limbo[b] = r;
+		rec->limbo_epoch[b] = e;
+		if (++rec->retired % 64 == 0)
+		{
+			__try_advance();
+			__collect(rec);
+		}
+	}
+
+	//지금까지 retire된 객체를 모두 지우고 돌아온다. 세대 안(enter 중)에서 부르면 끝나지 않는다.
+	//끝난 스레드가 남긴 목록도 함께 지운다.
+	static void
+	synchronize(void)
+	{
+		unsigned long target = __now() + 2;
+
+		while (__now() < target)
+		{
+			if (!__try_advance())
+				sched_yield();
+		}
+		__collect(__self());
+		for (__epoch_record *r = __first(); r != NULL; r = r->next)
+		{
+			if (__atomic_load_n(&r->in_use, __ATOMIC_ACQUIRE) || !__sync_bool_compare_and_swap(&r->in_use, 0, 1))
+				continue;
+			__collect(r);
+			__sync_lock_release(&r->in_use);
+		}
+	}
+
+private:
+	static volatile unsigned long &
+	__global(void)
+	{
+		static volatile unsigned long g = 0;
+		return g;
+	}
+
+	static __epoch_record *volatile &
+	__head(void)
+	{
+		static __epoch_record *volatile head = NULL;
+		return head;
+	}
+
+	static unsigned long
+	__now(void)
+	{ return __atomic_load_n(&__global(), __ATOMIC_SEQ_CST); }
+
+	static __epoch_record *
+	__first(void)
+	{ return __atomic_load_n(&__head(), __ATOMIC_ACQUIRE); }
+
+	static __epoch_record *&
+	__local(void)
+	{
+		static __thread __epoch_record *rec = NULL;
+		return rec;
+	}
+
+	static pthread_key_t &
+	__key(void)
+	{
+		static pthread_key_t key;
+		return key;
+	}
+
+	static void
+	__make_key(void)
+	{ pthread_key_create(&__key(), &__release); }
+
+	//스레드가 끝날 때 기록을 내려놓는다. 남은 목록은 다음 주인이나 synchronize가 지운다.
+	static void
+	__release(void *p)
+	{
+		__epoch_record *rec = static_cast<__epoch_record *>(p);
+
+		rec->depth = 0;
+		__atomic_store_n(&rec->active, 0, __ATOMIC_RELEASE);
+		__sync_lock_release(&rec->in_use);
+	}
+
+	static __epoch_record *
+	__self(void)
+	{
+		static pthread_once_t once = PTHREAD_ONCE_INIT;
+		__epoch_record *&rec = __local();
+
+		if (rec != NULL)
+			return rec;
+		pthread_once(&once, &__make_key);
+		for (__epoch_record *r = __first(); r != NULL; r = r->next)
+		{
+			if (!__atomic_load_n(&r->in_use, __ATOMIC_ACQUIRE) && __sync_bool_compare_and_swap(&r->in_use, 0, 1))
+			{
+				rec = r;
+				break;
+			}
+		}
+		if (rec == NULL)
+		{
+			rec = new __epoch_record();
+			rec->in_use = 1;
+			do
+				rec->next = __head();
+			while (!__sync_bool_compare_and_swap(&__head(), rec->next, rec));
+		}
+		pthread_setspecific(__key(), rec);
+		return rec;
+	}
+
+	//들어와 있는 스레드가 모두 지금 세대를 보고 있으면 세대를 하나 올린다.
+	static bool
+	__try_advance(void)
+	{
+		unsigned long g = __now();
+
+		for (__epoch_record *r = __first(); r != NULL; r = r->next)
+		{
+			if (__atomic_load_n(&r->in_use, __ATOMIC_SEQ_CST)
+					&& __atomic_load_n(&r->active, __ATOMIC_SEQ_CST)
+					&& __atomic_load_n(&r->epoch, __ATOMIC_SEQ_CST) != g)
+				return false;
+		}
+		return __sync_bool_compare_and_swap(&__global(), g, g + 1);
+	}
+
+	static void
+	__collect(__epoch_record *rec)
+	{
+		unsigned long g = __now();
+
+		for (int b = 0; b < 3; b++)
+		{
+			if (rec->limbo[b] != NULL && rec->limbo_epoch[b] + 2 <= g)
+				__free_list(rec, b);
+		}
+	}
+
+	static void
+	__free_list(__epoch_record *rec, int b)
+	{
+		__epoch_retired *r = rec->limbo[b];
+
+		rec->limbo[b] = NULL;
+		while (r != NULL)
+		{
+			__epoch_retired *next = r->next;
+			r->del(r->ptr);
+			delete r;
+			r = next;
+		}
+	}
+};
+
+//범위 안에서는 epoch에 들어와 있다. 겹쳐 써도 된다.
+struct epoch_guard
+{
+	epoch_guard(void) { epoch::enter(); }
+	~epoch_guard() { epoch::leave(); }
+
+private:
+	epoch_guard(const epoch_guard &);
+	epoch_guard	&operator=(const epoch_guard &);
+};
+
+}
+
+#endif
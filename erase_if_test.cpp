@@ -0,0 +1,139 @@
+#include <map>
+#include <set>
+#include <vector>
+#include <stdlib.h>
+#include "map.hpp"
+#include "set.hpp"
+#include "tester.hpp"
+
+typedef ft::map<int, int>	map_t;
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::sum_monoid<long> >	sum_t;
+
+//keep_pct%만 남긴다. 불린 키를 기록해 키 순서로 한 번씩 불렸는지 본다.
+struct Drop
+{
+	int					keep_pct;
+	std::vector<int>	*seen;
+
+	bool
+	operator()(const ft::pair<const int, int> &p) const
+	{
+		seen->push_back(p.first);
+		return (p.second % 100) >= keep_pct;
+	}
+};
+
+struct DropKey
+{
+	int	keep_pct;
+
+	bool	operator()(const int &k) const { return (k * 7 % 100) >= keep_pct; }
+};
+
+int main(void)
+{
+	srand(49);
+	//하나씩 지우는 길과 다시 짜는 길(compact된 트리에서 거의 다 지울 때)을 모두 지난다.
+	int keeps[] = {100, 90, 50, 10, 3, 0};
+	for (size_t c = 0; c < sizeof(keeps) / sizeof(keeps[0]); c++)
+	{
+		map_t m;
+		std::map<int, int> ref;
+		m.enable_filter();
+		for (int i = 0; i < 20000; i++)
+		{
+			int k = rand() % 50000;
+			int v = rand();
+			m.insert(ft::make_pair(k, v));
+			ref.insert(std::make_pair(k, v));
+		}
+		if (c % 2 == 1)
+			m.compact();
+		//남을 원소를 가리키는 반복자는 어느 길로 가든 그대로다.
+		std::vector<map_t::iterator> held;
+		for (map_t::iterator it = m.begin(); it != m.end(); ++it)
+			if (it->second % 100 < keeps[c])
+				held.push_back(it);
+
+		std::vector<int> seen;
+		Drop d = {keeps[c], &seen};
+		size_t before = ref.size();
+		size_t n = m.erase_if(d);
+		for (std::map<int, int>::iterator it = ref.begin(); it != ref.end(); )
+		{
+			if (it->second % 100 >= keeps[c])
+				ref.erase(it++);
+			else
+				++it;
+		}
+		FT_CHECK(n == before - ref.size() && m.size() == ref.size());
+		bool ok = seen.size() == before;
+		for (size_t i = 1; i < seen.size(); i++)
+			ok = ok && seen[i - 1] < seen[i];
+		FT_CHECK(ok);
+		std::map<int, int>::iterator r = ref.begin();
+		for (map_t::iterator it = m.begin(); it != m.end(); ++it, ++r)
+			ok = ok && it->first == r->first && it->second == r->second;
+		FT_CHECK(ok && held.size() == ref.size());
+		r = ref.begin();
+		for (size_t i = 0; i < held.size(); i++, ++r)
+			ok = ok && held[i]->first == r->first;
+		FT_CHECK(ok);
+
+		//지운 키는 필터를 거쳐도 없고, 그 뒤로도 트리는 ft::map처럼 동작한다.
+		for (int i = 0; i < 20000; i++)
+		{
+			int k = rand() % 50000;
+			switch (rand() % 3)
+			{
+			case 0:
+				ok = ok && m.erase(k) == ref.erase(k);
+				break;
+			case 1:
+				ok = ok && m.insert(ft::make_pair(k, i)).second == ref.insert(std::make_pair(k, i)).second;
+				break;
+			default:
+				ok = ok && m.count(k) == ref.count(k);
+			}
+		}
+		FT_CHECK(ok && m.size() == ref.size());
+		FT_CHECK(ref.empty() ? m.begin() == m.end() : m.begin()->first == ref.begin()->first && (--m.end())->first == ref.rbegin()->first);
+	}
+
+	//다시 짠 트리의 요약값.
+	{
+		sum_t s;
+		long expect = 0;
+		for (int k = 0; k < 10000; k++)
+			s.insert_or_assign(k, k % 10);
+		s.compact();
+		std::vector<int> seen;
+		Drop d = {1, &seen};
+		s.erase_if(d);
+		for (sum_t::iterator it = s.begin(); it != s.end(); ++it)
+			expect += it->second;
+		FT_CHECK(s.size() == 1000 && expect == 0 && s.aggregate() == 0);
+		s.insert_or_assign(5, 5);
+		FT_CHECK(s.aggregate() == 5 && s.aggregate(0, 10) == 5);
+	}
+
+	{
+		ft::set<int> s;
+		std::set<int> ref;
+		for (int k = 0; k < 30000; k++)
+		{
+			s.insert(k);
+			if (k * 7 % 100 < 5)
+				ref.insert(k);
+		}
+		s.compact();
+		DropKey d = {5};
+		FT_CHECK(s.erase_if(d) == 30000 - ref.size());
+		FT_CHECK(s.size() == ref.size() && ft::equal(s.begin(), s.end(), ref.begin()));
+		DropKey none = {100};
+		FT_CHECK(s.erase_if(none) == 0 && s.size() == ref.size());
+		DropKey all = {0};
+		FT_CHECK(s.erase_if(all) == ref.size() && s.empty() && s.begin() == s.end());
+	}
+	return ft_test::result("erase_if");
+}
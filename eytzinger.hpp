@@ -0,0 +1,119 @@
+#ifndef EYTZINGER_HPP
+# define EYTZINGER_HPP
+
+# include <cstddef>
+# include <iterator>
+
+namespace ft
+{
+//Eytzinger(BFS) 배치. 1번 칸이 루트이고 k번 칸의 자식은 2k, 2k + 1번 칸이다.
+//위쪽 레벨이 배열 앞부분에 모여 있어 캐시에 잘 남고, 다음에 읽을 칸의 주소를 미리 알 수 있다.
+
+//k가 오른쪽 자식인 동안 올라가고 한 번 더 올라간다. (왼쪽으로 꺾었던 마지막 조상)
+inline size_t
+__eytz_climb(size_t k)
+{ return k >> __builtin_ffsl(static_cast<long>(~k)); }
+
+//가장 작은 값의 칸. 비어 있으면 0.
+inline size_t
+__eytz_first(size_t n)
+{
+	size_t k = n == 0 ? 0 : 1;
+
+	while (k != 0 && 2 * k <= n)
+		k = 2 * k;
+	return k;
+}
+
+//정렬 순서로 다음 칸. 마지막이면 0.
+inline size_t
+__eytz_next(size_t k, size_t n)
+{
+	if (2 * k + 1 <= n)
+	{
+		k = 2 * k + 1;
+		while (2 * k <= n)
+			k = 2 * k;
+		return k;
+	}
+	return __eytz_climb(k);
+}
+
+//x보다 작지 않은 첫 칸. 없으면 0.
+//비교 결과를 그대로 다음 칸 번호에 더해서 분기가 없고, 손자 네 칸(한 캐시라인)을 미리 읽어둔다.
+template <class Key, class Compare>
+inline size_t
+__eytz_lower_bound(const Key *a, size_t n, const Key &x, const Compare &comp)
+{
+	size_t k = 1;
+
+	while (k <= n)
+	{
+		__builtin_prefetch(a + 4 * k);
+		k = 2 * k + static_cast<size_t>(comp(a[k], x));
+	}
+	return __eytz_climb(k);
+}
+
+//정렬된 [first, first + n)을 칸 번호 순서로 넘겨준다. 전체 O(n).
+template <class It, class Fill>
+inline void
+__eytz_fill(It first, size_t n, Fill &fill)
+{
+	for (size_t k = __eytz_first(n); k != 0; k = __eytz_next(k, n))
+		fill(k, *first++);
+}
+
+//frozen_set/frozen_map 공용 정방향 반복자. 칸 번호만 들고 다니고 끝은 0번 칸이다.
+template <class Frozen>
+class __frozen_iterator
+{
+public:
+	typedef typename Frozen::value_type			value_type;
+	typedef ptrdiff_t							difference_type;
+	typedef typename Frozen::const_reference	reference;
+	typedef typename Frozen::const_pointer		pointer;
+	typedef std::forward_iterator_tag			iterator_category;
+
+	const Frozen	*_c;
+	size_t			_k;
+
+	__frozen_iterator(void) : _c(NULL), _k(0) {}
+
+	__frozen_iterator(const Frozen *c_, size_t k_) : _c(c_), _k(k_) {}
+
+	reference
+	operator*(void) const
+	{ return _c->__slot(_k); }
+
+	pointer
+	operator->(void) const
+	{ return _c->__arrow(_k); }
+
+	__frozen_iterator &
+	operator++(void)
+	{
+		_k = __eytz_next(_k, _c->size());
+		return *this;
+	}
+
+	__frozen_iterator
+	operator++(int)
+	{
+		__frozen_iterator tmp(*this);
+		++(*this);
+		return tmp;
+	}
+
+	bool
+	operator==(const __frozen_iterator &rhs) const
+	{ return _k == rhs._k; }
+
+	bool
+	operator!=(const __frozen_iterator &rhs) const
+	{ return _k != rhs._k; }
+};
+
+}
+
+#endif
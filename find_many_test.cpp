@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <vector>
+#include <stdlib.h>
+#include "map.hpp"
+#include "set.hpp"
+#include "tester.hpp"
+
+int main(void)
+{
+	srand(13);
+	ft::map<int, int> m;
+	ft::set<int> s;
+
+	for (int i = 0; i < 50000; i++)
+	{
+		int k = rand() % 200000;
+		m[k] = i;
+		s.insert(k);
+	}
+
+	//묶음 크기가 내부 묶음(__batch)보다 작은 것, 같은 것, 큰 것. 절반쯤은 없는 키다.
+	size_t sizes[] = {0, 1, 7, 8, 9, 100, 1024, 5000};
+	for (size_t z = 0; z < sizeof(sizes) / sizeof(sizes[0]); z++)
+	{
+		std::vector<int> keys;
+		for (size_t i = 0; i < sizes[z]; i++)
+			keys.push_back(rand() % 200002 - 1);
+		for (int pass = 0; pass < 2; pass++)
+		{
+			bool sorted = pass == 1;
+			if (sorted)
+				std::sort(keys.begin(), keys.end());
+
+			std::vector<ft::map<int, int>::iterator> found(keys.size());
+			std::vector<ft::map<int, int>::iterator>::iterator end =
+				m.find_many(keys.begin(), keys.end(), found.begin(), sorted);
+			FT_CHECK(end == found.end());
+			bool same = true;
+			for (size_t i = 0; i < keys.size(); i++)
+				same = same && found[i] == m.find(keys[i]);
+			FT_CHECK(same);
+
+			const ft::map<int, int> &cm = m;
+			std::vector<ft::map<int, int>::const_iterator> cfound(keys.size());
+			cm.find_many(keys.begin(), keys.end(), cfound.begin(), sorted);
+			std::vector<size_t> counts(keys.size());
+			m.count_many(keys.begin(), keys.end(), counts.begin(), sorted);
+			std::vector<size_t> scounts(keys.size());
+			s.count_many(keys.begin(), keys.end(), scounts.begin(), sorted);
+			std::vector<ft::set<int>::iterator> sfound(keys.size());
+			s.find_many(keys.begin(), keys.end(), sfound.begin(), sorted);
+			for (size_t i = 0; i < keys.size(); i++)
+			{
+				same = same && cfound[i] == cm.find(keys[i]);
+				same = same && counts[i] == m.count(keys[i]) && scounts[i] == s.count(keys[i]);
+				same = same && sfound[i] == s.find(keys[i]);
+			}
+			FT_CHECK(same);
+		}
+	}
+
+	//정렬 모드에서 같은 키가 이어지거나 전부 한쪽 끝을 벗어나도 맞다.
+	std::vector<int> edge;
+	edge.push_back(-5);
+	edge.push_back(-5);
+	edge.push_back(m.begin()->first);
+	edge.push_back(m.begin()->first);
+	edge.push_back(m.rbegin()->first);
+	edge.push_back(1000000);
+	std::vector<size_t> ec(edge.size());
+	m.count_many(edge.begin(), edge.end(), ec.begin(), true);
+	FT_CHECK(ec[0] == 0 && ec[1] == 0 && ec[2] == 1 && ec[3] == 1 && ec[4] == 1 && ec[5] == 0);
+
+	ft::map<int, int> empty;
+	std::vector<size_t> none(3, 9);
+	empty.count_many(edge.begin(), edge.begin() + 3, none.begin());
+	FT_CHECK(none[0] == 0 && none[1] == 0 && none[2] == 0);
+	return ft_test::result("find_many");
+}
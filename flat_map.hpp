@@ -0,0 +1,697 @@
+#ifndef FLAT_MAP_CLASS_HPP
+# define FLAT_MAP_CLASS_HPP
+
+# include <stdexcept>
+# include "vector.hpp"
+# include "reverse_iterator.hpp"
+# include "radix_sort.hpp"
+
+namespace ft
+{
+//프록시 참조를 ->로 쓸 수 있게 잠깐 들고 있는 객체.
+template <class Ref>
+struct __arrow_proxy
+{
+	Ref	ref;
+
+	__arrow_proxy(const Ref &ref_) : ref(ref_) {}
+
+	Ref*
+	operator->(void)
+	{ return &ref; }
+};
+
+//키 배열과 값 배열의 같은 칸을 묶은 참조. pair처럼 first, second로 쓰고 pair로 복사할 수 있다.
+template <class Key, class V>
+struct __flat_ref
+{
+	const Key	&first;
+	V			&second;
+
+	__flat_ref(const Key &first_, V &second_) : first(first_), second(second_) {}
+
+	template <class T1, class T2>
+	operator ft::pair<T1, T2>(void) const
+	{ return ft::pair<T1, T2>(first, second); }
+};
+
+template <class Key, class V1, class V2>
+bool operator==(const __flat_ref<Key, V1> &lhs, const __flat_ref<Key, V2> &rhs) {
+	return lhs.first == rhs.first && lhs.second == rhs.second;
+}
+
+template <class Key, class V1, class V2>
+bool operator!=(const __flat_ref<Key, V1> &lhs, const __flat_ref<Key, V2> &rhs) {
+	return !(lhs == rhs);
+}
+
+template <class Key, class V1, class V2>
+bool operator<(const __flat_ref<Key, V1> &lhs, const __flat_ref<Key, V2> &rhs) {
+	return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+}
+
+//키 배열과 값 배열을 같은 칸 번호로 함께 가리키는 반복자.
+//*it는 __flat_ref 프록시라서 it->first, it->second로 원래 배열을 바로 읽고 쓴다.
+template <class Key, class T, class V>
+class __flat_iterator
+{
+public:
+	typedef ft::pair<const Key, T>				value_type;
+	typedef ptrdiff_t							difference_type;
+	typedef __flat_ref<Key, V>					reference;
+	typedef __arrow_proxy<reference>			pointer;
+	typedef std::random_access_iterator_tag		iterator_category;
+
+	const Key	*_k;
+	V			*_v;
+
+	__flat_iterator(void) : _k(NULL), _v(NULL) {}
+
+	__flat_iterator(const Key *k_, V *v_) : _k(k_), _v(v_) {}
+
+	template <class U>
+	__flat_iterator(const __flat_iterator<Key, T, U> &src) : _k(src._k), _v(src._v) {}
+
+	reference
+	operator*(void) const
+	{ return reference(*_k, *_v); }
+
+	pointer
+	operator->(void) const
+	{ return pointer(**this); }
+
+	reference
+	operator[](difference_type n) const
+	{ return reference(_k[n], _v[n]); }
+
+	__flat_iterator &
+	operator++(void)
+	{
+		++_k;
+		++_v;
+		return *this;
+	}
+
+	__flat_iterator
+	operator++(int)
+	{
+		__flat_iterator tmp(*this);
+		++(*this);
+		return tmp;
+	}
+
+	__flat_iterator &
+	operator--(void)
+	{
+		--_k;
+		--_v;
+		return *this;
+	}
+
+	__flat_iterator
+	operator--(int)
+	{
+		__flat_iterator tmp(*this);
+		--(*this);
+		return tmp;
+	}
+
+	__flat_iterator &
+	operator+=(difference_type n)
+	{
+		_k += n;
+		_v += n;
+		return *this;
+	}
+
+	__flat_iterator &
+	operator-=(difference_type n)
+	{ return *this += -n; }
+
+	__flat_iterator
+	operator+(difference_type n) const
+	{ return __flat_iterator(_k + n, _v + n); }
+
+	__flat_iterator
+	operator-(difference_type n) const
+	{ return __flat_iterator(_k - n, _v - n); }
+
+	template <class U>
+	difference_type
+	operator-(const __flat_iterator<Key, T, U> &rhs) const
+	{ return _k - rhs._k; }
+
+	template <class U>
+	bool operator==(const __flat_iterator<Key, T, U> &rhs) const { return _k == rhs._k; }
+	template <class U>
+	bool operator!=(const __flat_iterator<Key, T, U> &rhs) const { return _k != rhs._k; }
+	template <class U>
+	bool operator<(const __flat_iterator<Key, T, U> &rhs) const { return _k < rhs._k; }
+	template <class U>
+	bool operator>(const __flat_iterator<Key, T, U> &rhs) const { return _k > rhs._k; }
+	template <class U>
+	bool operator<=(const __flat_iterator<Key, T, U> &rhs) const { return _k <= rhs._k; }
+	template <class U>
+	bool operator>=(const __flat_iterator<Key, T, U> &rhs) const { return _k >= rhs._k; }
+};
+
+//정렬된 벡터 위의 맵. 키와 값을 따로 된 ft::vector에 같은 순서로 두어서
+//이진탐색은 키 배열만 읽는다. 한 번 채우고 주로 읽기만 하는 표에 맞다.
+//하나씩 넣고 빼는 것은 O(n)이므로 여러 개는 범위 insert로 한꺼번에 넣는다.
+template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< ft::pair<const Key,T> > >
+class flat_map
+{
+public:
+	typedef Key											key_type;
+	typedef T											mapped_type;
+	typedef ft::pair<const key_type, mapped_type>		value_type;
+	typedef Compare										key_compare;
+	class	value_compare
+	{
+		friend class flat_map;
+
+		public:
+		value_compare() : comp(Compare()) { };
+
+		protected:
+		Compare comp;
+		value_compare(Compare c) : comp(c) { };
+
+		public:
+		typedef bool		result_type;
+		typedef value_type	first_argument_type;
+		typedef value_type	second_argument_type;
+		bool	operator()(const value_type &x, const value_type &y) const {
+			return comp(x.first, y.first);
+		}
+	};
+
+	typedef Alloc										allocator_type;
+	typedef ptrdiff_t									difference_type;
+	typedef size_t										size_type;
+
+	typedef ft::__flat_iterator<Key, T, T>				iterator;
+	typedef ft::__flat_iterator<Key, T, const T>		const_iterator;
+	typedef typename iterator::reference				reference;
+	typedef typename const_iterator::reference			const_reference;
+	typedef ft::reverse_iterator<iterator>				reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	explicit flat_map(const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	template <class Ite>
+	flat_map(typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+			Ite last, const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	flat_map(const flat_map &src);
+	virtual ~flat_map(void);
+
+	flat_map	&operator=(flat_map const &rhs);
+
+	iterator				begin(void);
+	const_iterator			begin(void) const;
+	iterator				end(void);
+	const_iterator			end(void) const;
+	reverse_iterator		rbegin(void);
+	const_reverse_iterator	rbegin(void) const;
+	reverse_iterator		rend(void);
+	const_reverse_iterator	rend(void) const;
+
+	size_type	size(void) const;
+	size_type	max_size(void) const;
+	bool		empty(void) const;
+	void		reserve(size_type n);
+
+	mapped_type	&operator[](const key_type &k);
+	mapped_type	&at(const key_type &k);
+	const mapped_type	&at(const key_type &k) const;
+
+	ft::pair<iterator, bool>	insert(const value_type &val);
+	iterator					insert(iterator position, const value_type &val);
+	template <class Ite> void	insert(Ite first, Ite last);
+
+	void		erase(iterator position);
+	size_type	erase(const key_type &k);
+	void		erase(iterator first, iterator last);
+
+	void		swap(flat_map &x);
+	void		clear(void);
+
+	key_compare		key_comp(void) const;
+	value_compare	value_comp(void) const;
+
+	iterator		find(const key_type &k);
+	const_iterator	find(const key_type &k) const;
+	size_type		count(const key_type &k) const;
+
+	iterator		lower_bound(const key_type &k);
+	const_iterator	lower_bound(const key_type &k) const;
+	iterator		upper_bound(const key_type &k);
+	const_iterator	upper_bound(const key_type &k) const;
+	pair<const_iterator,const_iterator>	equal_range(const key_type &k) const;
+	pair<iterator,iterator>				equal_range(const key_type &k);
+
+	const ft::vector<key_type>		&keys(void) const;
+	const ft::vector<mapped_type>	&values(void) const;
+
+private:
+	typedef ft::pair<key_type, mapped_type>		entry_type;
+
+	//정렬용. 키만 비교한다.
+	struct __entry_less
+	{
+		Compare	comp;
+
+		__entry_less(const Compare &c) : comp(c) {}
+
+		bool
+		operator()(const entry_type &x, const entry_type &y) const
+		{ return comp(x.first, y.first); }
+	};
+
+	ft::vector<key_type>	_keys;
+	ft::vector<mapped_type>	_vals;
+	key_compare				_key_cmp;
+
+	size_type	__lower_index(const key_type &k) const;
+	size_type	__upper_index(const key_type &k) const;
+	void		__merge_sorted(ft::vector<entry_type> &buf);
+
+};
+
+template <class Key, class T, class Compare, class Alloc>
+flat_map<Key, T, Compare, Alloc>::flat_map(const key_compare &comp, const allocator_type &) : \
+		_key_cmp(comp)
+{
+}
+
+template <class Key, class T, class Compare, class Alloc> template <class Ite>
+flat_map<Key, T, Compare, Alloc>::flat_map(
+	typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+	Ite last, const key_compare &comp, const allocator_type &) : \
+		_key_cmp(comp)
+{
+	this->insert(first, last);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+flat_map<Key, T, Compare, Alloc>::flat_map(flat_map const &src) : \
+		_keys(src._keys), _vals(src._vals), _key_cmp(src._key_cmp)
+{
+}
+
+template <class Key, class T, class Compare, class Alloc>
+flat_map<Key, T, Compare, Alloc>::~flat_map(void) {
+}
+
+template <class Key, class T, class Compare, class Alloc>
+flat_map<Key, T, Compare, Alloc>&
+flat_map<Key, T, Compare, Alloc>::operator=(flat_map const &rhs) {
+	if (this == &rhs)
+		return (*this);
+	this->_keys = rhs._keys;
+	this->_vals = rhs._vals;
+	this->_key_cmp = rhs._key_cmp;
+	return (*this);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::iterator
+flat_map<Key, T, Compare, Alloc>::begin(void) {
+	return iterator(this->_keys.data(), this->_vals.data());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::const_iterator
+flat_map<Key, T, Compare, Alloc>::begin(void) const {
+	return const_iterator(this->_keys.data(), this->_vals.data());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::iterator
+flat_map<Key, T, Compare, Alloc>::end(void) {
+	return this->begin() + this->size();
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::const_iterator
+flat_map<Key, T, Compare, Alloc>::end(void) const {
+	return this->begin() + this->size();
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::reverse_iterator
+flat_map<Key, T, Compare, Alloc>::rbegin(void) {
+	return reverse_iterator(this->end());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::const_reverse_iterator
+flat_map<Key, T, Compare, Alloc>::rbegin(void) const {
+	return const_reverse_iterator(this->end());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::reverse_iterator
+flat_map<Key, T, Compare, Alloc>::rend(void) {
+	return reverse_iterator(this->begin());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::const_reverse_iterator
+flat_map<Key, T, Compare, Alloc>::rend(void) const {
+	return const_reverse_iterator(this->begin());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::size_type
+flat_map<Key, T, Compare, Alloc>::size(void) const {
+	return this->_keys.size();
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::size_type
+flat_map<Key, T, Compare, Alloc>::max_size(void) const {
+	return this->_keys.max_size();
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	flat_map<Key, T, Compare, Alloc>::empty(void) const {
+	return (this->_keys.size() == 0);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	flat_map<Key, T, Compare, Alloc>::reserve(size_type n) {
+	this->_keys.reserve(n);
+	this->_vals.reserve(n);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::mapped_type&
+flat_map<Key, T, Compare, Alloc>::operator[](const key_type &k)
+{
+	return this->insert(ft::make_pair(k, mapped_type())).first->second;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::mapped_type&
+flat_map<Key, T, Compare, Alloc>::at(const key_type &k)
+{
+	iterator it = this->find(k);
+
+	if (it == this->end())
+		throw std::out_of_range("flat_map");
+	return it->second;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+const typename flat_map<Key, T, Compare, Alloc>::mapped_type&
+flat_map<Key, T, Compare, Alloc>::at(const key_type &k) const
+{
+	const_iterator it = this->find(k);
+
+	if (it == this->end())
+		throw std::out_of_range("flat_map");
+	return it->second;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+ft::pair<typename flat_map<Key, T, Compare, Alloc>::iterator, bool>
+flat_map<Key, T, Compare, Alloc>::insert(const value_type &val) {
+	size_type i = this->__lower_index(val.first);
+
+	if (i < this->size() && !this->_key_cmp(val.first, this->_keys[i]))
+		return ft::make_pair(this->begin() + i, false);
+	this->_keys.insert(this->_keys.begin() + i, val.first);
+	this->_vals.insert(this->_vals.begin() + i, val.second);
+	return ft::make_pair(this->begin() + i, true);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::iterator
+flat_map<Key, T, Compare, Alloc>::insert(iterator, const value_type &val) {
+	return this->insert(val).first;
+}
+
+//새 값을 모아 정렬하고 같은 키는 처음 것만 남긴 뒤 기존 배열과 한 번에 병합한다.
+template <class Key, class T, class Compare, class Alloc> template <class Ite>
+void	flat_map<Key, T, Compare, Alloc>::insert(Ite first, Ite last) {
+	ft::vector<entry_type> buf;
+	size_type n = 0;
+
+	for (; first != last; ++first)
+		buf.push_back(entry_type((*first).first, (*first).second));
+	ft::stable_sort(buf.begin(), buf.end(), __entry_less(this->_key_cmp));
+	for (size_type i = 0; i < buf.size(); i++)
+	{
+		if (n == 0 || this->_key_cmp(buf[n - 1].first, buf[i].first))
+			buf[n++] = buf[i];
+	}
+	buf.erase(buf.begin() + n, buf.end());
+	this->__merge_sorted(buf);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	flat_map<Key, T, Compare, Alloc>::__merge_sorted(ft::vector<entry_type> &buf) {
+	ft::vector<key_type> keys;
+	ft::vector<mapped_type> vals;
+	size_type i = 0, j = 0;
+
+	keys.reserve(this->size() + buf.size());
+	vals.reserve(this->size() + buf.size());
+	while (i < this->size() || j < buf.size())
+	{
+		if (j == buf.size() || (i < this->size() && !this->_key_cmp(buf[j].first, this->_keys[i])))
+		{
+			//키가 같으면 기존 값을 남긴다.
+			if (j < buf.size() && !this->_key_cmp(this->_keys[i], buf[j].first))
+				++j;
+			keys.push_back(this->_keys[i]);
+			vals.push_back(this->_vals[i]);
+			++i;
+		}
+		else
+		{
+			keys.push_back(buf[j].first);
+			vals.push_back(buf[j].second);
+			++j;
+		}
+	}
+	this->_keys.swap(keys);
+	this->_vals.swap(vals);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	flat_map<Key, T, Compare, Alloc>::erase(iterator position)
+{
+	size_type i = position - this->begin();
+
+	this->_keys.erase(this->_keys.begin() + i);
+	this->_vals.erase(this->_vals.begin() + i);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::size_type
+flat_map<Key, T, Compare, Alloc>::erase(const key_type &k)
+{
+	iterator it = this->find(k);
+
+	if (it == this->end())
+		return 0;
+	this->erase(it);
+	return 1;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	flat_map<Key, T, Compare, Alloc>::erase(iterator first, iterator last)
+{
+	size_type i = first - this->begin(), j = last - this->begin();
+
+	this->_keys.erase(this->_keys.begin() + i, this->_keys.begin() + j);
+	this->_vals.erase(this->_vals.begin() + i, this->_vals.begin() + j);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	flat_map<Key, T, Compare, Alloc>::swap(flat_map &x) {
+	this->_keys.swap(x._keys);
+	this->_vals.swap(x._vals);
+	std::swap(this->_key_cmp, x._key_cmp);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	flat_map<Key, T, Compare, Alloc>::clear(void)
+{
+	this->_keys.clear();
+	this->_vals.clear();
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::key_compare
+flat_map<Key, T, Compare, Alloc>::key_comp(void) const {
+	return this->_key_cmp;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::value_compare
+flat_map<Key, T, Compare, Alloc>::value_comp(void) const {
+	return (value_compare(this->_key_cmp));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::size_type
+flat_map<Key, T, Compare, Alloc>::__lower_index(const key_type &k) const
+{
+	const key_type *keys = this->_keys.data();
+	size_type lo = 0, hi = this->size();
+
+	while (lo < hi)
+	{
+		size_type mid = lo + (hi - lo) / 2;
+		if (this->_key_cmp(keys[mid], k))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::size_type
+flat_map<Key, T, Compare, Alloc>::__upper_index(const key_type &k) const
+{
+	const key_type *keys = this->_keys.data();
+	size_type lo = 0, hi = this->size();
+
+	while (lo < hi)
+	{
+		size_type mid = lo + (hi - lo) / 2;
+		if (this->_key_cmp(k, keys[mid]))
+			hi = mid;
+		else
+			lo = mid + 1;
+	}
+	return lo;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::iterator
+flat_map<Key, T, Compare, Alloc>::find(const key_type &k)
+{
+	size_type i = this->__lower_index(k);
+
+	if (i == this->size() || this->_key_cmp(k, this->_keys[i]))
+		return this->end();
+	return this->begin() + i;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::const_iterator
+flat_map<Key, T, Compare, Alloc>::find(const key_type &k) const
+{
+	size_type i = this->__lower_index(k);
+
+	if (i == this->size() || this->_key_cmp(k, this->_keys[i]))
+		return this->end();
+	return this->begin() + i;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::size_type
+flat_map<Key, T, Compare, Alloc>::count(const key_type &k) const
+{
+	return this->find(k) != this->end();
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::iterator
+flat_map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) {
+	return this->begin() + this->__lower_index(k);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::const_iterator
+flat_map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) const {
+	return this->begin() + this->__lower_index(k);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::iterator
+flat_map<Key, T, Compare, Alloc>::upper_bound(const key_type &k) {
+	return this->begin() + this->__upper_index(k);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename flat_map<Key, T, Compare, Alloc>::const_iterator
+flat_map<Key, T, Compare, Alloc>::upper_bound(const key_type &k) const {
+	return this->begin() + this->__upper_index(k);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+ft::pair<typename flat_map<Key, T, Compare, Alloc>::const_iterator, typename flat_map<Key, T, Compare, Alloc>::const_iterator>
+flat_map<Key, T, Compare, Alloc>::equal_range(const key_type &k) const {
+	return ft::pair<const_iterator, const_iterator>(lower_bound(k),upper_bound(k));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+ft::pair<typename flat_map<Key, T, Compare, Alloc>::iterator, typename flat_map<Key, T, Compare, Alloc>::iterator>
+flat_map<Key, T, Compare, Alloc>::equal_range(const key_type &k) {
+	return ft::pair<iterator, iterator>(lower_bound(k),upper_bound(k));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+const ft::vector<typename flat_map<Key, T, Compare, Alloc>::key_type>&
+flat_map<Key, T, Compare, Alloc>::keys(void) const {
+	return this->_keys;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+const ft::vector<typename flat_map<Key, T, Compare, Alloc>::mapped_type>&
+flat_map<Key, T, Compare, Alloc>::values(void) const {
+	return this->_vals;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator==(const flat_map<Key, T, Compare, Alloc> &lhs,
+					const flat_map<Key, T, Compare, Alloc> &rhs)
+{
+	return lhs.keys() == rhs.keys() && lhs.values() == rhs.values();
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator!=(const flat_map<Key, T, Compare, Alloc> &lhs,
+					const flat_map<Key, T, Compare, Alloc> &rhs) {
+	return !(lhs == rhs);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator< (const flat_map<Key, T, Compare, Alloc> &lhs,
+					const flat_map<Key, T, Compare, Alloc> &rhs) {
+	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator<=(const flat_map<Key, T, Compare, Alloc> &lhs,
+					const flat_map<Key, T, Compare, Alloc> &rhs) {
+	return !(rhs < lhs);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator> (const flat_map<Key, T, Compare, Alloc> &lhs,
+					const flat_map<Key, T, Compare, Alloc> &rhs) {
+	return (rhs < lhs);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator>=(const flat_map<Key, T, Compare, Alloc> &lhs,
+					const flat_map<Key, T, Compare, Alloc> &rhs) {
+	return !(lhs < rhs);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	swap(flat_map<Key, T, Compare, Alloc> &x, flat_map<Key, T, Compare, Alloc> &y) {
+	x.swap(y);
+}
+
+}
+
+#endif
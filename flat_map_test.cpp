@@ -0,0 +1,116 @@
+#include <map>
+#include <set>
+#include <string>
+#include <stdlib.h>
+#include "flat_map.hpp"
+#include "flat_set.hpp"
+#include "tester.hpp"
+
+static bool
+same(const ft::flat_map<int, int> &m, const std::map<int, int> &ref)
+{
+	if (m.size() != ref.size())
+		return false;
+	std::map<int, int>::const_iterator r = ref.begin();
+	for (ft::flat_map<int, int>::const_iterator it = m.begin(); it != m.end(); ++it, ++r)
+		if (it->first != r->first || it->second != r->second)
+			return false;
+	return true;
+}
+
+int main(void)
+{
+	srand(5);
+	ft::vector<ft::pair<int, int> > in;
+	std::map<int, int> ref;
+
+	//정렬되지 않은 입력을 한꺼번에 넣는다. 같은 키는 처음 것만 남는다.
+	for (int i = 0; i < 20000; i++)
+	{
+		int k = rand() % 8000;
+		in.push_back(ft::make_pair(k, i));
+		ref.insert(std::make_pair(k, i));
+	}
+	ft::flat_map<int, int> m(in.begin(), in.end());
+	FT_CHECK(same(m, ref));
+	FT_CHECK(m.keys().size() == m.values().size());
+
+	//이미 있는 키와 섞인 두 번째 묶음.
+	in.clear();
+	for (int i = 0; i < 5000; i++)
+	{
+		int k = rand() % 16000;
+		in.push_back(ft::make_pair(k, -i));
+		ref.insert(std::make_pair(k, -i));
+	}
+	m.insert(in.begin(), in.end());
+	FT_CHECK(same(m, ref));
+
+	for (int i = 0; i < 3000; i++)
+	{
+		int k = rand() % 16000;
+		FT_CHECK(m.count(k) == ref.count(k));
+		if (i % 3 == 0)
+			FT_CHECK(m.erase(k) == ref.erase(k));
+		else if (i % 3 == 1)
+		{
+			m[k] = i;
+			ref[k] = i;
+		}
+		else
+			FT_CHECK(m.insert(ft::make_pair(k, i)).second == ref.insert(std::make_pair(k, i)).second);
+	}
+	FT_CHECK(same(m, ref));
+	FT_CHECK(m.lower_bound(100)->first == ref.lower_bound(100)->first);
+	FT_CHECK(m.upper_bound(100)->first == ref.upper_bound(100)->first);
+
+	//역방향 반복자도 프록시 참조로 ->를 쓸 수 있다.
+	FT_CHECK(m.rbegin()->first == ref.rbegin()->first);
+	FT_CHECK(m.rbegin()->second == ref.rbegin()->second);
+	m.rbegin()->second = 12345;
+	FT_CHECK(m.at(ref.rbegin()->first) == 12345);
+	ref.rbegin()->second = 12345;
+	const ft::flat_map<int, int> &cm = m;
+	std::map<int, int>::reverse_iterator rr = ref.rbegin();
+	bool backward = true;
+	for (ft::flat_map<int, int>::const_reverse_iterator it = cm.rbegin(); it != cm.rend(); ++it, ++rr)
+		backward = backward && it->first == rr->first && it->second == rr->second;
+	FT_CHECK(backward);
+
+	bool thrown = false;
+	try { m.at(-1); } catch (const std::out_of_range &) { thrown = true; }
+	FT_CHECK(thrown);
+
+	ft::flat_map<int, int> copy(m);
+	m.erase(m.begin(), m.lower_bound(8000));
+	ref.erase(ref.begin(), ref.lower_bound(8000));
+	FT_CHECK(same(m, ref) && copy.size() > m.size());
+	copy.swap(m);
+	FT_CHECK(same(copy, ref));
+
+	ft::flat_map<std::string, std::string> names;
+	names["b"] = "2";
+	names["a"] = "1";
+	FT_CHECK(names.rbegin()->first == "b" && names.rbegin()->second.size() == 1);
+
+	ft::vector<int> keys;
+	std::set<int> sref;
+	for (int i = 0; i < 10000; i++)
+	{
+		keys.push_back(rand() % 3000);
+		sref.insert(keys.back());
+	}
+	ft::flat_set<int> s(keys.begin(), keys.end());
+	FT_CHECK(s.size() == sref.size() && std::equal(sref.begin(), sref.end(), s.begin()));
+	FT_CHECK(*s.rbegin() == *sref.rbegin());
+	for (int i = 0; i < 2000; i++)
+	{
+		int k = rand() % 4000;
+		if (i % 2)
+			FT_CHECK(s.erase(k) == sref.erase(k));
+		else
+			FT_CHECK(s.insert(k).second == sref.insert(k).second);
+	}
+	FT_CHECK(s.size() == sref.size() && std::equal(sref.begin(), sref.end(), s.begin()));
+	return ft_test::result("flat_map");
+}
@@ -0,0 +1,395 @@
+#ifndef FLAT_SET_CLASS_HPP
+# define FLAT_SET_CLASS_HPP
+
+# include "vector.hpp"
+# include "reverse_iterator.hpp"
+# include "radix_sort.hpp"
+
+namespace ft
+{
+//정렬된 ft::vector 위의 셋. 이진탐색으로 찾고, 순회는 배열을 그대로 읽는다.
+//하나씩 넣고 빼는 것은 O(n)이므로 여러 개는 범위 insert로 한꺼번에 넣는다.
+template < class Key, class Compare = std::less<Key>, class Alloc = std::allocator< Key > >
+class flat_set
+{
+public:
+	typedef Key											key_type;
+	typedef Key											value_type;
+	typedef Compare										key_compare;
+	typedef Compare										value_compare;
+
+	typedef Alloc										allocator_type;
+	typedef typename allocator_type::reference			reference;
+	typedef typename allocator_type::const_reference	const_reference;
+	typedef typename allocator_type::pointer			pointer;
+	typedef typename allocator_type::const_pointer		const_pointer;
+	typedef ptrdiff_t									difference_type;
+	typedef size_t										size_type;
+
+	typedef typename ft::vector<Key, Alloc>::const_iterator	iterator;
+	typedef typename ft::vector<Key, Alloc>::const_iterator	const_iterator;
+	typedef ft::reverse_iterator<iterator>				reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	explicit flat_set(const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	template <class Ite>
+	flat_set(typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+			Ite last, const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	flat_set(const flat_set &src);
+	virtual ~flat_set(void);
+
+	flat_set	&operator=(flat_set const &rhs);
+
+	iterator				begin(void) const;
+	iterator				end(void) const;
+	reverse_iterator		rbegin(void) const;
+	reverse_iterator		rend(void) const;
+
+	size_type	size(void) const;
+	size_type	max_size(void) const;
+	bool		empty(void) const;
+	void		reserve(size_type n);
+
+	ft::pair<iterator, bool>	insert(const value_type &val);
+	iterator					insert(iterator position, const value_type &val);
+	template <class Ite> void	insert(Ite first, Ite last);
+
+	void		erase(iterator position);
+	size_type	erase(const key_type &k);
+	void		erase(iterator first, iterator last);
+
+	void		swap(flat_set &x);
+	void		clear(void);
+
+	key_compare		key_comp(void) const;
+	value_compare	value_comp(void) const;
+
+	iterator		find(const key_type &k) const;
+	size_type		count(const key_type &k) const;
+
+	iterator		lower_bound(const key_type &k) const;
+	iterator		upper_bound(const key_type &k) const;
+	pair<iterator,iterator>	equal_range(const key_type &k) const;
+
+	const ft::vector<key_type, allocator_type>	&keys(void) const;
+
+private:
+	ft::vector<key_type, allocator_type>	_keys;
+	key_compare								_key_cmp;
+
+	size_type	__lower_index(const key_type &k) const;
+	size_type	__upper_index(const key_type &k) const;
+	void		__merge_sorted(ft::vector<key_type, allocator_type> &buf);
+
+};
+
+template <class Key, class Compare, class Alloc>
+flat_set<Key, Compare, Alloc>::flat_set(const key_compare &comp, const allocator_type &alloc) : \
+		_keys(alloc), _key_cmp(comp)
+{
+}
+
+template <class Key, class Compare, class Alloc> template <class Ite>
+flat_set<Key, Compare, Alloc>::flat_set(
+	typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+	Ite last, const key_compare &comp, const allocator_type &alloc) : \
+		_keys(alloc), _key_cmp(comp)
+{
+	this->insert(first, last);
+}
+
+template <class Key, class Compare, class Alloc>
+flat_set<Key, Compare, Alloc>::flat_set(flat_set const &src) : \
+		_keys(src._keys), _key_cmp(src._key_cmp)
+{
+}
+
+template <class Key, class Compare, class Alloc>
+flat_set<Key, Compare, Alloc>::~flat_set(void) {
+}
+
+template <class Key, class Compare, class Alloc>
+flat_set<Key, Compare, Alloc>&
+flat_set<Key, Compare, Alloc>::operator=(flat_set const &rhs) {
+	if (this == &rhs)
+		return (*this);
+	this->_keys = rhs._keys;
+	this->_key_cmp = rhs._key_cmp;
+	return (*this);
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::iterator
+flat_set<Key, Compare, Alloc>::begin(void) const {
+	return this->_keys.begin();
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::iterator
+flat_set<Key, Compare, Alloc>::end(void) const {
+	return this->_keys.end();
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::reverse_iterator
+flat_set<Key, Compare, Alloc>::rbegin(void) const {
+	return reverse_iterator(this->end());
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::reverse_iterator
+flat_set<Key, Compare, Alloc>::rend(void) const {
+	return reverse_iterator(this->begin());
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::size_type
+flat_set<Key, Compare, Alloc>::size(void) const {
+	return this->_keys.size();
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::size_type
+flat_set<Key, Compare, Alloc>::max_size(void) const {
+	return this->_keys.max_size();
+}
+
+template <class Key, class Compare, class Alloc>
+bool	flat_set<Key, Compare, Alloc>::empty(void) const {
+	return (this->_keys.size() == 0);
+}
+
+template <class Key, class Compare, class Alloc>
+void	flat_set<Key, Compare, Alloc>::reserve(size_type n) {
+	this->_keys.reserve(n);
+}
+
+template <class Key, class Compare, class Alloc>
+ft::pair<typename flat_set<Key, Compare, Alloc>::iterator, bool>
+flat_set<Key, Compare, Alloc>::insert(const value_type &val) {
+	size_type i = this->__lower_index(val);
+
+	if (i < this->size() && !this->_key_cmp(val, this->_keys[i]))
+		return ft::make_pair(this->begin() + i, false);
+	this->_keys.insert(this->_keys.begin() + i, val);
+	return ft::make_pair(this->begin() + i, true);
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::iterator
+flat_set<Key, Compare, Alloc>::insert(iterator, const value_type &val) {
+	return this->insert(val).first;
+}
+
+//새 값을 모아 정렬하고 중복을 지운 뒤 기존 배열과 한 번에 병합한다.
+template <class Key, class Compare, class Alloc> template <class Ite>
+void	flat_set<Key, Compare, Alloc>::insert(Ite first, Ite last) {
+	ft::vector<key_type, allocator_type> buf;
+	size_type n = 0;
+
+	for (; first != last; ++first)
+		buf.push_back(*first);
+	ft::sort(buf.begin(), buf.end(), this->_key_cmp);
+	for (size_type i = 0; i < buf.size(); i++)
+	{
+		if (n == 0 || this->_key_cmp(buf[n - 1], buf[i]))
+			buf[n++] = buf[i];
+	}
+	buf.erase(buf.begin() + n, buf.end());
+	this->__merge_sorted(buf);
+}
+
+template <class Key, class Compare, class Alloc>
+void	flat_set<Key, Compare, Alloc>::__merge_sorted(ft::vector<key_type, allocator_type> &buf) {
+	ft::vector<key_type, allocator_type> keys;
+	size_type i = 0, j = 0;
+
+	keys.reserve(this->size() + buf.size());
+	while (i < this->size() || j < buf.size())
+	{
+		if (j == buf.size() || (i < this->size() && !this->_key_cmp(buf[j], this->_keys[i])))
+		{
+			if (j < buf.size() && !this->_key_cmp(this->_keys[i], buf[j]))
+				++j;
+			keys.push_back(this->_keys[i++]);
+		}
+		else
+			keys.push_back(buf[j++]);
+	}
+	this->_keys.swap(keys);
+}
+
+template <class Key, class Compare, class Alloc>
+void	flat_set<Key, Compare, Alloc>::erase(iterator position)
+{
+	this->_keys.erase(this->_keys.begin() + (position - this->begin()));
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::size_type
+flat_set<Key, Compare, Alloc>::erase(const key_type &k)
+{
+	iterator it = this->find(k);
+
+	if (it == this->end())
+		return 0;
+	this->erase(it);
+	return 1;
+}
+
+template <class Key, class Compare, class Alloc>
+void	flat_set<Key, Compare, Alloc>::erase(iterator first, iterator last)
+{
+	this->_keys.erase(this->_keys.begin() + (first - this->begin()),
+			this->_keys.begin() + (last - this->begin()));
+}
+
+template <class Key, class Compare, class Alloc>
+void	flat_set<Key, Compare, Alloc>::swap(flat_set &x) {
+	this->_keys.swap(x._keys);
+	std::swap(this->_key_cmp, x._key_cmp);
+}
+
+template <class Key, class Compare, class Alloc>
+void	flat_set<Key, Compare, Alloc>::clear(void)
+{
+	this->_keys.clear();
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::key_compare
+flat_set<Key, Compare, Alloc>::key_comp(void) const {
+	return this->_key_cmp;
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::value_compare
+flat_set<Key, Compare, Alloc>::value_comp(void) const {
+	return this->_key_cmp;
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::size_type
+flat_set<Key, Compare, Alloc>::__lower_index(const key_type &k) const
+{
+	const key_type *keys = this->_keys.data();
+	size_type lo = 0, hi = this->size();
+
+	while (lo < hi)
+	{
+		size_type mid = lo + (hi - lo) / 2;
+		if (this->_key_cmp(keys[mid], k))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::size_type
+flat_set<Key, Compare, Alloc>::__upper_index(const key_type &k) const
+{
+	const key_type *keys = this->_keys.data();
+	size_type lo = 0, hi = this->size();
+
+	while (lo < hi)
+	{
+		size_type mid = lo + (hi - lo) / 2;
+		if (this->_key_cmp(k, keys[mid]))
+			hi = mid;
+		else
+			lo = mid + 1;
+	}
+	return lo;
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::iterator
+flat_set<Key, Compare, Alloc>::find(const key_type &k) const
+{
+	size_type i = this->__lower_index(k);
+
+	if (i == this->size() || this->_key_cmp(k, this->_keys[i]))
+		return this->end();
+	return this->begin() + i;
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::size_type
+flat_set<Key, Compare, Alloc>::count(const key_type &k) const
+{
+	return this->find(k) != this->end();
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::iterator
+flat_set<Key, Compare, Alloc>::lower_bound(const key_type &k) const {
+	return this->begin() + this->__lower_index(k);
+}
+
+template <class Key, class Compare, class Alloc>
+typename flat_set<Key, Compare, Alloc>::iterator
+flat_set<Key, Compare, Alloc>::upper_bound(const key_type &k) const {
+	return this->begin() + this->__upper_index(k);
+}
+
+template <class Key, class Compare, class Alloc>
+ft::pair<typename flat_set<Key, Compare, Alloc>::iterator, typename flat_set<Key, Compare, Alloc>::iterator>
+flat_set<Key, Compare, Alloc>::equal_range(const key_type &k) const {
+	return ft::pair<iterator, iterator>(lower_bound(k),upper_bound(k));
+}
+
+template <class Key, class Compare, class Alloc>
+const ft::vector<typename flat_set<Key, Compare, Alloc>::key_type, Alloc>&
+flat_set<Key, Compare, Alloc>::keys(void) const {
+	return this->_keys;
+}
+
+template <class Key, class Compare, class Alloc>
+bool	operator==(const flat_set<Key, Compare, Alloc> &lhs,
+					const flat_set<Key, Compare, Alloc> &rhs)
+{
+	return lhs.keys() == rhs.keys();
+}
+
+template <class Key, class Compare, class Alloc>
+bool	operator!=(const flat_set<Key, Compare, Alloc> &lhs,
+					const flat_set<Key, Compare, Alloc> &rhs) {
+	return !(lhs == rhs);
+}
+
+template <class Key, class Compare, class Alloc>
+bool	operator< (const flat_set<Key, Compare, Alloc> &lhs,
+					const flat_set<Key, Compare, Alloc> &rhs) {
+	return lhs.keys() < rhs.keys();
+}
+
+template <class Key, class Compare, class Alloc>
+bool	operator<=(const flat_set<Key, Compare, Alloc> &lhs,
+					const flat_set<Key, Compare, Alloc> &rhs) {
+	return !(rhs < lhs);
+}
+
+template <class Key, class Compare, class Alloc>
+bool	operator> (const flat_set<Key, Compare, Alloc> &lhs,
+					const flat_set<Key, Compare, Alloc> &rhs) {
+	return (rhs < lhs);
+}
+
+template <class Key, class Compare, class Alloc>
+bool	operator>=(const flat_set<Key, Compare, Alloc> &lhs,
+					const flat_set<Key, Compare, Alloc> &rhs) {
+	return !(lhs < rhs);
+}
+
+template <class Key, class Compare, class Alloc>
+void	swap(flat_set<Key, Compare, Alloc> &x, flat_set<Key, Compare, Alloc> &y) {
+	x.swap(y);
+}
+
+}
+
+#endif
@@ -0,0 +1,293 @@
+#ifndef FROZEN_MAP_CLASS_HPP
+# define FROZEN_MAP_CLASS_HPP
+
+# include <stdexcept>
+# include "map.hpp"
+# include "flat_map.hpp"
+# include "eytzinger.hpp"
+
+namespace ft
+{
+//더 이상 바뀌지 않는 맵을 위한 읽기 전용 색인. 키와 값을 같은 Eytzinger 순서로 따로 된 배열에 둔다.
+//조회는 키 배열만 읽고, 찾은 칸 번호로 값 배열을 한 번 읽는다.
+template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< ft::pair<const Key,T> > >
+class frozen_map
+{
+public:
+	typedef Key											key_type;
+	typedef T											mapped_type;
+	typedef ft::pair<const key_type, mapped_type>		value_type;
+	typedef Compare										key_compare;
+	typedef Alloc										allocator_type;
+	typedef ft::__flat_ref<Key, const T>				reference;
+	typedef ft::__flat_ref<Key, const T>				const_reference;
+	typedef ft::__arrow_proxy<const_reference>			pointer;
+	typedef ft::__arrow_proxy<const_reference>			const_pointer;
+	typedef ptrdiff_t									difference_type;
+	typedef size_t										size_type;
+
+	typedef ft::__frozen_iterator<frozen_map>			iterator;
+	typedef ft::__frozen_iterator<frozen_map>			const_iterator;
+
+	explicit frozen_map(const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	explicit frozen_map(const ft::map<Key, T, Compare, Alloc> &src);
+	template <class Ite>
+	frozen_map(typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+			Ite last, const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	frozen_map(const frozen_map &src);
+	virtual ~frozen_map(void);
+
+	frozen_map	&operator=(frozen_map const &rhs);
+
+	iterator	begin(void) const;
+	iterator	end(void) const;
+
+	size_type	size(void) const;
+	bool		empty(void) const;
+
+	const mapped_type	&at(const key_type &k) const;
+
+	void		swap(frozen_map &x);
+	void		clear(void);
+
+	key_compare		key_comp(void) const;
+
+	iterator	find(const key_type &k) const;
+	size_type	count(const key_type &k) const;
+	iterator	lower_bound(const key_type &k) const;
+
+	const_reference	__slot(size_type k) const;
+	const_pointer	__arrow(size_type k) const;
+
+private:
+	typedef typename Alloc::template rebind<Key>::other		key_allocator;
+	typedef typename Alloc::template rebind<T>::other		mapped_allocator;
+	typedef ft::pair<key_type, mapped_type>					entry_type;
+
+	struct __entry_less
+	{
+		Compare	comp;
+
+		__entry_less(const Compare &c) : comp(c) {}
+
+		bool
+		operator()(const entry_type &x, const entry_type &y) const
+		{ return comp(x.first, y.first); }
+	};
+
+	//_keys[1..size], _vals[1..size]만 쓴다.
+	Key					*_keys;
+	T					*_vals;
+	size_type			_size;
+	key_compare			_key_cmp;
+	key_allocator		_key_alloc;
+	mapped_allocator	_val_alloc;
+
+	struct __fill_entry
+	{
+		frozen_map	*self;
+
+		template <class Entry>
+		void
+		operator()(size_type k, const Entry &val)
+		{
+			self->_key_alloc.construct(self->_keys + k, val.first);
+			self->_val_alloc.construct(self->_vals + k, val.second);
+		}
+	};
+
+	template <class Ite> void	__build(Ite first, size_type n);
+	size_type					__index(const key_type &k) const;
+
+};
+
+template <class Key, class T, class Compare, class Alloc>
+frozen_map<Key, T, Compare, Alloc>::frozen_map(const key_compare &comp, const allocator_type &) : \
+		_keys(NULL), _vals(NULL), _size(0), _key_cmp(comp)
+{
+}
+
+template <class Key, class T, class Compare, class Alloc>
+frozen_map<Key, T, Compare, Alloc>::frozen_map(const ft::map<Key, T, Compare, Alloc> &src) : \
+		_keys(NULL), _vals(NULL), _size(0), _key_cmp(src.key_comp())
+{
+	this->__build(src.begin(), src.size());
+}
+
+//정렬되지 않은 범위는 먼저 정렬하고 같은 키는 처음 것만 남긴다.
+template <class Key, class T, class Compare, class Alloc> template <class Ite>
+frozen_map<Key, T, Compare, Alloc>::frozen_map(
+	typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+	Ite last, const key_compare &comp, const allocator_type &) : \
+		_keys(NULL), _vals(NULL), _size(0), _key_cmp(comp)
+{
+	ft::vector<entry_type> buf;
+	size_type n = 0;
+
+	for (; first != last; ++first)
+		buf.push_back(entry_type((*first).first, (*first).second));
+	ft::stable_sort(buf.begin(), buf.end(), __entry_less(this->_key_cmp));
+	for (size_type i = 0; i < buf.size(); i++)
+	{
+		if (n == 0 || this->_key_cmp(buf[n - 1].first, buf[i].first))
+			buf[n++] = buf[i];
+	}
+	this->__build(buf.begin(), n);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+frozen_map<Key, T, Compare, Alloc>::frozen_map(frozen_map const &src) : \
+		_keys(NULL), _vals(NULL), _size(0), _key_cmp(src._key_cmp)
+{
+	this->__build(src.begin(), src.size());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+frozen_map<Key, T, Compare, Alloc>::~frozen_map(void) {
+	this->clear();
+}
+
+template <class Key, class T, class Compare, class Alloc>
+frozen_map<Key, T, Compare, Alloc>&
+frozen_map<Key, T, Compare, Alloc>::operator=(frozen_map const &rhs) {
+	if (this == &rhs)
+		return (*this);
+	this->clear();
+	this->_key_cmp = rhs._key_cmp;
+	this->__build(rhs.begin(), rhs.size());
+	return (*this);
+}
+
+template <class Key, class T, class Compare, class Alloc> template <class Ite>
+void	frozen_map<Key, T, Compare, Alloc>::__build(Ite first, size_type n) {
+	__fill_entry fill;
+
+	if (n == 0)
+		return ;
+	this->_keys = this->_key_alloc.allocate(n + 1);
+	this->_vals = this->_val_alloc.allocate(n + 1);
+	this->_size = n;
+	fill.self = this;
+	ft::__eytz_fill(first, n, fill);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename frozen_map<Key, T, Compare, Alloc>::iterator
+frozen_map<Key, T, Compare, Alloc>::begin(void) const {
+	return iterator(this, ft::__eytz_first(this->_size));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename frozen_map<Key, T, Compare, Alloc>::iterator
+frozen_map<Key, T, Compare, Alloc>::end(void) const {
+	return iterator(this, 0);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename frozen_map<Key, T, Compare, Alloc>::size_type
+frozen_map<Key, T, Compare, Alloc>::size(void) const {
+	return this->_size;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	frozen_map<Key, T, Compare, Alloc>::empty(void) const {
+	return (this->_size == 0);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+const typename frozen_map<Key, T, Compare, Alloc>::mapped_type&
+frozen_map<Key, T, Compare, Alloc>::at(const key_type &k) const
+{
+	size_type i = this->__index(k);
+
+	if (i == 0)
+		throw std::out_of_range("frozen_map");
+	return this->_vals[i];
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	frozen_map<Key, T, Compare, Alloc>::swap(frozen_map &x) {
+	std::swap(this->_keys, x._keys);
+	std::swap(this->_vals, x._vals);
+	std::swap(this->_size, x._size);
+	std::swap(this->_key_cmp, x._key_cmp);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	frozen_map<Key, T, Compare, Alloc>::clear(void)
+{
+	if (this->_keys == NULL)
+		return ;
+	for (size_type k = 1; k <= this->_size; k++)
+	{
+		this->_key_alloc.destroy(this->_keys + k);
+		this->_val_alloc.destroy(this->_vals + k);
+	}
+	this->_key_alloc.deallocate(this->_keys, this->_size + 1);
+	this->_val_alloc.deallocate(this->_vals, this->_size + 1);
+	this->_keys = NULL;
+	this->_vals = NULL;
+	this->_size = 0;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename frozen_map<Key, T, Compare, Alloc>::key_compare
+frozen_map<Key, T, Compare, Alloc>::key_comp(void) const {
+	return this->_key_cmp;
+}
+
+//k가 있는 칸 번호. 없으면 0.
+template <class Key, class T, class Compare, class Alloc>
+typename frozen_map<Key, T, Compare, Alloc>::size_type
+frozen_map<Key, T, Compare, Alloc>::__index(const key_type &k) const
+{
+	size_type i = ft::__eytz_lower_bound(this->_keys, this->_size, k, this->_key_cmp);
+
+	if (i == 0 || this->_key_cmp(k, this->_keys[i]))
+		return 0;
+	return i;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename frozen_map<Key, T, Compare, Alloc>::iterator
+frozen_map<Key, T, Compare, Alloc>::find(const key_type &k) const
+{
+	return iterator(this, this->__index(k));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename frozen_map<Key, T, Compare, Alloc>::size_type
+frozen_map<Key, T, Compare, Alloc>::count(const key_type &k) const
+{
+	return this->__index(k) != 0;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename frozen_map<Key, T, Compare, Alloc>::iterator
+frozen_map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) const
+{
+	return iterator(this, ft::__eytz_lower_bound(this->_keys, this->_size, k, this->_key_cmp));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename frozen_map<Key, T, Compare, Alloc>::const_reference
+frozen_map<Key, T, Compare, Alloc>::__slot(size_type k) const {
+	return const_reference(this->_keys[k], this->_vals[k]);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename frozen_map<Key, T, Compare, Alloc>::const_pointer
+frozen_map<Key, T, Compare, Alloc>::__arrow(size_type k) const {
+	return const_pointer(this->__slot(k));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	swap(frozen_map<Key, T, Compare, Alloc> &x, frozen_map<Key, T, Compare, Alloc> &y) {
+	x.swap(y);
+}
+
+}
+
+#endif
@@ -0,0 +1,88 @@
+#include <map>
+#include <set>
+#include <string>
+#include <stdlib.h>
+#include "frozen_map.hpp"
+#include "frozen_set.hpp"
+#include "tester.hpp"
+
+int main(void)
+{
+	srand(9);
+	//Eytzinger 배치는 크기마다 마지막 층 모양이 달라서 여러 크기를 본다.
+	size_t sizes[] = {0, 1, 2, 3, 7, 8, 15, 16, 17, 1000, 65537};
+
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+	{
+		ft::set<int> src;
+		std::set<int> ref;
+		while (src.size() < sizes[s])
+		{
+			int k = rand() % 1000000;
+			src.insert(k);
+			ref.insert(k);
+		}
+		ft::frozen_set<int> f(src);
+		FT_CHECK(f.size() == ref.size() && f.empty() == ref.empty());
+		FT_CHECK(std::equal(ref.begin(), ref.end(), f.begin()));
+		bool ok = true;
+		for (int i = 0; i < 2000; i++)
+		{
+			int k = rand() % 1000001 - 1;
+			ok = ok && f.count(k) == ref.count(k);
+			ft::frozen_set<int>::iterator lb = f.lower_bound(k);
+			std::set<int>::iterator rlb = ref.lower_bound(k);
+			ok = ok && (lb == f.end()) == (rlb == ref.end());
+			if (lb != f.end() && rlb != ref.end())
+				ok = ok && *lb == *rlb;
+		}
+		FT_CHECK(ok);
+	}
+
+	//정렬되지 않은 범위에서 만들면 정렬하고 같은 키는 처음 것만 남긴다.
+	ft::vector<ft::pair<int, std::string> > in;
+	std::map<int, std::string> ref;
+	for (int i = 0; i < 5000; i++)
+	{
+		int k = rand() % 2000;
+		std::string v(1 + i % 5, static_cast<char>('a' + i % 26));
+		in.push_back(ft::make_pair(k, v));
+		ref.insert(std::make_pair(k, v));
+	}
+	ft::frozen_map<int, std::string> m(in.begin(), in.end());
+	FT_CHECK(m.size() == ref.size());
+	bool ok = true;
+	std::map<int, std::string>::iterator r = ref.begin();
+	for (ft::frozen_map<int, std::string>::iterator it = m.begin(); it != m.end(); ++it, ++r)
+		ok = ok && it->first == r->first && it->second == r->second;
+	FT_CHECK(ok);
+	for (int k = -1; k <= 2000; k++)
+	{
+		ft::frozen_map<int, std::string>::iterator it = m.find(k);
+		if (ref.count(k))
+			ok = ok && it != m.end() && it->second == ref[k] && m.at(k) == ref[k];
+		else
+			ok = ok && it == m.end() && m.count(k) == 0;
+	}
+	FT_CHECK(ok);
+	bool thrown = false;
+	try { m.at(-5); } catch (const std::out_of_range &) { thrown = true; }
+	FT_CHECK(thrown);
+
+	//ft::map에서 바로 얼리기. 원본과 따로 산다.
+	ft::map<int, int> src;
+	for (int i = 0; i < 1000; i++)
+		src[i * 3] = i;
+	ft::frozen_map<int, int> fm(src);
+	src.clear();
+	FT_CHECK(fm.size() == 1000 && fm.at(2997) == 999 && fm.count(1) == 0);
+	ft::frozen_map<int, int> copy(fm);
+	ft::frozen_map<int, int> assigned;
+	assigned = copy;
+	fm.clear();
+	FT_CHECK(fm.empty() && fm.begin() == fm.end());
+	FT_CHECK(assigned.size() == 1000 && assigned.at(300) == 100);
+	assigned.swap(fm);
+	FT_CHECK(assigned.empty() && fm.at(3) == 1);
+	return ft_test::result("frozen_map");
+}
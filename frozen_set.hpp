@@ -0,0 +1,250 @@
+#ifndef FROZEN_SET_CLASS_HPP
+# define FROZEN_SET_CLASS_HPP
+
+# include "set.hpp"
+# include "eytzinger.hpp"
+
+namespace ft
+{
+//더 이상 바뀌지 않는 셋을 위한 읽기 전용 색인. 키를 Eytzinger 순서로 연속된 배열에 둔다.
+//ft::set에서 만들면 이미 정렬되어 있으므로 O(n)이고, 조회는 분기 없이 내려가며 두 레벨 앞을 미리 읽는다.
+template < class Key, class Compare = std::less<Key>, class Alloc = std::allocator< Key > >
+class frozen_set
+{
+public:
+	typedef Key											key_type;
+	typedef Key											value_type;
+	typedef Compare										key_compare;
+	typedef Compare										value_compare;
+	typedef Alloc										allocator_type;
+	typedef typename allocator_type::const_reference	reference;
+	typedef typename allocator_type::const_reference	const_reference;
+	typedef typename allocator_type::const_pointer		pointer;
+	typedef typename allocator_type::const_pointer		const_pointer;
+	typedef ptrdiff_t									difference_type;
+	typedef size_t										size_type;
+
+	typedef ft::__frozen_iterator<frozen_set>			iterator;
+	typedef ft::__frozen_iterator<frozen_set>			const_iterator;
+
+	explicit frozen_set(const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	explicit frozen_set(const ft::set<Key, Compare, Alloc> &src);
+	template <class Ite>
+	frozen_set(typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+			Ite last, const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	frozen_set(const frozen_set &src);
+	virtual ~frozen_set(void);
+
+	frozen_set	&operator=(frozen_set const &rhs);
+
+	iterator	begin(void) const;
+	iterator	end(void) const;
+
+	size_type	size(void) const;
+	bool		empty(void) const;
+
+	void		swap(frozen_set &x);
+	void		clear(void);
+
+	key_compare		key_comp(void) const;
+	value_compare	value_comp(void) const;
+
+	iterator	find(const key_type &k) const;
+	size_type	count(const key_type &k) const;
+	iterator	lower_bound(const key_type &k) const;
+
+	const_reference	__slot(size_type k) const;
+	const_pointer	__arrow(size_type k) const;
+
+private:
+	//_keys[1..size]만 쓴다.
+	Key				*_keys;
+	size_type		_size;
+	key_compare		_key_cmp;
+	allocator_type	_alloc;
+
+	struct __fill_key
+	{
+		frozen_set	*self;
+
+		void
+		operator()(size_type k, const Key &val)
+		{ self->_alloc.construct(self->_keys + k, val); }
+	};
+
+	template <class Ite> void	__build(Ite first, size_type n);
+
+};
+
+template <class Key, class Compare, class Alloc>
+frozen_set<Key, Compare, Alloc>::frozen_set(const key_compare &comp, const allocator_type &alloc) : \
+		_keys(NULL), _size(0), _key_cmp(comp), _alloc(alloc)
+{
+}
+
+template <class Key, class Compare, class Alloc>
+frozen_set<Key, Compare, Alloc>::frozen_set(const ft::set<Key, Compare, Alloc> &src) : \
+		_keys(NULL), _size(0), _key_cmp(src.key_comp())
+{
+	this->__build(src.begin(), src.size());
+}
+
+//정렬되지 않은 범위는 먼저 정렬하고 중복을 지운다.
+template <class Key, class Compare, class Alloc> template <class Ite>
+frozen_set<Key, Compare, Alloc>::frozen_set(
+	typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+	Ite last, const key_compare &comp, const allocator_type &alloc) : \
+		_keys(NULL), _size(0), _key_cmp(comp), _alloc(alloc)
+{
+	ft::vector<Key> buf;
+	size_type n = 0;
+
+	for (; first != last; ++first)
+		buf.push_back(*first);
+	ft::sort(buf.begin(), buf.end(), this->_key_cmp);
+	for (size_type i = 0; i < buf.size(); i++)
+	{
+		if (n == 0 || this->_key_cmp(buf[n - 1], buf[i]))
+			buf[n++] = buf[i];
+	}
+	this->__build(buf.begin(), n);
+}
+
+template <class Key, class Compare, class Alloc>
+frozen_set<Key, Compare, Alloc>::frozen_set(frozen_set const &src) : \
+		_keys(NULL), _size(0), _key_cmp(src._key_cmp), _alloc(src._alloc)
+{
+	this->__build(src.begin(), src.size());
+}
+
+template <class Key, class Compare, class Alloc>
+frozen_set<Key, Compare, Alloc>::~frozen_set(void) {
+	this->clear();
+}
+
+template <class Key, class Compare, class Alloc>
+frozen_set<Key, Compare, Alloc>&
+frozen_set<Key, Compare, Alloc>::operator=(frozen_set const &rhs) {
+	if (this == &rhs)
+		return (*this);
+	this->clear();
+	this->_key_cmp = rhs._key_cmp;
+	this->__build(rhs.begin(), rhs.size());
+	return (*this);
+}
+
+template <class Key, class Compare, class Alloc> template <class Ite>
+void	frozen_set<Key, Compare, Alloc>::__build(Ite first, size_type n) {
+	__fill_key fill;
+
+	if (n == 0)
+		return ;
+	this->_keys = this->_alloc.allocate(n + 1);
+	this->_size = n;
+	fill.self = this;
+	ft::__eytz_fill(first, n, fill);
+}
+
+template <class Key, class Compare, class Alloc>
+typename frozen_set<Key, Compare, Alloc>::iterator
+frozen_set<Key, Compare, Alloc>::begin(void) const {
+	return iterator(this, ft::__eytz_first(this->_size));
+}
+
+template <class Key, class Compare, class Alloc>
+typename frozen_set<Key, Compare, Alloc>::iterator
+frozen_set<Key, Compare, Alloc>::end(void) const {
+	return iterator(this, 0);
+}
+
+template <class Key, class Compare, class Alloc>
+typename frozen_set<Key, Compare, Alloc>::size_type
+frozen_set<Key, Compare, Alloc>::size(void) const {
+	return this->_size;
+}
+
+template <class Key, class Compare, class Alloc>
+bool	frozen_set<Key, Compare, Alloc>::empty(void) const {
+	return (this->_size == 0);
+}
+
+template <class Key, class Compare, class Alloc>
+void	frozen_set<Key, Compare, Alloc>::swap(frozen_set &x) {
+	std::swap(this->_keys, x._keys);
+	std::swap(this->_size, x._size);
+	std::swap(this->_key_cmp, x._key_cmp);
+}
+
+template <class Key, class Compare, class Alloc>
+void	frozen_set<Key, Compare, Alloc>::clear(void)
+{
+	if (this->_keys == NULL)
+		return ;
+	for (size_type k = 1; k <= this->_size; k++)
+		this->_alloc.destroy(this->_keys + k);
+	this->_alloc.deallocate(this->_keys, this->_size + 1);
+	this->_keys = NULL;
+	this->_size = 0;
+}
+
+template <class Key, class Compare, class Alloc>
+typename frozen_set<Key, Compare, Alloc>::key_compare
+frozen_set<Key, Compare, Alloc>::key_comp(void) const {
+	return this->_key_cmp;
+}
+
+template <class Key, class Compare, class Alloc>
+typename frozen_set<Key, Compare, Alloc>::value_compare
+frozen_set<Key, Compare, Alloc>::value_comp(void) const {
+	return this->_key_cmp;
+}
+
+template <class Key, class Compare, class Alloc>
+typename frozen_set<Key, Compare, Alloc>::iterator
+frozen_set<Key, Compare, Alloc>::find(const key_type &k) const
+{
+	size_type i = ft::__eytz_lower_bound(this->_keys, this->_size, k, this->_key_cmp);
+
+	if (i == 0 || this->_key_cmp(k, this->_keys[i]))
+		return this->end();
+	return iterator(this, i);
+}
+
+template <class Key, class Compare, class Alloc>
+typename frozen_set<Key, Compare, Alloc>::size_type
+frozen_set<Key, Compare, Alloc>::count(const key_type &k) const
+{
+	size_type i = ft::__eytz_lower_bound(this->_keys, this->_size, k, this->_key_cmp);
+
+	return i != 0 && !this->_key_cmp(k, this->_keys[i]);
+}
+
+template <class Key, class Compare, class Alloc>
+typename frozen_set<Key, Compare, Alloc>::iterator
+frozen_set<Key, Compare, Alloc>::lower_bound(const key_type &k) const
+{
+	return iterator(this, ft::__eytz_lower_bound(this->_keys, this->_size, k, this->_key_cmp));
+}
+
+template <class Key, class Compare, class Alloc>
+typename frozen_set<Key, Compare, Alloc>::const_reference
+frozen_set<Key, Compare, Alloc>::__slot(size_type k) const {
+	return this->_keys[k];
+}
+
+template <class Key, class Compare, class Alloc>
+typename frozen_set<Key, Compare, Alloc>::const_pointer
+frozen_set<Key, Compare, Alloc>::__arrow(size_type k) const {
+	return this->_keys + k;
+}
+
+template <class Key, class Compare, class Alloc>
+void	swap(frozen_set<Key, Compare, Alloc> &x, frozen_set<Key, Compare, Alloc> &y) {
+	x.swap(y);
+}
+
+}
+
+#endif
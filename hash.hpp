@@ -0,0 +1,87 @@
+#ifndef HASH_CLASS_HPP
+# define HASH_CLASS_HPP
+
+# include "utils.hpp"
+
+namespace ft
+{
+//64비트 값을 골고루 섞는다. (murmur3 fmix64)
+inline size_t
+__hash_mix(unsigned long long k)
+{
+	k ^= k >> 33;
+	k *= 0xff51afd7ed558ccdULL;
+	k ^= k >> 33;
+	k *= 0xc4ceb9fe1a85ec53ULL;
+	k ^= k >> 33;
+	return static_cast<size_t>(k);
+}
+
+//바이트열 해시. (FNV-1a 후 한 번 더 섞는다)
+inline size_t
+__hash_bytes(const void *p, size_t n)
+{
+	const unsigned char *s = static_cast<const unsigned char *>(p);
+	unsigned long long h = 0xcbf29ce484222325ULL;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		h ^= s[i];
+		h *= 0x100000001b3ULL;
+	}
+	return __hash_mix(h);
+}
+
+//해시 함수 객체. 정수와 포인터는 값을 섞고, 문자열은 내용을 해시한다.
+//다른 타입은 특수화를 추가해서 쓴다.
+template <typename T>
+struct hash;
+
+template <typename T>
+struct __integral_hash
+{
+	typedef T		argument_type;
+	typedef size_t	result_type;
+
+	size_t
+	operator()(const T &v) const
+	{ return __hash_mix(static_cast<unsigned long long>(v)); }
+};
+
+template <> struct hash<bool> : __integral_hash<bool> {};
+template <> struct hash<char> : __integral_hash<char> {};
+template <> struct hash<signed char> : __integral_hash<signed char> {};
+template <> struct hash<unsigned char> : __integral_hash<unsigned char> {};
+template <> struct hash<wchar_t> : __integral_hash<wchar_t> {};
+template <> struct hash<short> : __integral_hash<short> {};
+template <> struct hash<unsigned short> : __integral_hash<unsigned short> {};
+template <> struct hash<int> : __integral_hash<int> {};
+template <> struct hash<unsigned int> : __integral_hash<unsigned int> {};
+template <> struct hash<long> : __integral_hash<long> {};
+template <> struct hash<unsigned long> : __integral_hash<unsigned long> {};
+
+template <typename T>
+struct hash<T*>
+{
+	typedef T*		argument_type;
+	typedef size_t	result_type;
+
+	size_t
+	operator()(T *p) const
+	{ return __hash_mix(reinterpret_cast<unsigned long long>(p)); }
+};
+
+template <>
+struct hash<std::string>
+{
+	typedef std::string		argument_type;
+	typedef size_t			result_type;
+
+	size_t
+	operator()(const std::string &s) const
+	{ return __hash_bytes(s.data(), s.size()); }
+};
+
+}
+
+#endif
@@ -0,0 +1,553 @@
+#ifndef HASH_TABLE_CLASS_HPP
+# define HASH_TABLE_CLASS_HPP
+
+# include <cassert>
+# include <functional>
+# include "hash.hpp"
+
+namespace ft
+{
+//컨트롤 바이트. 0~127은 사용중인 칸이고 그 값은 해시의 하위 7비트(h2)다.
+//비어있는 칸과 지워진 칸은 음수라서 부호비트만 보면 사용중인지 알 수 있다.
+static const signed char	__ctrl_empty = -128;
+static const signed char	__ctrl_deleted = -2;
+static const size_t			__group_width = 16;
+
+//컨트롤 바이트 16개(그룹)를 한 번에 검사한다. 결과는 칸마다 1비트인 마스크.
+struct __ctrl_group
+{
+# if defined(__SSE2__)
+	__m128i	ctrl;
+
+	explicit __ctrl_group(const signed char *p)
+	: ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))) {}
+
+	unsigned int
+	match(signed char h2) const
+	{ return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl))); }
+
+	unsigned int
+	match_empty(void) const
+	{ return this->match(__ctrl_empty); }
+
+	unsigned int
+	match_free(void) const
+	{ return static_cast<unsigned int>(_mm_movemask_epi8(ctrl)); }
+# else
+	const signed char	*ctrl;
+
+	explicit __ctrl_group(const signed char *p) : ctrl(p) {}
+
+	unsigned int
+	match(signed char h2) const
+	{
+		unsigned int mask = 0;
+		for (size_t i = 0; i < __group_width; i++)
+			if (ctrl[i] == h2)
+				mask |= 1u << i;
+		return mask;
+	}
+
+	unsigned int
+	match_empty(void) const
+	{ return this->match(__ctrl_empty); }
+
+	unsigned int
+	match_free(void) const
+	{
+		unsigned int mask = 0;
+		for (size_t i = 0; i < __group_width; i++)
+			if (ctrl[i] < 0)
+				mask |= 1u << i;
+		return mask;
+	}
+# endif
+};
+
+template <class Table, class Value>
+class __hash_iterator;
+
+//열린 주소법 해시 테이블 하나. 값은 칸 배열에 그대로(flat) 들어간다.
+template <class Value, class Alloc>
+struct __flat_table
+{
+	typedef typename Alloc::template rebind<Value>::other		value_alloc;
+	typedef typename Alloc::template rebind<signed char>::other	ctrl_alloc;
+
+	signed char	*ctrl;
+	Value		*slots;
+	size_t		capacity;
+	size_t		size;
+	size_t		deleted;
+
+	__flat_table(void) : ctrl(NULL), slots(NULL), capacity(0), size(0), deleted(0) {}
+
+	bool
+	full(size_t i) const
+	{ return ctrl[i] >= 0; }
+
+	//한 칸을 더 써도 적재율 7/8(지워진 칸 포함)을 넘지 않는지.
+	bool
+	has_room(void) const
+	{ return (size + deleted + 1) * 8 <= capacity * 7; }
+
+	//그룹 단위 삼각수 탐사. 그룹 수가 2의 거듭제곱이라 모든 그룹을 한 번씩 방문한다.
+	size_t
+	group_mask(void) const
+	{ return capacity / __group_width - 1; }
+
+	//빈 칸을 만들면 이 그룹을 지나간 탐사가 없었던 것이므로 EMPTY로 돌려도 된다.
+	void
+	mark_erased(size_t i)
+	{
+		size_t g = i - i % __group_width;
+		if (__ctrl_group(ctrl + g).match_empty() != 0)
+			ctrl[i] = __ctrl_empty;
+		else
+		{
+			ctrl[i] = __ctrl_deleted;
+			++deleted;
+		}
+		--size;
+	}
+
+	//키가 없다는 걸 알 때 넣을 칸을 찾는다. 부르는 쪽이 has_room()을 먼저 맞춰 둔다.
+	size_t
+	find_free(size_t hash) const
+	{
+		assert(capacity != 0 && this->has_room());
+		size_t mask = this->group_mask();
+		size_t g = (hash >> 7) & mask;
+
+		for (size_t step = 1; ; ++step)
+		{
+			unsigned int m = __ctrl_group(ctrl + g * __group_width).match_free();
+			if (m != 0)
+				return g * __group_width + __builtin_ctz(m);
+			g = (g + step) & mask;
+		}
+	}
+
+	//메모리는 테이블을 가진 컨테이너의 할당자로 받고 돌려준다.
+	void
+	allocate(size_t capacity_, value_alloc &va)
+	{
+		ctrl_alloc ca(va);
+
+		capacity = capacity_;
+		ctrl = ca.allocate(capacity);
+		slots = va.allocate(capacity);
+		std::memset(ctrl, __ctrl_empty, capacity);
+		size = 0;
+		deleted = 0;
+	}
+
+	void
+	release(value_alloc &va)
+	{
+		if (capacity == 0)
+			return ;
+		ctrl_alloc ca(va);
+		for (size_t i = 0; i < capacity; i++)
+			if (this->full(i))
+				va.destroy(slots + i);
+		ca.deallocate(ctrl, capacity);
+		va.deallocate(slots, capacity);
+		*this = __flat_table();
+	}
+};
+
+//unordered_map, unordered_set이 공유하는 본체.
+//커질 때는 새 테이블을 만들어 두고, 이후 연산마다 옛 테이블의 칸을 조금씩(_migrate_step) 옮긴다.
+//옮기는 중에는 원소가 두 테이블 중 한 곳에만 있으므로 검색은 양쪽을 모두 본다.
+template <class Value, class Key, class KeyOfValue, class Hash, class Pred, class Alloc>
+class hash_table
+{
+public:
+	typedef Key										key_type;
+	typedef Value									value_type;
+	typedef Hash									hasher;
+	typedef Pred									key_equal;
+	typedef size_t									size_type;
+	typedef __flat_table<Value, Alloc>				table_type;
+	typedef __hash_iterator<hash_table, Value>			iterator;
+	typedef __hash_iterator<hash_table, const Value>	const_iterator;
+
+	table_type		_cur;
+	table_type		_old;
+	size_t			_migrate_pos;
+
+private:
+	Hash			_hash;
+	Pred			_eq;
+	KeyOfValue		_key_of;
+	typename table_type::value_alloc	_alloc;
+
+	static const size_t	_migrate_step = 16;
+
+	//키가 있는 칸을 찾는다. 없으면 capacity.
+	size_t
+	__find_in(const table_type &t, const key_type &k, size_t hash) const
+	{
+		if (t.size == 0)
+			return t.capacity;
+		size_t mask = t.group_mask();
+		size_t g = (hash >> 7) & mask;
+		signed char h2 = static_cast<signed char>(hash & 0x7F);
+
+		for (size_t step = 1; step <= mask + 1; ++step)
+		{
+			__ctrl_group group(t.ctrl + g * __group_width);
+			unsigned int m = group.match(h2);
+			while (m != 0)
+			{
+				size_t i = g * __group_width + __builtin_ctz(m);
+				if (_eq(_key_of(t.slots[i]), k))
+					return i;
+				m &= m - 1;
+			}
+			if (group.match_empty() != 0)
+				break;
+			g = (g + step) & mask;
+		}
+		return t.capacity;
+	}
+
+	size_t
+	__place(table_type &t, const value_type &val, size_t hash)
+	{
+		size_t i = t.find_free(hash);
+		if (t.ctrl[i] == __ctrl_deleted)
+			--t.deleted;
+		_alloc.construct(t.slots + i, val);
+		t.ctrl[i] = static_cast<signed char>(hash & 0x7F);
+		++t.size;
+		return i;
+	}
+
+	//from의 pos칸부터 최대 steps칸을 to로 옮긴다. to가 차면 멈추고, 나머지는 다음 재해시가 가져간다.
+	void
+	__move_slots(table_type &from, size_t &pos, table_type &to, size_t steps)
+	{
+		for (; steps > 0 && pos < from.capacity && to.has_room(); --steps, ++pos)
+		{
+			if (!from.full(pos))
+				continue;
+			value_type *v = from.slots + pos;
+			this->__place(to, *v, _hash(_key_of(*v)));
+			_alloc.destroy(v);
+			from.mark_erased(pos);
+		}
+	}
+
+	//옛 테이블에서 최대 steps칸을 새 테이블로 옮긴다. 다 옮기면 옛 테이블을 해제.
+	void
+	__migrate(size_t steps)
+	{
+		if (_old.capacity == 0)
+			return ;
+		this->__move_slots(_old, _migrate_pos, _cur, steps);
+		if (_migrate_pos == _old.capacity || _old.size == 0)
+			_old.release(_alloc);
+	}
+
+	//적재율 7/8을 넘기 전에 새 테이블로 갈아탄다. 지워진 칸이 대부분이면 같은 크기로 다시 만든다.
+	//새 크기는 두 테이블의 원소 전부(size())를 기준으로 잡는다.
+	void
+	__grow_if_needed(void)
+	{
+		if (_cur.capacity != 0 && _cur.has_room())
+			return ;
+		size_t need = this->size() + 1;
+		size_t cap = __group_width;
+		while (cap * 7 < need * 2 * 8)
+			cap *= 2;
+		this->__start_rehash(cap);
+	}
+
+	//capacity는 size()개를 모두 담을 수 있어야 한다.
+	//이전 이동이 안 끝났으면 남은 것은 새 테이블로 바로 옮기고, 지금 테이블을 다음 옛 테이블로 삼는다.
+	void
+	__start_rehash(size_t capacity)
+	{
+		table_type next;
+		size_t pos = _migrate_pos;
+
+		next.allocate(capacity, _alloc);
+		if (_old.capacity != 0)
+		{
+			this->__move_slots(_old, pos, next, _old.capacity);
+			_old.release(_alloc);
+		}
+		_old = _cur;
+		_migrate_pos = 0;
+		_cur = next;
+		if (_old.size == 0)
+			_old.release(_alloc);
+	}
+
+public:
+	hash_table(const Hash &hash_ = Hash(), const Pred &eq_ = Pred(), const Alloc &alloc_ = Alloc())
+	: _migrate_pos(0), _hash(hash_), _eq(eq_), _alloc(alloc_) {}
+
+	hash_table(const hash_table &src)
+	: _migrate_pos(0), _hash(src._hash), _eq(src._eq), _alloc(src._alloc)
+	{
+		this->reserve(src.size());
+		for (const_iterator it = src.begin(); it != src.end(); ++it)
+			this->insert(*it);
+	}
+
+	hash_table &
+	operator=(const hash_table &rhs)
+	{
+		if (this == &rhs)
+			return *this;
+		this->clear();
+		_hash = rhs._hash;
+		_eq = rhs._eq;
+		this->reserve(rhs.size());
+		for (const_iterator it = rhs.begin(); it != rhs.end(); ++it)
+			this->insert(*it);
+		return *this;
+	}
+
+	~hash_table()
+	{
+		_old.release(_alloc);
+		_cur.release(_alloc);
+	}
+
+	size_type
+	size(void) const
+	{ return _cur.size + _old.size; }
+
+	size_type
+	max_size(void) const
+	{ return _alloc.max_size(); }
+
+	size_type
+	bucket_count(void) const
+	{ return _cur.capacity; }
+
+	Hash
+	hash_function(void) const
+	{ return _hash; }
+
+	Pred
+	key_eq(void) const
+	{ return _eq; }
+
+	iterator
+	begin(void)
+	{ return iterator(this, _old.capacity ? 0 : 1, 0); }
+
+	const_iterator
+	begin(void) const
+	{ return const_iterator(this, _old.capacity ? 0 : 1, 0); }
+
+	iterator
+	end(void)
+	{ return iterator(this, 1, _cur.capacity); }
+
+	const_iterator
+	end(void) const
+	{ return const_iterator(this, 1, _cur.capacity); }
+
+	iterator
+	find(const key_type &k)
+	{
+		size_t hash = _hash(k);
+		size_t i = this->__find_in(_cur, k, hash);
+
+		if (i != _cur.capacity)
+			return iterator(this, 1, i);
+		i = this->__find_in(_old, k, hash);
+		if (i != _old.capacity)
+			return iterator(this, 0, i);
+		return this->end();
+	}
+
+	const_iterator
+	find(const key_type &k) const
+	{
+		return const_cast<hash_table *>(this)->find(k);
+	}
+
+	ft::pair<iterator, bool>
+	insert(const value_type &val)
+	{
+		const key_type &k = _key_of(val);
+		size_t hash = _hash(k);
+
+		this->__migrate(_migrate_step);
+		iterator it = this->find(k);
+		if (it != this->end())
+			return ft::make_pair(it, false);
+		this->__grow_if_needed();
+		return ft::make_pair(iterator(this, 1, this->__place(_cur, val, hash)), true);
+	}
+
+	void
+	erase(iterator position)
+	{
+		table_type &t = position._table_idx ? _cur : _old;
+
+		_alloc.destroy(t.slots + position._slot);
+		t.mark_erased(position._slot);
+	}
+
+	size_type
+	erase_key(const key_type &k)
+	{
+		iterator it = this->find(k);
+
+		if (it == this->end())
+			return 0;
+		this->erase(it);
+		this->__migrate(_migrate_step);
+		return 1;
+	}
+
+	void
+	clear(void)
+	{
+		_old.release(_alloc);
+		_cur.release(_alloc);
+		_migrate_pos = 0;
+	}
+
+	void
+	swap(hash_table &x)
+	{
+		std::swap(_cur, x._cur);
+		std::swap(_old, x._old);
+		std::swap(_migrate_pos, x._migrate_pos);
+		std::swap(_hash, x._hash);
+		std::swap(_eq, x._eq);
+		std::swap(_alloc, x._alloc);
+	}
+
+	//원소 n개를 재해시 없이 넣을 수 있게 한다. 이 경우는 한 번에 옮긴다.
+	void
+	reserve(size_type n)
+	{
+		size_t cap = __group_width;
+		if (n < this->size())
+			n = this->size();
+		while (cap * 7 < n * 8)
+			cap *= 2;
+		if (cap <= _cur.capacity)
+			return ;
+		this->__start_rehash(cap);
+		this->__migrate(_old.capacity);
+	}
+
+	void
+	rehash(size_type buckets)
+	{
+		size_t cap = __group_width;
+		while (cap < buckets || cap * 7 < this->size() * 8)
+			cap *= 2;
+		this->__start_rehash(cap);
+		this->__migrate(_old.capacity);
+	}
+
+	float
+	load_factor(void) const
+	{ return _cur.capacity ? static_cast<float>(this->size()) / _cur.capacity : 0.0f; }
+
+	float
+	max_load_factor(void) const
+	{ return 0.875f; }
+};
+
+//앞쪽(옛 테이블, 0)을 다 돌고 새 테이블(1)로 넘어가는 정방향 반복자.
+//옮기는 중에는 insert가 원소를 옮기므로 insert 후에는 반복자가 무효가 될 수 있다.
+template <class Table, class Value>
+class __hash_iterator
+{
+public:
+	typedef Value						value_type;
+	typedef ptrdiff_t					difference_type;
+	typedef value_type&					reference;
+	typedef value_type*					pointer;
+	typedef std::forward_iterator_tag	iterator_category;
+
+	const Table	*_table;
+	int			_table_idx;
+	size_t		_slot;
+
+	__hash_iterator(void) : _table(NULL), _table_idx(1), _slot(0) {}
+
+	__hash_iterator(const Table *table_, int table_idx_, size_t slot_)
+	: _table(table_), _table_idx(table_idx_), _slot(slot_)
+	{ this->__skip(); }
+
+	template <class V>
+	__hash_iterator(const __hash_iterator<Table, V> &src)
+	: _table(src._table), _table_idx(src._table_idx), _slot(src._slot) {}
+
+	reference
+	operator*(void) const
+	{ return this->__t().slots[_slot]; }
+
+	pointer
+	operator->(void) const
+	{ return &this->operator*(); }
+
+	__hash_iterator &
+	operator++(void)
+	{
+		++_slot;
+		this->__skip();
+		return *this;
+	}
+
+	__hash_iterator
+	operator++(int)
+	{
+		__hash_iterator tmp(*this);
+		++(*this);
+		return tmp;
+	}
+
+	template <class V>
+	bool
+	operator==(const __hash_iterator<Table, V> &rhs) const
+	{ return _table_idx == rhs._table_idx && _slot == rhs._slot; }
+
+	template <class V>
+	bool
+	operator!=(const __hash_iterator<Table, V> &rhs) const
+	{ return !(*this == rhs); }
+
+private:
+	typename Table::table_type &
+	__t(void) const
+	{
+		Table *t = const_cast<Table *>(_table);
+		return _table_idx ? t->_cur : t->_old;
+	}
+
+	void
+	__skip(void)
+	{
+		if (_table == NULL)
+			return ;
+		for (;;)
+		{
+			typename Table::table_type &t = this->__t();
+			while (_slot < t.capacity && !t.full(_slot))
+				++_slot;
+			if (_slot < t.capacity || _table_idx == 1)
+				return ;
+			_table_idx = 1;
+			_slot = 0;
+		}
+	}
+};
+
+}
+
+#endif
@@ -0,0 +1,494 @@
+#ifndef INTERVAL_MAP_CLASS_HPP
+# define INTERVAL_MAP_CLASS_HPP
+
+# include "rbt.hpp"
+# include "iterator_tree.hpp"
+# include "reverse_iterator.hpp"
+
+namespace ft
+{
+//rbtNode에 부분트리에서 끝점이 가장 큰 노드(_max)를 더한 노드.
+template <typename T>
+struct	__interval_node
+{
+	bool			_is_black;
+	bool			_is_nul;
+	T				_data;
+	__interval_node	*_parent;
+	__interval_node	*_left;
+	__interval_node	*_right;
+	__interval_node	*_max;
+};
+
+//_max를 n과 두 자식의 _max 중 끝점이 가장 큰 것으로 고친다. 끝점을 복사하지 않고 노드를 가리킨다.
+template <typename Node, typename Compare>
+struct __interval_max
+{
+	static const bool	enabled = true;
+
+	Compare	comp;
+
+	__interval_max(const Compare &c = Compare()) : comp(c) {}
+
+	void	construct(Node *) const {}
+	void	destroy(Node *) const {}
+
+	void
+	update(Node *n) const
+	{
+		Node *m = n;
+
+		if (n->_left != NULL && comp(m->_data.first.second, n->_left->_max->_data.first.second))
+			m = n->_left->_max;
+		if (n->_right != NULL && comp(m->_data.first.second, n->_right->_max->_data.first.second))
+			m = n->_right->_max;
+		n->_max = m;
+	}
+};
+
+//닫힌 구간 [first, second]를 키로 하는 map. 같은 구간도 여러 개 넣을 수 있고 넣은 순서대로 놓인다.
+//구간은 시작점, 끝점 순으로 정렬되고, 각 노드가 부분트리의 가장 큰 끝점을 알고 있어
+//겹침 조회는 끝점이 모자란 부분트리와 시작점이 넘치는 부분트리를 건너뛴다.
+template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< ft::pair<const ft::pair<Key, Key>, T> > >
+class interval_map
+{
+public:
+	typedef ft::pair<Key, Key>							interval_type;
+	typedef interval_type								key_type;
+	typedef Key											point_type;
+	typedef T											mapped_type;
+	typedef ft::pair<const key_type, mapped_type>			value_type;
+	typedef Compare										key_compare;
+	class	value_compare
+	{
+		friend class interval_map;
+
+		public:
+		value_compare() : comp(Compare()) { };
+
+		protected:
+		Compare comp;
+		value_compare(Compare c) : comp(c) { };
+
+		public:
+		typedef bool		result_type;
+		typedef value_type	first_argument_type;
+		typedef value_type	second_argument_type;
+		bool	operator()(const value_type &x, const value_type &y) const {
+			if (comp(x.first.first, y.first.first))
+				return true;
+			if (comp(y.first.first, x.first.first))
+				return false;
+			return comp(x.first.second, y.first.second);
+		}
+	};
+
+	typedef Alloc										allocator_type;
+	typedef typename allocator_type::reference			reference;
+	typedef typename allocator_type::const_reference	const_reference;
+	typedef typename allocator_type::pointer			pointer;
+	typedef typename allocator_type::const_pointer		const_pointer;
+	typedef ft::__interval_node<value_type>				node_type;
+	typedef node_type*									node_ptr;
+
+	typedef ptrdiff_t									difference_type;
+	typedef size_t										size_type;
+
+	typedef ft::iter_tree<value_type, node_type>			iterator;
+	typedef ft::iter_tree<const value_type, node_type>		const_iterator;
+	typedef ft::reverse_iterator<iterator>				reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	explicit interval_map(const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	template <class Ite>
+	interval_map(typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+			Ite last, const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	interval_map(const interval_map &src);
+	virtual ~interval_map(void);
+
+	interval_map	&operator=(interval_map const &rhs);
+
+	iterator				begin(void);
+	const_iterator			begin(void) const;
+	iterator				end(void);
+	const_iterator			end(void) const;
+	reverse_iterator		rbegin(void);
+	const_reverse_iterator	rbegin(void) const;
+	reverse_iterator		rend(void);
+	const_reverse_iterator	rend(void) const;
+
+	size_type	size(void) const;
+	size_type	max_size(void) const;
+	bool		empty(void) const;
+
+	iterator					insert(const value_type &val);
+	iterator					insert(const point_type &lo, const point_type &hi, const mapped_type &val);
+	template <class Ite> void	insert(Ite first, Ite last);
+
+	void		erase(iterator position);
+	size_type	erase(const key_type &k);
+	void		erase(iterator first, iterator last);
+
+	void		swap(interval_map &x);
+	void		clear(void);
+	void		clear_async(void);
+	bool		compact(size_type max_nodes = static_cast<size_type>(-1));
+
+	key_compare		key_comp(void) const;
+	value_compare	value_comp(void) const;
+
+	iterator		find(const key_type &k);
+	const_iterator	find(const key_type &k) const;
+	size_type		count(const key_type &k) const;
+
+	template <class Out> Out	find_overlaps(const point_type &lo, const point_type &hi, Out out);
+	template <class Out> Out	find_overlaps(const point_type &lo, const point_type &hi, Out out) const;
+	template <class Out> Out	find_stabbing(const point_type &p, Out out);
+	template <class Out> Out	find_stabbing(const point_type &p, Out out) const;
+	bool						overlaps(const point_type &lo, const point_type &hi) const;
+
+private:
+	typedef value_compare							vc;
+	typedef ft::__interval_max<node_type, Compare>	augment_type;
+	typedef ft::rbt<value_type, vc, allocator_type, node_type, augment_type>	tree_type;
+	tree_type				_tree;
+	key_compare				_key_cmp;
+
+	iterator	__lower(const key_type &k) const;
+	template <class It, class Out> Out	__overlaps(node_ptr n, const point_type &lo, const point_type &hi, Out out) const;
+
+};
+
+template <class Key, class T, class Compare, class Alloc>
+interval_map<Key, T, Compare, Alloc>::interval_map(const key_compare &comp, const allocator_type \
+		&alloc) : _key_cmp(comp)
+{
+	this->_tree._comp = value_compare(comp);
+	this->_tree._alloc = alloc;
+	this->_tree._augment = augment_type(comp);
+}
+
+template <class Key, class T, class Compare, class Alloc> template <class Ite>
+interval_map<Key, T, Compare, Alloc>::interval_map(
+	typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+	Ite last, const key_compare &comp, const allocator_type &alloc) : \
+		_key_cmp(comp)
+{
+	this->_tree._comp = value_compare(comp);
+	this->_tree._alloc = alloc;
+	this->_tree._augment = augment_type(comp);
+	this->insert(first, last);
+}
+
+//정렬된 순서대로 O(n)에 만들고, 요약값은 만들면서 아래에서부터 채운다.
+template<class Key, class T, class Compare, class Alloc>
+interval_map<Key, T, Compare, Alloc>::interval_map(interval_map const &src) : \
+		_key_cmp(src._key_cmp)
+{
+	this->_tree._comp = src._tree.value_comp();
+	this->_tree._alloc = src._tree.__alloc();
+	this->_tree._augment = src._tree._augment;
+	this->_tree.build_sorted(src.begin(), src.size());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+interval_map<Key, T, Compare, Alloc>::~interval_map(void) {
+	this->clear();
+}
+
+template<class Key, class T, class Compare, class Alloc>
+interval_map<Key, T, Compare, Alloc>&
+interval_map<Key, T, Compare, Alloc>::operator=(interval_map const &rhs) {
+	if (this == &rhs)
+		return (*this);
+	this->_key_cmp = rhs._key_cmp;
+	this->clear();
+	this->_tree._comp = rhs._tree.value_comp();
+	this->_tree._alloc = rhs._tree.__alloc();
+	this->_tree._augment = rhs._tree._augment;
+	this->_tree.build_sorted(rhs.begin(), rhs.size());
+	return (*this);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::iterator
+interval_map<Key, T, Compare, Alloc>::begin(void) {
+	return iterator(_tree.begin());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::const_iterator
+interval_map<Key, T, Compare, Alloc>::begin(void) const {
+	return const_iterator(_tree.begin());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::iterator
+interval_map<Key, T, Compare, Alloc>::end(void) {
+	return iterator(_tree.end());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::const_iterator
+interval_map<Key, T, Compare, Alloc>::end(void) const {
+	return const_iterator(_tree.end());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::reverse_iterator
+interval_map<Key, T, Compare, Alloc>::rbegin(void) {
+	return reverse_iterator(_tree.end());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::const_reverse_iterator
+interval_map<Key, T, Compare, Alloc>::rbegin(void) const {
+	return const_reverse_iterator(_tree.end());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::reverse_iterator
+interval_map<Key, T, Compare, Alloc>::rend(void) {
+	return reverse_iterator(_tree.begin());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::const_reverse_iterator
+interval_map<Key, T, Compare, Alloc>::rend(void) const {
+	return const_reverse_iterator(_tree.begin());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::size_type
+interval_map<Key, T, Compare, Alloc>::size(void) const {
+	return this->_tree.size();
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::size_type
+interval_map<Key, T, Compare, Alloc>::max_size(void) const {
+	return this->_tree.max_size();
+}
+
+template<class Key, class T, class Compare, class Alloc>
+bool	interval_map<Key, T, Compare, Alloc>::empty(void) const {
+	return (this->_tree.size() == 0);
+}
+
+//같은 구간이 있으면 그 뒤에 넣는다.
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::iterator
+interval_map<Key, T, Compare, Alloc>::insert(const value_type &val) {
+	return iterator(this->_tree.insert_equal(val));
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::iterator
+interval_map<Key, T, Compare, Alloc>::insert(const point_type &lo, const point_type &hi, const mapped_type &val) {
+	return this->insert(value_type(interval_type(lo, hi), val));
+}
+
+template<class Key, class T, class Compare, class Alloc> template <class Ite>
+void	interval_map<Key, T, Compare, Alloc>::insert(Ite first, Ite last) {
+	while (first != last)
+	{
+		this->insert(*first++);
+	}
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	interval_map<Key, T, Compare, Alloc>::erase(iterator position)
+{
+	this->_tree.erase_node(position._node);
+}
+
+//같은 구간을 모두 지운다.
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::size_type
+interval_map<Key, T, Compare, Alloc>::erase(const key_type &k)
+{
+	iterator it = this->__lower(k), ite = this->end();
+	size_type n = 0;
+
+	while (it != ite && !this->_key_cmp(k.first, it->first.first) && !this->_key_cmp(k.second, it->first.second))
+	{
+		this->erase(it++);
+		++n;
+	}
+	return n;
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	interval_map<Key, T, Compare, Alloc>::erase(iterator first, iterator last)
+{
+	while (first != last)
+		this->erase(first++);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	interval_map<Key, T, Compare, Alloc>::swap(interval_map &x) {
+	this->_tree.swap(x._tree);
+	std::swap(this->_key_cmp, x._key_cmp);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	interval_map<Key, T, Compare, Alloc>::clear(void)
+{
+	this->_tree.clear();
+}
+
+//clear와 같지만 노드 해제는 reclaimer 스레드에 넘기고 바로 돌아온다. 쓰려면 reclaimer.hpp를 넣는다.
+template<class Key, class T, class Compare, class Alloc>
+void	interval_map<Key, T, Compare, Alloc>::clear_async(void)
+{
+	this->_tree.clear_async();
+}
+
+//노드를 키 순서대로 연속된 메모리에 다시 놓아 순회를 빠르게 한다. 반복자는 무효가 된다.
+//max_nodes를 주면 그만큼만 옮기고, 다 옮길 때까지 다시 부르면 된다. 다 옮겼으면 true.
+template<class Key, class T, class Compare, class Alloc>
+bool	interval_map<Key, T, Compare, Alloc>::compact(size_type max_nodes) {
+	return this->_tree.compact(max_nodes);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::key_compare
+interval_map<Key, T, Compare, Alloc>::key_comp(void) const {
+	return (this->_key_cmp);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::value_compare
+interval_map<Key, T, Compare, Alloc>::value_comp(void) const {
+	return (value_compare(this->_key_cmp));
+}
+
+//k와 시작점, 끝점이 모두 같은 구간 중 맨 앞의 것.
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::iterator
+interval_map<Key, T, Compare, Alloc>::find(const key_type &k)
+{
+	iterator it = this->__lower(k);
+
+	if (it == this->end() || this->_key_cmp(k.first, it->first.first) || this->_key_cmp(k.second, it->first.second))
+		return this->end();
+	return it;
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::const_iterator
+interval_map<Key, T, Compare, Alloc>::find(const key_type &k) const
+{
+	return const_cast<interval_map *>(this)->find(k);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::size_type
+interval_map<Key, T, Compare, Alloc>::count(const key_type &k) const
+{
+	const_iterator it = this->find(k), ite = this->end();
+	size_type n = 0;
+
+	for (; it != ite && !this->_key_cmp(k.first, it->first.first) && !this->_key_cmp(k.second, it->first.second); ++it)
+		++n;
+	return n;
+}
+
+//[lo, hi]와 겹치는 구간을 시작점 순으로 찾아 그 반복자를 out에 쓴다.
+//O(log n + k)에 가깝고, 나쁜 경우에도 O(k log n)을 넘지 않는다.
+template<class Key, class T, class Compare, class Alloc> template <class Out>
+Out	interval_map<Key, T, Compare, Alloc>::find_overlaps(const point_type &lo, const point_type &hi, Out out) {
+	return this->template __overlaps<iterator>(this->_tree._root, lo, hi, out);
+}
+
+template<class Key, class T, class Compare, class Alloc> template <class Out>
+Out	interval_map<Key, T, Compare, Alloc>::find_overlaps(const point_type &lo, const point_type &hi, Out out) const {
+	return this->template __overlaps<const_iterator>(this->_tree._root, lo, hi, out);
+}
+
+//점 p를 품는 구간을 찾는다.
+template<class Key, class T, class Compare, class Alloc> template <class Out>
+Out	interval_map<Key, T, Compare, Alloc>::find_stabbing(const point_type &p, Out out) {
+	return this->find_overlaps(p, p, out);
+}
+
+template<class Key, class T, class Compare, class Alloc> template <class Out>
+Out	interval_map<Key, T, Compare, Alloc>::find_stabbing(const point_type &p, Out out) const {
+	return this->find_overlaps(p, p, out);
+}
+
+//겹치는 구간이 하나라도 있는지만 본다. O(log n)
+template<class Key, class T, class Compare, class Alloc>
+bool	interval_map<Key, T, Compare, Alloc>::overlaps(const point_type &lo, const point_type &hi) const {
+	node_ptr n = this->_tree._root;
+
+	while (n != NULL)
+	{
+		if (!this->_key_cmp(hi, n->_data.first.first) && !this->_key_cmp(n->_data.first.second, lo))
+			return true;
+		//왼쪽에 lo까지 닿는 구간이 있는데 겹치지 않는다면 그 시작점이 hi보다 크므로 오른쪽도 겹치지 않는다.
+		if (n->_left != NULL && !this->_key_cmp(n->_left->_max->_data.first.second, lo))
+			n = n->_left;
+		else
+			n = n->_right;
+	}
+	return false;
+}
+
+//k 이상인 첫 구간.
+template<class Key, class T, class Compare, class Alloc>
+typename interval_map<Key, T, Compare, Alloc>::iterator
+interval_map<Key, T, Compare, Alloc>::__lower(const key_type &k) const {
+	node_ptr n = this->_tree._root;
+	node_ptr res = this->_tree.end();
+
+	while (n != NULL)
+	{
+		if (!(this->_key_cmp(n->_data.first.first, k.first)
+				|| (!this->_key_cmp(k.first, n->_data.first.first) && this->_key_cmp(n->_data.first.second, k.second))))
+		{
+			res = n;
+			n = n->_left;
+		}
+		else
+			n = n->_right;
+	}
+	return iterator(res);
+}
+
+//부분트리의 가장 큰 끝점이 lo보다 작으면 통째로 건너뛰고, 시작점이 hi보다 크면 오른쪽은 보지 않는다.
+template<class Key, class T, class Compare, class Alloc> template <class It, class Out>
+Out	interval_map<Key, T, Compare, Alloc>::__overlaps(node_ptr n, const point_type &lo, const point_type &hi, Out out) const {
+	if (n == NULL || this->_key_cmp(n->_max->_data.first.second, lo))
+		return out;
+	out = this->template __overlaps<It>(n->_left, lo, hi, out);
+	if (this->_key_cmp(hi, n->_data.first.first))
+		return out;
+	if (!this->_key_cmp(n->_data.first.second, lo))
+		*out++ = It(n);
+	return this->template __overlaps<It>(n->_right, lo, hi, out);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator==(const interval_map<Key, T, Compare, Alloc> &lhs,
+					const interval_map<Key, T, Compare, Alloc> &rhs)
+{
+	return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator!=(const interval_map<Key, T, Compare, Alloc> &lhs,
+					const interval_map<Key, T, Compare, Alloc> &rhs) {
+	return !(lhs == rhs);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	swap(interval_map<Key, T, Compare, Alloc> &x, interval_map<Key, T, Compare, Alloc> &y) {
+	x.swap(y);
+}
+
+}
+
+#endif
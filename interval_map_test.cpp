@@ -0,0 +1,117 @@
+#include <iterator>
+#include <map>
+#include <vector>
+#include <stdlib.h>
+#include "interval_map.hpp"
+#include "tester.hpp"
+
+typedef ft::interval_map<int, int>					imap_t;
+typedef std::multimap<std::pair<int, int>, int>		ref_t;
+
+//겹치는 구간을 모두 훑어 찾는다. 결과는 시작점, 끝점, 넣은 순서대로다.
+static std::vector<int>
+brute(const ref_t &ref, int lo, int hi)
+{
+	std::vector<int> out;
+
+	for (ref_t::const_iterator it = ref.begin(); it != ref.end(); ++it)
+		if (it->first.first <= hi && lo <= it->first.second)
+			out.push_back(it->second);
+	return out;
+}
+
+template <class It>
+static std::vector<int>
+values(const std::vector<It> &found)
+{
+	std::vector<int> out;
+
+	for (size_t i = 0; i < found.size(); i++)
+		out.push_back(found[i]->second);
+	return out;
+}
+
+int main(void)
+{
+	srand(44);
+	imap_t m;
+	ref_t ref;
+	bool ok = true;
+
+	//넣고 지우는 사이사이 겹침 조회를 훑어 본 것과 맞춘다. 지운 뒤에도 _max가 맞아야 한다.
+	for (int i = 0; i < 8000; i++)
+	{
+		int lo = rand() % 1000;
+		int hi = lo + rand() % (rand() % 8 == 0 ? 300 : 20);
+		switch (rand() % 4)
+		{
+		case 0:
+		{
+			ft::pair<int, int> k(lo - lo % 10, lo - lo % 10 + 5);
+			ok = ok && m.erase(k) == ref.erase(std::make_pair(k.first, k.second));
+			break;
+		}
+		case 1:
+			if (!ref.empty())
+			{
+				imap_t::iterator it = m.find(ft::make_pair(ref.begin()->first.first, ref.begin()->first.second));
+				ok = ok && it == m.begin() && it->second == ref.begin()->second;
+				m.erase(it);
+				ref.erase(ref.begin());
+			}
+			break;
+		default:
+			if (rand() % 2)
+				lo -= lo % 10, hi = lo + 5;
+			m.insert(lo, hi, i);
+			ref.insert(std::make_pair(std::make_pair(lo, hi), i));
+		}
+		if (i % 16 == 0)
+		{
+			int qlo = rand() % 1100 - 50;
+			int qhi = qlo + rand() % 40;
+			std::vector<imap_t::iterator> found;
+			m.find_overlaps(qlo, qhi, std::back_inserter(found));
+			std::vector<int> expect = brute(ref, qlo, qhi);
+			ok = ok && values(found) == expect && m.overlaps(qlo, qhi) == !expect.empty();
+			std::vector<imap_t::const_iterator> stab;
+			static_cast<const imap_t &>(m).find_stabbing(qlo, std::back_inserter(stab));
+			ok = ok && values(stab) == brute(ref, qlo, qlo);
+		}
+	}
+	FT_CHECK(ok);
+
+	//같은 구간은 넣은 순서대로, 정렬은 시작점 다음 끝점.
+	FT_CHECK(m.size() == ref.size());
+	ref_t::iterator r = ref.begin();
+	bool same = true;
+	for (imap_t::iterator it = m.begin(); it != m.end(); ++it, ++r)
+		same = same && it->first.first == r->first.first && it->first.second == r->first.second && it->second == r->second;
+	FT_CHECK(same);
+	ft::pair<int, int> k(m.begin()->first);
+	FT_CHECK(m.count(k) == ref.count(std::make_pair(k.first, k.second)));
+	FT_CHECK(m.find(ft::make_pair(-5, -5)) == m.end() && m.count(ft::make_pair(-5, -5)) == 0);
+
+	//복사와 구간 지우기. 복사본도 겹침 조회가 된다.
+	imap_t copy(m);
+	FT_CHECK(copy == m);
+	imap_t::iterator mid = m.begin();
+	for (size_t i = 0; i < m.size() / 2; i++)
+		++mid;
+	m.erase(m.begin(), mid);
+	std::vector<imap_t::iterator> found;
+	copy.find_overlaps(0, 2000, std::back_inserter(found));
+	FT_CHECK(found.size() == copy.size() && copy != m);
+	m.clear();
+	FT_CHECK(m.empty() && !m.overlaps(-100000, 100000));
+
+	//끝점이 아주 긴 구간 하나가 다른 부분트리 밑에 있어도 찾는다.
+	imap_t wide;
+	for (int i = 0; i < 1000; i++)
+		wide.insert(i * 10, i * 10 + 1, i);
+	wide.insert(5, 100000, -1);
+	found.clear();
+	wide.find_stabbing(99995, std::back_inserter(found));
+	FT_CHECK(found.size() == 1 && found[0]->second == -1);
+	return ft_test::result("interval_map");
+}
@@ -0,0 +1,457 @@
+#ifndef INTRUSIVE_RBT_CLASS_HPP
+# define INTRUSIVE_RBT_CLASS_HPP
+
+# include "utils.hpp"
+# include "rbt.hpp"
+# include "reverse_iterator.hpp"
+
+namespace ft
+{
+//사용자 구조체 안에 멤버로 넣어 두는 rbt 연결부. 트리는 이 연결부만 잇고 노드를 따로 만들지 않는다.
+//복사해도 연결은 따라가지 않는다. 트리에 걸려 있는 동안 객체를 옮기거나 지우면 안 된다.
+struct rbt_hook
+{
+	bool		_is_black;
+	bool		_is_nul;
+	rbt_hook	*_parent;
+	rbt_hook	*_left;
+	rbt_hook	*_right;
+
+	rbt_hook(void) : _is_black(false), _is_nul(false), _parent(NULL), _left(NULL), _right(NULL) {}
+	rbt_hook(const rbt_hook &) : _is_black(false), _is_nul(false), _parent(NULL), _left(NULL), _right(NULL) {}
+	rbt_hook	&operator=(const rbt_hook &) { return *this; }
+
+	//걸려 있는 노드는 늘 부모가 있다. (루트의 부모는 트리의 끝 노드)
+	bool	is_linked(void) const { return _parent != NULL; }
+};
+
+//연결부 주소에서 그것을 품은 객체의 주소를 구한다.
+//Itanium C++ ABI에서 데이터 멤버 포인터는 객체 시작에서의 오프셋 그대로다. (가상 상속 멤버는 안 된다)
+template <class T, rbt_hook T::*Hook>
+struct __hook_traits
+{
+	static ptrdiff_t
+	offset(void)
+	{
+		union { rbt_hook T::*member; ptrdiff_t offset; } u;
+
+		u.member = Hook;
+		return u.offset;
+	}
+
+	static T *
+	to_value(rbt_hook *h)
+	{ return reinterpret_cast<T *>(reinterpret_cast<char *>(h) - offset()); }
+
+	static rbt_hook *
+	to_hook(T &v)
+	{ return &(v.*Hook); }
+};
+
+template <class Value, class T, rbt_hook T::*Hook>
+class __intrusive_iterator
+{
+public:
+	typedef Value							value_type;
+	typedef ptrdiff_t						difference_type;
+	typedef value_type&						reference;
+	typedef value_type*						pointer;
+	typedef std::bidirectional_iterator_tag	iterator_category;
+
+	rbt_hook	*_node;
+
+	__intrusive_iterator(void) : _node(NULL) {}
+
+	explicit __intrusive_iterator(rbt_hook *node_) : _node(node_) {}
+
+	template <class V>
+	__intrusive_iterator(const __intrusive_iterator<V, T, Hook> &src) : _node(src._node) {}
+
+	reference
+	operator*(void) const
+	{ return *__hook_traits<T, Hook>::to_value(_node); }
+
+	pointer
+	operator->(void) const
+	{ return __hook_traits<T, Hook>::to_value(_node); }
+
+	__intrusive_iterator &
+	operator++(void)
+	{
+		if (_node->_right != NULL)
+		{
+			_node = _node->_right;
+			while (_node->_left != NULL)
+				_node = _node->_left;
+			return *this;
+		}
+		rbt_hook *child = _node;
+
+		_node = _node->_parent;
+		while (!_node->_is_nul && child == _node->_right)
+		{
+			child = _node;
+			_node = _node->_parent;
+		}
+		return *this;
+	}
+
+	__intrusive_iterator
+	operator++(int)
+	{
+		__intrusive_iterator tmp(*this);
+		++(*this);
+		return tmp;
+	}
+
+	__intrusive_iterator &
+	operator--(void)
+	{
+		if (_node->_left != NULL)
+		{
+			_node = _node->_left;
+			while (_node->_right != NULL)
+				_node = _node->_right;
+			return *this;
+		}
+		rbt_hook *child = _node;
+
+		_node = _node->_parent;
+		while (!_node->_is_nul && child == _node->_left)
+		{
+			child = _node;
+			_node = _node->_parent;
+		}
+		return *this;
+	}
+
+	__intrusive_iterator
+	operator--(int)
+	{
+		__intrusive_iterator tmp(*this);
+		--(*this);
+		return tmp;
+	}
+
+	template <class V>
+	bool
+	operator==(const __intrusive_iterator<V, T, Hook> &rhs) const
+	{ return _node == rhs._node; }
+
+	template <class V>
+	bool
+	operator!=(const __intrusive_iterator<V, T, Hook> &rhs) const
+	{ return _node != rhs._node; }
+};
+
+//키는 객체 자신.
+template <class T>
+struct __identity_key
+{
+	typedef T	key_type;
+
+	const key_type	&operator()(const T &v) const { return v; }
+};
+
+//키는 객체의 멤버 Field.
+template <class T, class Key, Key T::*Field>
+struct __member_key
+{
+	typedef Key	key_type;
+
+	const key_type	&operator()(const T &v) const { return v.*Field; }
+};
+
+//객체 안의 rbt_hook을 노드로 쓰는 침습형 rbt. 넣고 빼면서 메모리를 할당하지 않고, 객체의 수명도 관리하지 않는다.
+//균형 잡기는 ft::rbt와 같은 rbt_base를 쓴다. 키는 걸려 있는 동안 바꾸면 안 된다.
+//트리가 사라지거나 clear하면 걸려 있던 연결부를 모두 풀어 두므로 객체는 다른 트리에 다시 넣을 수 있다.
+template <class T, rbt_hook T::*Hook, class KeyOf, class Compare>
+class intrusive_rbt : private rbt_base<rbt_hook>
+{
+public:
+	typedef typename KeyOf::key_type								key_type;
+	typedef T														value_type;
+	typedef Compare													key_compare;
+	typedef T&														reference;
+	typedef const T&												const_reference;
+	typedef T*														pointer;
+	typedef const T*												const_pointer;
+	typedef ft::__intrusive_iterator<T, T, Hook>					iterator;
+	typedef ft::__intrusive_iterator<const T, T, Hook>				const_iterator;
+	typedef ft::reverse_iterator<iterator>							reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>					const_reverse_iterator;
+	typedef ptrdiff_t												difference_type;
+	typedef size_t													size_type;
+
+private:
+	typedef ft::__hook_traits<T, Hook>	traits;
+
+	rbt_hook	_end;
+	size_type	_size;
+	Compare		_comp;
+	KeyOf		_key;
+
+	intrusive_rbt(const intrusive_rbt &);
+	intrusive_rbt	&operator=(const intrusive_rbt &);
+
+public:
+	explicit intrusive_rbt(const Compare &comp = Compare())
+	: _size(0), _comp(comp)
+	{
+		_end._is_nul = true;
+		_end._is_black = true;
+	}
+
+	~intrusive_rbt() { this->clear(); }
+
+	iterator
+	begin(void)
+	{ return iterator(_root == NULL ? &_end : this->most_left(_root)); }
+
+	const_iterator
+	begin(void) const
+	{ return const_iterator(_root == NULL ? const_cast<rbt_hook *>(&_end) : this->most_left(_root)); }
+
+	iterator
+	end(void)
+	{ return iterator(&_end); }
+
+	const_iterator
+	end(void) const
+	{ return const_iterator(const_cast<rbt_hook *>(&_end)); }
+
+	reverse_iterator
+	rbegin(void)
+	{ return reverse_iterator(this->end()); }
+
+	const_reverse_iterator
+	rbegin(void) const
+	{ return const_reverse_iterator(this->end()); }
+
+	reverse_iterator
+	rend(void)
+	{ return reverse_iterator(this->begin()); }
+
+	const_reverse_iterator
+	rend(void) const
+	{ return const_reverse_iterator(this->begin()); }
+
+	bool
+	empty(void) const
+	{ return _size == 0; }
+
+	size_type
+	size(void) const
+	{ return _size; }
+
+	//같은 키가 이미 있으면 넣지 않고 그 객체를 가리킨다. v는 어느 트리에도 걸려 있지 않아야 한다.
+	ft::pair<iterator, bool>
+	insert(T &v)
+	{
+		const key_type &k = _key(v);
+		rbt_hook *parent = NULL;
+		rbt_hook *cur = _root;
+		bool left = false;
+
+		while (cur != NULL)
+		{
+			parent = cur;
+			if (_comp(k, _key(*traits::to_value(cur))))
+			{
+				left = true;
+				cur = cur->_left;
+			}
+			else if (_comp(_key(*traits::to_value(cur)), k))
+			{
+				left = false;
+				cur = cur->_right;
+			}
+			else
+				return ft::make_pair(iterator(cur), false);
+		}
+
+		rbt_hook *h = traits::to_hook(v);
+
+		this->__link(&_end, h, parent, left);
+		++_size;
+		return ft::make_pair(iterator(h), true);
+	}
+
+	void
+	erase(iterator position)
+	{
+		this->__unlink(&_end, position._node);
+		--_size;
+	}
+
+	size_type
+	erase(const key_type &k)
+	{
+		iterator it = this->find(k);
+
+		if (it == this->end())
+			return 0;
+		this->erase(it);
+		return 1;
+	}
+
+	void
+	erase(iterator first, iterator last)
+	{
+		while (first != last)
+			this->erase(first++);
+	}
+
+	//키로 찾지 않고 v의 연결부로 바로 뗀다. 이 트리에 걸려 있던 객체여야 한다. 걸려 있지 않았으면 false.
+	bool
+	unlink(T &v)
+	{
+		rbt_hook *h = traits::to_hook(v);
+
+		if (!h->is_linked())
+			return false;
+		this->__unlink(&_end, h);
+		--_size;
+		return true;
+	}
+
+	//이 트리에 걸린 객체의 반복자를 찾지 않고 만든다.
+	iterator
+	iterator_to(T &v)
+	{ return iterator(traits::to_hook(v)); }
+
+	const_iterator
+	iterator_to(const T &v) const
+	{ return const_iterator(traits::to_hook(const_cast<T &>(v))); }
+
+	iterator
+	find(const key_type &k)
+	{ return iterator(this->__find(k)); }
+
+	const_iterator
+	find(const key_type &k) const
+	{ return const_iterator(this->__find(k)); }
+
+	size_type
+	count(const key_type &k) const
+	{ return this->__find(k) == &_end ? 0 : 1; }
+
+	iterator
+	lower_bound(const key_type &k)
+	{ return iterator(this->__lower(k, false)); }
+
+	const_iterator
+	lower_bound(const key_type &k) const
+	{ return const_iterator(this->__lower(k, false)); }
+
+	iterator
+	upper_bound(const key_type &k)
+	{ return iterator(this->__lower(k, true)); }
+
+	const_iterator
+	upper_bound(const key_type &k) const
+	{ return const_iterator(this->__lower(k, true)); }
+
+	//객체는 건드리지 않고 연결부만 모두 푼다.
+	void
+	clear(void)
+	{
+		this->__reset(_root);
+		_root = NULL;
+		_end._left = NULL;
+		_end._right = NULL;
+		_size = 0;
+	}
+
+	void
+	swap(intrusive_rbt &x)
+	{
+		std::swap(_root, x._root);
+		std::swap(_size, x._size);
+		std::swap(_comp, x._comp);
+		this->__close(&_end);
+		x.__close(&x._end);
+	}
+
+	key_compare
+	key_comp(void) const
+	{ return _comp; }
+
+private:
+	rbt_hook *
+	__find(const key_type &k) const
+	{
+		rbt_hook *cur = _root;
+
+		while (cur != NULL)
+		{
+			if (_comp(_key(*traits::to_value(cur)), k))
+				cur = cur->_right;
+			else if (_comp(k, _key(*traits::to_value(cur))))
+				cur = cur->_left;
+			else
+				return cur;
+		}
+		return const_cast<rbt_hook *>(&_end);
+	}
+
+	//upper가 false면 k 이상, true면 k 초과인 첫 노드.
+	rbt_hook *
+	__lower(const key_type &k, bool upper) const
+	{
+		rbt_hook *cur = _root;
+		rbt_hook *res = const_cast<rbt_hook *>(&_end);
+
+		while (cur != NULL)
+		{
+			const key_type &ck = _key(*traits::to_value(cur));
+
+			if (upper ? _comp(k, ck) : !_comp(ck, k))
+			{
+				res = cur;
+				cur = cur->_left;
+			}
+			else
+				cur = cur->_right;
+		}
+		return res;
+	}
+
+	//후위순회로 연결부를 처음 상태로 돌린다.
+	static void
+	__reset(rbt_hook *h)
+	{
+		if (h == NULL)
+			return ;
+		__reset(h->_left);
+		__reset(h->_right);
+		h->_parent = NULL;
+		h->_left = NULL;
+		h->_right = NULL;
+		h->_is_black = false;
+	}
+};
+
+//객체 자신을 키로 쓰는 침습형 set. ft::set<T*>처럼 쓰되 노드를 따로 만들지 않는다.
+template <class T, rbt_hook T::*Hook, class Compare = std::less<T> >
+class intrusive_set : public intrusive_rbt<T, Hook, ft::__identity_key<T>, Compare>
+{
+public:
+	explicit intrusive_set(const Compare &comp = Compare())
+	: intrusive_rbt<T, Hook, ft::__identity_key<T>, Compare>(comp)
+	{ }
+};
+
+//객체의 멤버 Field를 키로 쓰는 침습형 map. ft::map<Key, T*> 대신 쓴다.
+template <class Key, class T, Key T::*Field, rbt_hook T::*Hook, class Compare = std::less<Key> >
+class intrusive_map : public intrusive_rbt<T, Hook, ft::__member_key<T, Key, Field>, Compare>
+{
+public:
+	explicit intrusive_map(const Compare &comp = Compare())
+	: intrusive_rbt<T, Hook, ft::__member_key<T, Key, Field>, Compare>(comp)
+	{ }
+};
+
+}
+
+#endif
@@ -0,0 +1,127 @@
+#include <set>
+#include <vector>
+#include <stdlib.h>
+#include "intrusive_rbt.hpp"
+#include "tester.hpp"
+
+//한 객체를 키 순서와 값 순서의 두 트리에 함께 건다.
+struct Item
+{
+	int				key;
+	int				val;
+	ft::rbt_hook	by_key;
+	ft::rbt_hook	by_val;
+};
+
+struct ValLess
+{
+	bool	operator()(const Item &a, const Item &b) const { return a.val < b.val || (a.val == b.val && a.key < b.key); }
+};
+
+typedef ft::intrusive_map<int, Item, &Item::key, &Item::by_key>		key_tree;
+typedef ft::intrusive_set<Item, &Item::by_val, ValLess>			val_tree;
+
+static bool
+same(const key_tree &t, const std::set<int> &ref)
+{
+	if (t.size() != ref.size())
+		return false;
+	std::set<int>::const_iterator r = ref.begin();
+	for (key_tree::const_iterator it = t.begin(); it != t.end(); ++it, ++r)
+		if (it->key != *r)
+			return false;
+	std::set<int>::const_reverse_iterator rr = ref.rbegin();
+	for (key_tree::const_reverse_iterator it = t.rbegin(); it != t.rend(); ++it, ++rr)
+		if (it->key != *rr)
+			return false;
+	return true;
+}
+
+int main(void)
+{
+	srand(42);
+	std::vector<Item> items(4000);
+	for (size_t i = 0; i < items.size(); i++)
+	{
+		items[i].key = static_cast<int>(i);
+		items[i].val = rand() % 100;
+	}
+
+	{
+		key_tree keys;
+		val_tree vals;
+		std::set<int> ref;
+
+		//넣고 빼기를 섞는다. 두 트리는 같은 객체들을 서로 다른 순서로 본다.
+		for (int i = 0; i < 40000; i++)
+		{
+			Item &it = items[rand() % items.size()];
+			switch (rand() % 3)
+			{
+			case 0:
+			{
+				bool was = it.by_val.is_linked();
+				FT_CHECK(keys.erase(it.key) == ref.erase(it.key));
+				FT_CHECK(vals.unlink(it) == was && !it.by_val.is_linked());
+				break;
+			}
+			case 1:
+				if (it.by_key.is_linked())
+				{
+					keys.erase(keys.iterator_to(it));
+					vals.erase(vals.iterator_to(it));
+					ref.erase(it.key);
+				}
+				break;
+			default:
+				FT_CHECK(keys.insert(it).second == ref.insert(it.key).second);
+				if (!it.by_val.is_linked())
+					FT_CHECK(vals.insert(it).second);
+			}
+		}
+		FT_CHECK(same(keys, ref) && vals.size() == ref.size());
+		bool linked = true;
+		for (size_t i = 0; i < items.size(); i++)
+			linked = linked && items[i].by_key.is_linked() == (ref.count(items[i].key) == 1)
+				&& items[i].by_val.is_linked() == items[i].by_key.is_linked();
+		FT_CHECK(linked);
+
+		bool ordered = true;
+		const Item *prev = NULL;
+		for (val_tree::iterator it = vals.begin(); it != vals.end(); prev = &*it, ++it)
+			ordered = ordered && (prev == NULL || ValLess()(*prev, *it));
+		FT_CHECK(ordered);
+
+		int mid = static_cast<int>(items.size() / 2);
+		FT_CHECK(keys.lower_bound(mid)->key == *ref.lower_bound(mid));
+		FT_CHECK(keys.upper_bound(mid)->key == *ref.upper_bound(mid));
+		FT_CHECK(keys.find(-1) == keys.end() && keys.count(*ref.begin()) == 1);
+		FT_CHECK(&*keys.find(*ref.begin()) == &items[*ref.begin()]);
+
+		//구간 지우기와 swap.
+		keys.erase(keys.begin(), keys.lower_bound(mid));
+		ref.erase(ref.begin(), ref.lower_bound(mid));
+		FT_CHECK(same(keys, ref));
+		key_tree other;
+		other.swap(keys);
+		FT_CHECK(keys.empty() && keys.begin() == keys.end() && same(other, ref));
+		other.insert(items[0]);
+		ref.insert(0);
+		FT_CHECK(same(other, ref));
+		other.clear();
+		FT_CHECK(other.empty() && !items[0].by_key.is_linked() && !items[mid].by_key.is_linked());
+	}
+	//트리가 사라지면 걸려 있던 연결부도 모두 풀린다.
+	bool free_all = true;
+	for (size_t i = 0; i < items.size(); i++)
+		free_all = free_all && !items[i].by_key.is_linked() && !items[i].by_val.is_linked();
+	FT_CHECK(free_all);
+
+	//풀린 객체는 다시 넣을 수 있고, 복사한 객체는 연결을 따라가지 않는다.
+	key_tree again;
+	FT_CHECK(again.insert(items[7]).second && !again.insert(items[7]).second);
+	Item copy = items[7];
+	FT_CHECK(!copy.by_key.is_linked() && !again.unlink(copy) && again.size() == 1);
+	FT_CHECK(again.unlink(items[7]) && again.empty() && !items[7].by_key.is_linked());
+	return ft_test::result("intrusive_rbt");
+}
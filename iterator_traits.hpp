@@ -1,6 +1,9 @@
 #ifndef ITERATOR_TRAITS_HPP
 # define ITERATOR_TRAITS_HPP
 
+# include <cstddef>
+# include <iterator>
+
 namespace ft
 {
 	struct input_iterator_tag {};
@@ -120,10 +120,18 @@ public:
         return iter_tree<const T, node_type>(this->_node);
     }
 
-    template <class, class, class, class>
+    template <class, class, class, class, class, class>
     friend class map;
-	template <class, class, class>
+	template <class, class, class, class>
 	friend class set;
+    template <class, class, class, class>
+    friend class multimap;
+	template <class, class, class>
+	friend class multiset;
+    template <class, class, class, class>
+    friend class interval_map;
+    template <class, class, class, class>
+    friend class lru_map;
 
     template <class, class>
     friend class iter_tree;
@@ -184,5 +184,39 @@ operator+(typename iter_vec<_Iter1>::difference_type d, iter_vec<_Iter1> a)
     return a;
 }
 
+//연속된 메모리의 정수 타입은 memcmp로 한 번에 비교.
+template <class _Iter1, class _Iter2>
+typename ft::enable_if<ft::is_bitwise_comparable<typename iter_vec<_Iter1>::value_type>::value
+	&& ft::is_same<typename iter_vec<_Iter1>::value_type, typename iter_vec<_Iter2>::value_type>::value, bool>::type
+equal(iter_vec<_Iter1> begin1, iter_vec<_Iter1> end1, iter_vec<_Iter2> begin2)
+{
+    const size_t n = static_cast<size_t>(end1 - begin1);
+
+    if (n == 0)
+        return true;
+    return std::memcmp(begin1.base(), begin2.base(), n * sizeof(*begin1.base())) == 0;
+}
+
+//처음으로 다른 원소를 simd로 찾은 뒤 그 원소만 비교.
+//memcmp는 부호없는 바이트 순서라서 signed 타입의 대소 비교에는 쓸 수 없다.
+template <class _Iter1, class _Iter2>
+typename ft::enable_if<ft::is_bitwise_comparable<typename iter_vec<_Iter1>::value_type>::value
+	&& ft::is_same<typename iter_vec<_Iter1>::value_type, typename iter_vec<_Iter2>::value_type>::value, bool>::type
+lexicographical_compare(iter_vec<_Iter1> begin1, iter_vec<_Iter1> end1,
+                        iter_vec<_Iter2> begin2, iter_vec<_Iter2> end2)
+{
+    typedef typename iter_vec<_Iter1>::value_type value_type;
+
+    const size_t n1 = static_cast<size_t>(end1 - begin1);
+    const size_t n2 = static_cast<size_t>(end2 - begin2);
+    const size_t n = n1 < n2 ? n1 : n2;
+    if (n == 0)
+        return n1 < n2;
+    const size_t i = ft::__mismatch_bytes(begin1.base(), begin2.base(), n * sizeof(value_type)) / sizeof(value_type);
+    if (i == n)
+        return n1 < n2;
+    return begin1[i] < begin2[i];
+}
+
 }
 #endif
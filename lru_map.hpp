@@ -0,0 +1,488 @@
+#ifndef LRU_MAP_CLASS_HPP
+# define LRU_MAP_CLASS_HPP
+
+# include "rbt.hpp"
+# include "iterator_tree.hpp"
+# include "reverse_iterator.hpp"
+
+namespace ft
+{
+//rbtNode에 최근 사용 순서 목록의 앞뒤 링크를 더한 노드.
+template <typename T>
+struct	__lru_node
+{
+	bool		_is_black;
+	bool		_is_nul;
+	T			_data;
+	__lru_node	*_parent;
+	__lru_node	*_left;
+	__lru_node	*_right;
+	__lru_node	*_newer;
+	__lru_node	*_older;
+};
+
+//크기가 capacity를 넘으면 가장 오래 쓰지 않은 원소부터 버리는 map.
+//트리 노드에 최근 사용 순서 목록을 함께 엮어 두어, get은 트리를 한 번 내려간 뒤 O(1)로 목록 맨 앞에 다시 걸고
+//버릴 원소는 목록 맨 뒤에서 바로 꺼낸다. 반복자는 키 순서로 돈다.
+//get, put, operator[]만 사용 순서를 바꾸고 find, count, 순회는 바꾸지 않는다.
+template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< ft::pair<const Key, T> > >
+class lru_map
+{
+public:
+	typedef Key											key_type;
+	typedef T											mapped_type;
+	typedef ft::pair<const key_type, mapped_type>		value_type;
+	typedef Compare										key_compare;
+	class	value_compare
+	{
+		friend class lru_map;
+
+		public:
+		value_compare() : comp(Compare()) { };
+
+		protected:
+		Compare comp;
+		value_compare(Compare c) : comp(c) { };
+
+		public:
+		typedef bool		result_type;
+		typedef value_type	first_argument_type;
+		typedef value_type	second_argument_type;
+		bool	operator()(const value_type &x, const value_type &y) const {
+			return comp(x.first, y.first);
+		}
+	};
+
+	typedef Alloc										allocator_type;
+	typedef typename allocator_type::reference			reference;
+	typedef typename allocator_type::const_reference	const_reference;
+	typedef typename allocator_type::pointer			pointer;
+	typedef typename allocator_type::const_pointer		const_pointer;
+	typedef ft::__lru_node<value_type>					node_type;
+	typedef node_type*									node_ptr;
+
+	typedef ptrdiff_t									difference_type;
+	typedef size_t										size_type;
+
+	typedef ft::iter_tree<value_type, node_type>			iterator;
+	typedef ft::iter_tree<const value_type, node_type>		const_iterator;
+	typedef ft::reverse_iterator<iterator>				reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	explicit lru_map(size_type capacity, const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	lru_map(const lru_map &src);
+	virtual ~lru_map(void);
+
+	lru_map	&operator=(lru_map const &rhs);
+
+	iterator				begin(void);
+	const_iterator			begin(void) const;
+	iterator				end(void);
+	const_iterator			end(void) const;
+	reverse_iterator		rbegin(void);
+	const_reverse_iterator	rbegin(void) const;
+	reverse_iterator		rend(void);
+	const_reverse_iterator	rend(void) const;
+
+	size_type	size(void) const;
+	size_type	max_size(void) const;
+	bool		empty(void) const;
+	size_type	capacity(void) const;
+	void		set_capacity(size_type capacity);
+
+	iterator					get(const key_type &k);
+	ft::pair<iterator, bool>	put(const key_type &k, const mapped_type &val);
+	mapped_type					&operator[](const key_type &k);
+
+	iterator		find(const key_type &k);
+	const_iterator	find(const key_type &k) const;
+	size_type		count(const key_type &k) const;
+	iterator		oldest(void);
+	iterator		newest(void);
+
+	void		erase(iterator position);
+	size_type	erase(const key_type &k);
+	void		swap(lru_map &x);
+	void		clear(void);
+
+	size_type	hits(void) const;
+	size_type	misses(void) const;
+	size_type	evictions(void) const;
+	void		reset_stats(void);
+
+	key_compare		key_comp(void) const;
+	value_compare	value_comp(void) const;
+
+private:
+	typedef value_compare							vc;
+	typedef ft::rbt<value_type, vc, allocator_type, node_type>	tree_type;
+	tree_type				_tree;
+	key_compare				_key_cmp;
+	size_type				_capacity;
+	node_ptr				_newest;
+	node_ptr				_oldest;
+	size_type				_hits;
+	size_type				_misses;
+	size_type				_evictions;
+
+	node_ptr	__find(const key_type &k) const;
+	void		__push_front(node_ptr n);
+	void		__unlink(node_ptr n);
+	void		__touch(node_ptr n);
+	void		__evict(void);
+	void		__copy(const lru_map &src);
+
+};
+
+template <class Key, class T, class Compare, class Alloc>
+lru_map<Key, T, Compare, Alloc>::lru_map(size_type capacity, const key_compare &comp, const allocator_type \
+		&alloc) : _key_cmp(comp), _capacity(capacity), _newest(NULL), _oldest(NULL), _hits(0), _misses(0), _evictions(0)
+{
+	this->_tree._comp = value_compare(comp);
+	this->_tree._alloc = alloc;
+}
+
+template<class Key, class T, class Compare, class Alloc>
+lru_map<Key, T, Compare, Alloc>::lru_map(lru_map const &src) : \
+		_key_cmp(src._key_cmp), _capacity(src._capacity), _newest(NULL), _oldest(NULL), _hits(0), _misses(0), _evictions(0)
+{
+	this->_tree._comp = src._tree.value_comp();
+	this->_tree._alloc = src._tree.__alloc();
+	this->__copy(src);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+lru_map<Key, T, Compare, Alloc>::~lru_map(void) {
+	this->clear();
+}
+
+template<class Key, class T, class Compare, class Alloc>
+lru_map<Key, T, Compare, Alloc>&
+lru_map<Key, T, Compare, Alloc>::operator=(lru_map const &rhs) {
+	if (this == &rhs)
+		return (*this);
+	this->clear();
+	this->_key_cmp = rhs._key_cmp;
+	this->_capacity = rhs._capacity;
+	this->_tree._comp = rhs._tree.value_comp();
+	this->_tree._alloc = rhs._tree.__alloc();
+	this->__copy(rhs);
+	return (*this);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::iterator
+lru_map<Key, T, Compare, Alloc>::begin(void) {
+	return iterator(_tree.begin());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::const_iterator
+lru_map<Key, T, Compare, Alloc>::begin(void) const {
+	return const_iterator(_tree.begin());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::iterator
+lru_map<Key, T, Compare, Alloc>::end(void) {
+	return iterator(_tree.end());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::const_iterator
+lru_map<Key, T, Compare, Alloc>::end(void) const {
+	return const_iterator(_tree.end());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::reverse_iterator
+lru_map<Key, T, Compare, Alloc>::rbegin(void) {
+	return reverse_iterator(_tree.end());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::const_reverse_iterator
+lru_map<Key, T, Compare, Alloc>::rbegin(void) const {
+	return const_reverse_iterator(_tree.end());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::reverse_iterator
+lru_map<Key, T, Compare, Alloc>::rend(void) {
+	return reverse_iterator(_tree.begin());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::const_reverse_iterator
+lru_map<Key, T, Compare, Alloc>::rend(void) const {
+	return const_reverse_iterator(_tree.begin());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::size_type
+lru_map<Key, T, Compare, Alloc>::size(void) const {
+	return this->_tree.size();
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::size_type
+lru_map<Key, T, Compare, Alloc>::max_size(void) const {
+	return this->_tree.max_size();
+}
+
+template<class Key, class T, class Compare, class Alloc>
+bool	lru_map<Key, T, Compare, Alloc>::empty(void) const {
+	return (this->_tree.size() == 0);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::size_type
+lru_map<Key, T, Compare, Alloc>::capacity(void) const {
+	return this->_capacity;
+}
+
+//줄이면 넘치는 만큼 오래된 것부터 버린다.
+template<class Key, class T, class Compare, class Alloc>
+void	lru_map<Key, T, Compare, Alloc>::set_capacity(size_type capacity) {
+	this->_capacity = capacity;
+	while (this->size() > this->_capacity)
+		this->__evict();
+}
+
+//찾으면 가장 최근에 쓴 것으로 옮긴다. 없으면 end().
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::iterator
+lru_map<Key, T, Compare, Alloc>::get(const key_type &k) {
+	node_ptr n = this->__find(k);
+
+	if (n == this->_tree.end())
+	{
+		++this->_misses;
+		return this->end();
+	}
+	++this->_hits;
+	this->__touch(n);
+	return iterator(n);
+}
+
+//없으면 넣고 있으면 값을 바꾼다. 어느 쪽이든 가장 최근에 쓴 것이 되고, 넘치면 가장 오래된 것을 버린다.
+//트리는 한 번만 내려간다. capacity가 0이면 넣지 않고 (end(), false)를 돌려준다.
+template<class Key, class T, class Compare, class Alloc>
+ft::pair<typename lru_map<Key, T, Compare, Alloc>::iterator, bool>
+lru_map<Key, T, Compare, Alloc>::put(const key_type &k, const mapped_type &val) {
+	size_type before = this->size();
+	node_ptr n = this->_tree.insert(value_type(k, val));
+
+	if (this->size() == before)
+	{
+		n->_data.second = val;
+		this->__touch(n);
+		return ft::make_pair(iterator(n), false);
+	}
+	this->__push_front(n);
+	if (this->size() > this->_capacity)
+		this->__evict();
+	if (this->_capacity == 0)
+		return ft::make_pair(this->end(), false);
+	return ft::make_pair(iterator(n), true);
+}
+
+//get과 같지만 없으면 mapped_type()을 넣는다. capacity가 0이면 쓸 수 없다.
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::mapped_type&
+lru_map<Key, T, Compare, Alloc>::operator[](const key_type &k)
+{
+	iterator it = this->get(k);
+
+	if (it == this->end())
+		it = this->put(k, mapped_type()).first;
+	return it->second;
+}
+
+//사용 순서를 바꾸지 않고 찾는다.
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::iterator
+lru_map<Key, T, Compare, Alloc>::find(const key_type &k) {
+	return iterator(this->__find(k));
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::const_iterator
+lru_map<Key, T, Compare, Alloc>::find(const key_type &k) const {
+	return const_iterator(this->__find(k));
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::size_type
+lru_map<Key, T, Compare, Alloc>::count(const key_type &k) const {
+	return this->__find(k) != this->_tree.end();
+}
+
+//다음에 버릴 원소. 비어 있으면 end().
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::iterator
+lru_map<Key, T, Compare, Alloc>::oldest(void) {
+	if (this->_oldest == NULL)
+		return this->end();
+	return iterator(this->_oldest);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::iterator
+lru_map<Key, T, Compare, Alloc>::newest(void) {
+	if (this->_newest == NULL)
+		return this->end();
+	return iterator(this->_newest);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	lru_map<Key, T, Compare, Alloc>::erase(iterator position)
+{
+	this->__unlink(position._node);
+	this->_tree.erase_node(position._node);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::size_type
+lru_map<Key, T, Compare, Alloc>::erase(const key_type &k)
+{
+	node_ptr n = this->__find(k);
+
+	if (n == this->_tree.end())
+		return 0;
+	this->erase(iterator(n));
+	return 1;
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	lru_map<Key, T, Compare, Alloc>::swap(lru_map &x) {
+	this->_tree.swap(x._tree);
+	std::swap(this->_key_cmp, x._key_cmp);
+	std::swap(this->_capacity, x._capacity);
+	std::swap(this->_newest, x._newest);
+	std::swap(this->_oldest, x._oldest);
+	std::swap(this->_hits, x._hits);
+	std::swap(this->_misses, x._misses);
+	std::swap(this->_evictions, x._evictions);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	lru_map<Key, T, Compare, Alloc>::clear(void)
+{
+	this->_tree.clear();
+	this->_newest = NULL;
+	this->_oldest = NULL;
+}
+
+//hits와 misses는 get(operator[] 포함)에서만 센다.
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::size_type
+lru_map<Key, T, Compare, Alloc>::hits(void) const {
+	return this->_hits;
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::size_type
+lru_map<Key, T, Compare, Alloc>::misses(void) const {
+	return this->_misses;
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::size_type
+lru_map<Key, T, Compare, Alloc>::evictions(void) const {
+	return this->_evictions;
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	lru_map<Key, T, Compare, Alloc>::reset_stats(void) {
+	this->_hits = 0;
+	this->_misses = 0;
+	this->_evictions = 0;
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::key_compare
+lru_map<Key, T, Compare, Alloc>::key_comp(void) const {
+	return (this->_key_cmp);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::value_compare
+lru_map<Key, T, Compare, Alloc>::value_comp(void) const {
+	return (value_compare(this->_key_cmp));
+}
+
+//값을 만들지 않고 키로만 내려간다.
+template<class Key, class T, class Compare, class Alloc>
+typename lru_map<Key, T, Compare, Alloc>::node_ptr
+lru_map<Key, T, Compare, Alloc>::__find(const key_type &k) const {
+	node_ptr n = this->_tree._root;
+
+	while (n != NULL)
+	{
+		if (this->_key_cmp(n->_data.first, k))
+			n = n->_right;
+		else if (this->_key_cmp(k, n->_data.first))
+			n = n->_left;
+		else
+			return n;
+	}
+	return this->_tree.end();
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	lru_map<Key, T, Compare, Alloc>::__push_front(node_ptr n) {
+	n->_newer = NULL;
+	n->_older = this->_newest;
+	if (this->_newest != NULL)
+		this->_newest->_newer = n;
+	else
+		this->_oldest = n;
+	this->_newest = n;
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	lru_map<Key, T, Compare, Alloc>::__unlink(node_ptr n) {
+	if (n->_newer != NULL)
+		n->_newer->_older = n->_older;
+	else
+		this->_newest = n->_older;
+	if (n->_older != NULL)
+		n->_older->_newer = n->_newer;
+	else
+		this->_oldest = n->_newer;
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	lru_map<Key, T, Compare, Alloc>::__touch(node_ptr n) {
+	if (n == this->_newest)
+		return ;
+	this->__unlink(n);
+	this->__push_front(n);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	lru_map<Key, T, Compare, Alloc>::__evict(void) {
+	node_ptr n = this->_oldest;
+
+	this->__unlink(n);
+	this->_tree.erase_node(n);
+	++this->_evictions;
+}
+
+//오래된 것부터 넣어 사용 순서까지 그대로 옮긴다. 통계는 옮기지 않는다.
+template<class Key, class T, class Compare, class Alloc>
+void	lru_map<Key, T, Compare, Alloc>::__copy(const lru_map &src) {
+	for (node_ptr n = src._oldest; n != NULL; n = n->_newer)
+		this->__push_front(this->_tree.insert(n->_data));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	swap(lru_map<Key, T, Compare, Alloc> &x, lru_map<Key, T, Compare, Alloc> &y) {
+	x.swap(y);
+}
+
+}
+
+#endif
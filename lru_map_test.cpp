@@ -0,0 +1,202 @@
+#include <list>
+#include <map>
+#include <stdlib.h>
+#include "lru_map.hpp"
+#include "tester.hpp"
+
+typedef ft::lru_map<int, int>	lru_t;
+
+//비교용 LRU. 목록 앞이 가장 최근이다.
+struct ref_lru
+{
+	size_t										cap;
+	std::list<int>								order;
+	std::map<int, std::pair<int, std::list<int>::iterator> >	items;
+	size_t										hits;
+	size_t										misses;
+	size_t										evictions;
+
+	explicit ref_lru(size_t c) : cap(c), hits(0), misses(0), evictions(0) {}
+
+	void
+	touch(int k)
+	{
+		order.erase(items[k].second);
+		order.push_front(k);
+		items[k].second = order.begin();
+	}
+
+	void
+	trim(void)
+	{
+		while (items.size() > cap)
+		{
+			items.erase(order.back());
+			order.pop_back();
+			++evictions;
+		}
+	}
+
+	bool
+	get(int k, int &v)
+	{
+		if (items.count(k) == 0)
+		{
+			++misses;
+			return false;
+		}
+		++hits;
+		touch(k);
+		v = items[k].first;
+		return true;
+	}
+
+	void
+	put(int k, int v)
+	{
+		if (items.count(k))
+		{
+			items[k].first = v;
+			touch(k);
+			return ;
+		}
+		order.push_front(k);
+		items[k] = std::make_pair(v, order.begin());
+		trim();
+	}
+
+	bool
+	erase(int k)
+	{
+		if (items.count(k) == 0)
+			return false;
+		order.erase(items[k].second);
+		items.erase(k);
+		return true;
+	}
+};
+
+static bool
+same(lru_t &m, const ref_lru &ref)
+{
+	if (m.size() != ref.items.size())
+		return false;
+	if (ref.order.empty())
+		return m.oldest() == m.end() && m.newest() == m.end();
+	if (m.newest()->first != ref.order.front() || m.oldest()->first != ref.order.back())
+		return false;
+	std::map<int, std::pair<int, std::list<int>::iterator> >::const_iterator r = ref.items.begin();
+	for (lru_t::iterator it = m.begin(); it != m.end(); ++it, ++r)
+		if (it->first != r->first || it->second != r->second.first)
+			return false;
+	return m.hits() == ref.hits && m.misses() == ref.misses && m.evictions() == ref.evictions;
+}
+
+int main(void)
+{
+	srand(50);
+	{
+		lru_t m(64);
+		ref_lru ref(64);
+		bool ok = true;
+
+		for (int i = 0; i < 50000; i++)
+		{
+			int k = rand() % 200;
+			int v = 0;
+			switch (rand() % 8)
+			{
+			case 0:
+				ok = ok && m.erase(k) == static_cast<size_t>(ref.erase(k));
+				break;
+			case 1:
+			{
+				//찾기와 세기는 사용 순서를 바꾸지 않는다.
+				lru_t::iterator it = m.find(k);
+				ok = ok && m.count(k) == ref.items.count(k) && (it == m.end()) == (ref.items.count(k) == 0);
+				break;
+			}
+			case 2:
+			{
+				bool found = ref.get(k, v);
+				m[k] += 1;
+				if (!found)
+					ref.put(k, 1);
+				else
+					ref.items[k].first = v + 1;
+				break;
+			}
+			case 3:
+			{
+				bool found = ref.get(k, v);
+				lru_t::iterator it = m.get(k);
+				ok = ok && found == (it != m.end()) && (!found || it->second == v);
+				break;
+			}
+			case 4:
+				if (i % 1000 == 4)
+				{
+					size_t cap = 16 + rand() % 100;
+					m.set_capacity(cap);
+					ref.cap = cap;
+					ref.trim();
+				}
+				break;
+			default:
+			{
+				bool fresh = ref.items.count(k) == 0;
+				ft::pair<lru_t::iterator, bool> res = m.put(k, i);
+				ref.put(k, i);
+				ok = ok && res.second == fresh && res.first->first == k && res.first->second == i;
+			}
+			}
+			ok = ok && same(m, ref);
+		}
+		FT_CHECK(ok);
+
+		//복사는 사용 순서까지 옮기고 통계는 0부터 센다. 이후 같은 순서로 버린다.
+		lru_t copy(m);
+		lru_t assigned(1);
+		assigned = m;
+		FT_CHECK(copy.size() == m.size() && copy.oldest()->first == m.oldest()->first && copy.newest()->first == m.newest()->first);
+		FT_CHECK(copy.hits() == 0 && copy.evictions() == 0 && assigned.capacity() == m.capacity());
+		for (int k = 1000; k < 1000 + static_cast<int>(m.capacity()) / 2; k++)
+		{
+			m.put(k, k);
+			copy.put(k, k);
+			assigned.put(k, k);
+			ok = ok && copy.oldest()->first == m.oldest()->first && assigned.oldest()->first == m.oldest()->first;
+		}
+		FT_CHECK(ok);
+
+		m.reset_stats();
+		FT_CHECK(m.hits() == 0 && m.misses() == 0 && m.evictions() == 0);
+		lru_t other(3);
+		other.put(1, 1);
+		m.swap(other);
+		FT_CHECK(m.size() == 1 && m.capacity() == 3 && other.size() == copy.size());
+		m.put(2, 2);
+		m.put(3, 3);
+		m.get(1);
+		m.put(4, 4);
+		FT_CHECK(m.count(2) == 0 && m.oldest()->first == 3 && m.newest()->first == 4 && m.evictions() == 1);
+		m.clear();
+		FT_CHECK(m.empty() && m.oldest() == m.end() && m.begin() == m.end());
+		m.put(9, 9);
+		FT_CHECK(m.oldest()->first == 9 && m.newest()->first == 9);
+	}
+
+	//capacity가 0이면 아무것도 남지 않는다.
+	{
+		lru_t z(0);
+		ft::pair<lru_t::iterator, bool> res = z.put(1, 1);
+		FT_CHECK(res.first == z.end() && !res.second && z.empty() && z.evictions() == 1);
+		lru_t one(1);
+		one.put(1, 1);
+		one.put(2, 2);
+		FT_CHECK(one.size() == 1 && one.count(1) == 0 && one.get(2)->second == 2);
+		one.set_capacity(0);
+		FT_CHECK(one.empty() && one.oldest() == one.end());
+	}
+	return ft_test::result("lru_map");
+}
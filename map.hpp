@@ -4,10 +4,18 @@
 # include "rbt.hpp"
 # include "iterator_tree.hpp"
 # include "reverse_iterator.hpp"
+# include "radix_sort.hpp"
+# include "bloom_filter.hpp"
+# include "monoid.hpp"
 
 namespace ft
 {
-template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< ft::pair<const Key,T> > >
+//Monoid를 주면 각 노드가 부분트리의 요약값을 들고 있어 aggregate(lo, hi)가 O(log n)이다. (monoid.hpp)
+//이때 값은 insert_or_assign이나 update로 고친다. operator[]는 쓸 수 없고, 반복자로 고쳤으면 refresh를 부른다.
+//주지 않으면 노드는 rbtNode 그대로라 추가 비용이 없다.
+//Balance에 ft::splay_balance를 주면 찾은 키를 루트로 끌어올린다. (rbt.hpp) const 멤버는 끌어올리지 않는다.
+template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< ft::pair<const Key,T> >,
+		class Monoid = ft::__no_monoid, class Balance = ft::rb_balance >
 class map
 {
 public:
@@ -40,7 +48,9 @@ public:
 	typedef typename allocator_type::const_reference	const_reference;
 	typedef typename allocator_type::pointer			pointer;
 	typedef typename allocator_type::const_pointer		const_pointer;
-	typedef ft::rbtNode<value_type>						node_type;
+	typedef Monoid										monoid_type;
+	typedef typename Monoid::summary_type				summary_type;
+	typedef typename ft::__monoid_traits<value_type, Monoid>::node_type	node_type;
 	typedef node_type*									node_ptr;
 
 	typedef ptrdiff_t									difference_type;
@@ -80,13 +90,18 @@ public:
 	ft::pair<iterator, bool>	insert(const value_type &val);
 	iterator					insert(iterator position, const value_type &val);
 	template <class Ite> void	insert(Ite first, Ite last);
+	ft::pair<iterator, bool>	insert_or_assign(const key_type &k, const mapped_type &v);
+	template <class Fn> iterator	update(const key_type &k, Fn fn);
 
 	void		erase(iterator position);
 	size_type	erase(const key_type &k);
 	void		erase(iterator first, iterator last);
+	template <class Pred> size_type	erase_if(Pred pred);
 
 	void		swap(map &x);
 	void		clear(void);
+	void		clear_async(void);
+	bool		compact(size_type max_nodes = static_cast<size_type>(-1));
 
 	key_compare		key_comp(void) const;
 	value_compare	value_comp(void) const;
@@ -102,6 +117,17 @@ public:
 	pair<const_iterator,const_iterator>	equal_range(const key_type &k) const;
 	pair<iterator,iterator>				equal_range(const key_type &k);
 
+	template <class Ite, class Out> Out	find_many(Ite first, Ite last, Out out, bool sorted = false);
+	template <class Ite, class Out> Out	find_many(Ite first, Ite last, Out out, bool sorted = false) const;
+	template <class Ite, class Out> Out	count_many(Ite first, Ite last, Out out, bool sorted = false) const;
+
+	summary_type	aggregate(const key_type &lo, const key_type &hi) const;
+	summary_type	aggregate(void) const;
+	void			refresh(iterator position);
+
+	void	enable_filter(size_type bits_per_key = 10);
+	void	disable_filter(void);
+	bool	filter_enabled(void) const;
 
 	void print_node() const
 	{
@@ -110,329 +136,574 @@ public:
 
 private:
 	typedef value_compare		vc;
-	typedef ft::rbt<value_type, vc, allocator_type>	tree_type;
+	typedef typename ft::__monoid_traits<value_type, Monoid>::augment_type	augment_type;
+	typedef ft::rbt<value_type, vc, allocator_type, node_type, augment_type, Balance>	tree_type;
 	tree_type				_tree;
 	key_compare				_key_cmp;
 
+	//없는 키를 트리까지 가지 않고 걸러내는 블룸 필터. enable_filter()를 불러야 생긴다.
+	//키에 ft::hash가 있고 Compare가 std::less<Key>일 때만 켤 수 있다.
+	typedef ft::bloom_filter<Key, ft::hash<Key>, ft::__filter_usable<Key, Compare>::value>	filter_type;
+	filter_type				*_filter;
+
+	bool	__filter_rejects(const key_type &k) const;
+	void	__filter_insert(const key_type &k);
+	void	__filter_erase(size_type n);
+	void	__filter_rebuild(void);
+	void	__filter_copy(const filter_type *src);
+
+	template <class Ite> void	__bulk_insert(Ite first, Ite last, ft::__bool_tag<true>);
+	template <class Ite> void	__bulk_insert(Ite first, Ite last, ft::__bool_tag<false>);
+
+	//값의 키와 키를 양쪽 순서로 비교한다.
+	struct __key_less
+	{
+		key_compare	comp;
+
+		__key_less(const key_compare &c) : comp(c) {}
+		bool	operator()(const value_type &v, const key_type &k) const { return comp(v.first, k); }
+		bool	operator()(const key_type &k, const value_type &v) const { return comp(k, v.first); }
+	};
+
+	static const size_t	__batch = 64;
+	//compact된 트리에서 erase_if가 앞쪽 이만큼(크기의 1/16)을 보고 다시 만들지 정한다.
+	static const size_t	__rebuild_probe = 16;
+
+	template <class Ite> size_t	__find_batch(Ite &first, Ite last, node_ptr *res, bool sorted, node_ptr &finger) const;
+
 };
 
-template <class Key, class T, class Compare, class Alloc>
-map<Key, T, Compare, Alloc>::map(const key_compare &comp, const allocator_type \
-		&alloc) : _key_cmp(comp)
+template <class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+map<Key, T, Compare, Alloc, Monoid, Balance>::map(const key_compare &comp, const allocator_type \
+		&alloc) : _key_cmp(comp), _filter(NULL)
 {
 	this->_tree._comp = value_compare(comp);
 	this->_tree._alloc = alloc;
 }
 
-template <class Key, class T, class Compare, class Alloc> template <class Ite>
-map<Key, T, Compare, Alloc>::map(
+template <class Key, class T, class Compare, class Alloc, class Monoid, class Balance> template <class Ite>
+map<Key, T, Compare, Alloc, Monoid, Balance>::map(
 	typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
 	Ite last, const key_compare &comp, const allocator_type &alloc) : \
-		_key_cmp(comp)
+		_key_cmp(comp), _filter(NULL)
 {
 	this->_tree._comp = value_compare(comp);;
 	this->_tree._alloc = alloc;
-	this->insert(first, last);
+	this->__bulk_insert(first, last, ft::__bool_tag<ft::is_radix_orderable<Key, Compare>::value>());
 }
 
-template<class Key, class T, class Compare, class Alloc>
-map<Key, T, Compare, Alloc>::map(map const &src) : \
-		_key_cmp(src._key_cmp)
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+map<Key, T, Compare, Alloc, Monoid, Balance>::map(map const &src) : \
+		_key_cmp(src._key_cmp), _filter(NULL)
 {
 	this->_tree._comp = src._tree.value_comp();
 	this->_tree._alloc = src._tree.__alloc();
-	insert(src.begin(), src.end());
+	this->_tree.build_sorted(src.begin(), src.size());
+	this->__filter_copy(src._filter);
 }
 
-template<class Key, class T, class Compare, class Alloc>
-map<Key, T, Compare, Alloc>::~map(void) {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+map<Key, T, Compare, Alloc, Monoid, Balance>::~map(void) {
 	this->clear();
+	delete this->_filter;
 }
 
-template<class Key, class T, class Compare, class Alloc>
-map<Key, T, Compare, Alloc>&
-map<Key, T, Compare, Alloc>::operator=(map const &rhs) {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+map<Key, T, Compare, Alloc, Monoid, Balance>&
+map<Key, T, Compare, Alloc, Monoid, Balance>::operator=(map const &rhs) {
 	if (this == &rhs)
 		return (*this);
 	this->_key_cmp = rhs._key_cmp;
 	this->clear();
 	this->_tree.value_comp() = rhs._tree.value_comp();
 	this->_tree.__alloc() = rhs._tree.__alloc();
-	this->insert(rhs.begin(), rhs.end());
+	this->_tree.build_sorted(rhs.begin(), rhs.size());
+	if (this->_filter != NULL)
+		this->__filter_rebuild();
 	return (*this);
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::iterator
-map<Key, T, Compare, Alloc>::begin(void) {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::begin(void) {
 	return iterator(_tree.begin());
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::const_iterator
-map<Key, T, Compare, Alloc>::begin(void) const {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::const_iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::begin(void) const {
 	return const_iterator(_tree.begin());
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::iterator
-map<Key, T, Compare, Alloc>::end(void) {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::end(void) {
 	return iterator(_tree.end());
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::const_iterator
-map<Key, T, Compare, Alloc>::end(void) const {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::const_iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::end(void) const {
 	return const_iterator(_tree.end());
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::reverse_iterator
-map<Key, T, Compare, Alloc>::rbegin(void) {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::reverse_iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::rbegin(void) {
 	return reverse_iterator(_tree.end());
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::const_reverse_iterator
-map<Key, T, Compare, Alloc>::rbegin(void) const {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::const_reverse_iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::rbegin(void) const {
 	return const_reverse_iterator(_tree.end());
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::reverse_iterator
-map<Key, T, Compare, Alloc>::rend(void) {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::reverse_iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::rend(void) {
 	return reverse_iterator(_tree.begin());
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::const_reverse_iterator
-map<Key, T, Compare, Alloc>::rend(void) const {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::const_reverse_iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::rend(void) const {
 	return const_reverse_iterator(_tree.begin());
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::size_type
-map<Key, T, Compare, Alloc>::size(void) const {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::size_type
+map<Key, T, Compare, Alloc, Monoid, Balance>::size(void) const {
 	return this->_tree.size();
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::size_type
-map<Key, T, Compare, Alloc>::max_size(void) const {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::size_type
+map<Key, T, Compare, Alloc, Monoid, Balance>::max_size(void) const {
 	return this->_tree.max_size();
 }
 
-template<class Key, class T, class Compare, class Alloc>
-bool	map<Key, T, Compare, Alloc>::empty(void) const {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+bool	map<Key, T, Compare, Alloc, Monoid, Balance>::empty(void) const {
 	return (this->_tree.size() == 0);
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::mapped_type&
-map<Key, T, Compare, Alloc>::operator[](const key_type &k)
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::mapped_type&
+map<Key, T, Compare, Alloc, Monoid, Balance>::operator[](const key_type &k)
 {
+	(void)sizeof(ft::__monoid_map_has_no_subscript<ft::is_same<Monoid, ft::__no_monoid>::value>);
 	return (this->insert(ft::make_pair(k, mapped_type()))).first->second;
 }
 
-template<class Key, class T, class Compare, class Alloc>
-ft::pair<typename map<Key, T, Compare, Alloc>::iterator, bool>
-map<Key, T, Compare, Alloc>::insert(const value_type &val) {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+ft::pair<typename map<Key, T, Compare, Alloc, Monoid, Balance>::iterator, bool>
+map<Key, T, Compare, Alloc, Monoid, Balance>::insert(const value_type &val) {
 	ft::pair<iterator, bool> res;
 
 	res.first = this->find(val.first);
 	res.second = res.first == end();
 	if (res.second)
+	{
 		res.first = iterator(this->_tree.insert(val));
+		this->__filter_insert(val.first);
+	}
 	return (res);
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::iterator
-map<Key, T, Compare, Alloc>::insert(iterator position, const value_type &val) {
-	if (position != position )
-		;
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::insert(iterator position, const value_type &val) {
+	(void)position;
 	return this->insert(val).first;
 }
 
-template<class Key, class T, class Compare, class Alloc> template <class Ite>
-void	map<Key, T, Compare, Alloc>::insert(Ite first, Ite last) {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance> template <class Ite>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::insert(Ite first, Ite last) {
 	while (first != last)
 	{
 		this->insert(*first++);
 	}
 }
 
-template<class Key, class T, class Compare, class Alloc>
-void	map<Key, T, Compare, Alloc>::erase(iterator position)
+//없으면 넣고 true, 있으면 값을 바꾸고 false. 요약값도 함께 맞춘다.
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+ft::pair<typename map<Key, T, Compare, Alloc, Monoid, Balance>::iterator, bool>
+map<Key, T, Compare, Alloc, Monoid, Balance>::insert_or_assign(const key_type &k, const mapped_type &v) {
+	ft::pair<iterator, bool> res = this->insert(ft::make_pair(k, v));
+
+	if (!res.second)
+	{
+		res.first->second = v;
+		this->refresh(res.first);
+	}
+	return (res);
+}
+
+//k의 값에 fn(mapped_type&)을 부른다. 없으면 mapped_type()을 넣고 부른다.
+//fn이 던져도 그때까지 고친 값으로 요약값을 맞춘 뒤 다시 던진다.
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance> template <class Fn>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::update(const key_type &k, Fn fn) {
+	iterator it = this->insert(ft::make_pair(k, mapped_type())).first;
+
+	try
+	{
+		fn(it->second);
+	}
+	catch (...)
+	{
+		this->refresh(it);
+		throw;
+	}
+	this->refresh(it);
+	return it;
+}
+
+//정수 키는 radix_sort로 정렬하고 같은 키는 처음 것만 남긴 뒤 트리를 O(n)에 만든다.
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance> template <class Ite>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::__bulk_insert(Ite first, Ite last, ft::__bool_tag<true>) {
+	ft::vector<ft::pair<Key, T> > buf;
+	size_t n = 0;
+
+	for (; first != last; ++first)
+		buf.push_back(ft::pair<Key, T>((*first).first, (*first).second));
+	ft::radix_sort(buf.begin(), buf.end());
+	for (size_t i = 0; i < buf.size(); i++)
+	{
+		if (n == 0 || buf[n - 1].first != buf[i].first)
+			buf[n++] = buf[i];
+	}
+	this->_tree.build_sorted(buf.begin(), n);
+}
+
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance> template <class Ite>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::__bulk_insert(Ite first, Ite last, ft::__bool_tag<false>) {
+	this->insert(first, last);
+}
+
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::erase(iterator position)
 {
 	this->_tree.delete_node(*position);
+	this->__filter_erase(1);
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::size_type
-map<Key, T, Compare, Alloc>::erase(const key_type &k)
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::size_type
+map<Key, T, Compare, Alloc, Monoid, Balance>::erase(const key_type &k)
 {
-	return this->_tree.delete_node(ft::make_pair(k, mapped_type()));
+	size_type n = this->_tree.delete_node(ft::make_pair(k, mapped_type()));
+
+	this->__filter_erase(n);
+	return n;
 }
 
-template<class Key, class T, class Compare, class Alloc>
-void	map<Key, T, Compare, Alloc>::erase(iterator first, iterator last)
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::erase(iterator first, iterator last)
 {
 	while (first != last)
+	{
 		this->_tree.delete_node(*first++);
+		this->__filter_erase(1);
+	}
 }
 
-template<class Key, class T, class Compare, class Alloc>
-void	map<Key, T, Compare, Alloc>::swap(map &x) {
+//pred(원소)가 참인 원소를 모두 지우고 지운 개수를 돌려준다. 찾지 않고 한 번의 중위순회로 지운다.
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+template <class Pred>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::size_type
+map<Key, T, Compare, Alloc, Monoid, Balance>::erase_if(Pred pred)
+{
+	size_type n = this->_tree.erase_if(pred, this->_tree.compacted()
+			? this->size() / __rebuild_probe + 1 : static_cast<size_t>(-1));
+
+	this->__filter_erase(n);
+	return n;
+}
+
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::swap(map &x) {
 	this->_tree.swap(x._tree);
+	std::swap(this->_filter, x._filter);
 }
 
-template<class Key, class T, class Compare, class Alloc>
-void	map<Key, T, Compare, Alloc>::clear(void)
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::clear(void)
 {
 	this->_tree.clear();
+	if (this->_filter != NULL)
+		this->_filter->reset(0);
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::key_compare
-map<Key, T, Compare, Alloc>::key_comp(void) const {
+//clear와 같지만 노드 해제는 reclaimer 스레드에 넘기고 바로 돌아온다. 쓰려면 reclaimer.hpp를 넣는다.
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::clear_async(void)
+{
+	this->_tree.clear_async();
+	if (this->_filter != NULL)
+		this->_filter->reset(0);
+}
+
+//노드를 키 순서대로 연속된 메모리에 다시 놓아 순회를 빠르게 한다. 반복자는 무효가 된다.
+//max_nodes를 주면 그만큼만 옮기고, 다 옮길 때까지 다시 부르면 된다. 다 옮겼으면 true.
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+bool	map<Key, T, Compare, Alloc, Monoid, Balance>::compact(size_type max_nodes) {
+	return this->_tree.compact(max_nodes);
+}
+
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::key_compare
+map<Key, T, Compare, Alloc, Monoid, Balance>::key_comp(void) const {
 	return (key_compare());
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::value_compare
-map<Key, T, Compare, Alloc>::value_comp(void) const {
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::value_compare
+map<Key, T, Compare, Alloc, Monoid, Balance>::value_comp(void) const {
 	return (value_compare(key_compare()));
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::iterator
-map<Key, T, Compare, Alloc>::find(const key_type &k)
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::find(const key_type &k)
 {
+	if (this->__filter_rejects(k))
+		return this->end();
 	return iterator(this->_tree.find(ft::make_pair(k, mapped_type())));
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::const_iterator
-map<Key, T, Compare, Alloc>::find(const key_type &k) const
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::const_iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::find(const key_type &k) const
 {
+	if (this->__filter_rejects(k))
+		return this->end();
 	return const_iterator(this->_tree.find(ft::make_pair(k, mapped_type())));
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::size_type
-map<Key, T, Compare, Alloc>::count(const key_type &k) const
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::size_type
+map<Key, T, Compare, Alloc, Monoid, Balance>::count(const key_type &k) const
 {
+	if (this->__filter_rejects(k))
+		return 0;
 	return !(this->_tree.find(ft::make_pair(k, mapped_type()))->_is_nul);
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::iterator
-map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) {
-	iterator it = this->begin(), ite = this->end();
-	//k값 또는 바로 직전 주소 반환.
-	while (it != ite)
-	{
-		if (!this->_key_cmp(it->first, k))
-			break;
-		++it;
-	}
-	return (it);
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::lower_bound(const key_type &k) {
+	return iterator(this->_tree.lower_bound(k, __key_less(this->_key_cmp)));
+}
+
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::const_iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::lower_bound(const key_type &k) const {
+	return const_iterator(this->_tree.lower_bound(k, __key_less(this->_key_cmp)));
+}
+
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::upper_bound(const key_type &k) {
+	return iterator(this->_tree.upper_bound(k, __key_less(this->_key_cmp)));
+}
+
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::const_iterator
+map<Key, T, Compare, Alloc, Monoid, Balance>::upper_bound(const key_type &k) const {
+	return const_iterator(this->_tree.upper_bound(k, __key_less(this->_key_cmp)));
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::const_iterator
-map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) const {
-	const_iterator it = this->begin(), ite = this->end();
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+ft::pair<typename map<Key, T, Compare, Alloc, Monoid, Balance>::const_iterator, typename map<Key, T, Compare, Alloc, Monoid, Balance>::const_iterator>
+map<Key, T, Compare, Alloc, Monoid, Balance>::equal_range(const key_type &k) const {
+	return ft::pair<const_iterator, const_iterator>(lower_bound(k),upper_bound(k));
+}
+
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+ft::pair<typename map<Key, T, Compare, Alloc, Monoid, Balance>::iterator, typename map<Key, T, Compare, Alloc, Monoid, Balance>::iterator>
+map<Key, T, Compare, Alloc, Monoid, Balance>::equal_range(const key_type &k) {
+	return ft::pair<iterator, iterator>(lower_bound(k),upper_bound(k));
+}
+
+//키 묶음을 한 번에 찾는다. 각 키의 find 결과를 순서대로 out에 쓴다.
+//sorted이면 키가 오름차순이라고 보고 직전 결과에서 이어서 찾는다.
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance> template <class Ite, class Out>
+Out	map<Key, T, Compare, Alloc, Monoid, Balance>::find_many(Ite first, Ite last, Out out, bool sorted) {
+	node_ptr res[__batch];
+	node_ptr finger = NULL;
 
-	while (it != ite)
+	while (first != last)
 	{
-		if (!this->_key_cmp(it->first, k))
-			break;
-		++it;
+		size_t n = this->__find_batch(first, last, res, sorted, finger);
+		for (size_t i = 0; i < n; i++)
+			*out++ = iterator(res[i]);
 	}
-	return (it);
+	return out;
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::iterator
-map<Key, T, Compare, Alloc>::upper_bound(const key_type &k) {
-	iterator it = this->begin(), ite = this->end();
-	//k값 또는 바로 직후 주소 반환.
-	while (it != ite)
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance> template <class Ite, class Out>
+Out	map<Key, T, Compare, Alloc, Monoid, Balance>::find_many(Ite first, Ite last, Out out, bool sorted) const {
+	node_ptr res[__batch];
+	node_ptr finger = NULL;
+
+	while (first != last)
 	{
-		if (this->_key_cmp(k, it->first))
-			break;
-		++it;
+		size_t n = this->__find_batch(first, last, res, sorted, finger);
+		for (size_t i = 0; i < n; i++)
+			*out++ = const_iterator(res[i]);
 	}
-	return (it);
+	return out;
 }
 
-template<class Key, class T, class Compare, class Alloc>
-typename map<Key, T, Compare, Alloc>::const_iterator
-map<Key, T, Compare, Alloc>::upper_bound(const key_type &k) const {
-	const_iterator it = this->begin(), ite = this->end();
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance> template <class Ite, class Out>
+Out	map<Key, T, Compare, Alloc, Monoid, Balance>::count_many(Ite first, Ite last, Out out, bool sorted) const {
+	node_ptr res[__batch];
+	node_ptr finger = NULL;
 
-	while (it != ite)
+	while (first != last)
 	{
-		if (this->_key_cmp(k, it->first))
-			break;
-		++it;
+		size_t n = this->__find_batch(first, last, res, sorted, finger);
+		for (size_t i = 0; i < n; i++)
+			*out++ = static_cast<size_type>(!res[i]->_is_nul);
 	}
-	return (it);
+	return out;
 }
 
-template<class Key, class T, class Compare, class Alloc>
-ft::pair<typename map<Key, T, Compare, Alloc>::const_iterator, typename map<Key, T, Compare, Alloc>::const_iterator>
-map<Key, T, Compare, Alloc>::equal_range(const key_type &k) const {
-	return ft::pair<const_iterator, const_iterator>(lower_bound(k),upper_bound(k));
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance> template <class Ite>
+size_t	map<Key, T, Compare, Alloc, Monoid, Balance>::__find_batch(Ite &first, Ite last, node_ptr *res, bool sorted, node_ptr &finger) const {
+	if (sorted)
+		return this->_tree.find_many_sorted(first, last, __key_less(this->_key_cmp), res, __batch, finger);
+	return this->_tree.find_many(first, last, __key_less(this->_key_cmp), res, __batch);
 }
 
-template<class Key, class T, class Compare, class Alloc>
-ft::pair<typename map<Key, T, Compare, Alloc>::iterator, typename map<Key, T, Compare, Alloc>::iterator>
-map<Key, T, Compare, Alloc>::equal_range(const key_type &k) {
-	return ft::pair<iterator, iterator>(lower_bound(k),upper_bound(k));
+//키가 [lo, hi)인 원소의 요약값. Monoid를 준 map에서만 쓸 수 있다.
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::summary_type
+map<Key, T, Compare, Alloc, Monoid, Balance>::aggregate(const key_type &lo, const key_type &hi) const {
+	return this->_tree._augment.aggregate(this->_tree._root, lo, hi, __key_less(this->_key_cmp));
+}
+
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+typename map<Key, T, Compare, Alloc, Monoid, Balance>::summary_type
+map<Key, T, Compare, Alloc, Monoid, Balance>::aggregate(void) const {
+	if (this->_tree._root == NULL)
+		return this->_tree._augment.monoid.identity();
+	return this->_tree._root->_sum;
+}
+
+//반복자로 값을 제자리에서 고쳤으면 불러서 요약값을 맞춘다. O(log n)
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::refresh(iterator position) {
+	this->_tree.refresh(position._node);
+}
+
+//필터를 켠다. 키 하나에 bits_per_key비트를 쓴다. (10비트면 오탐이 약 1%)
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::enable_filter(size_type bits_per_key) {
+	(void)sizeof(ft::__filter_needs_hash_and_std_less<ft::__filter_usable<Key, Compare>::value>);
+	delete this->_filter;
+	this->_filter = NULL;
+	this->_filter = new filter_type(bits_per_key);
+	this->__filter_rebuild();
+}
+
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::disable_filter(void) {
+	delete this->_filter;
+	this->_filter = NULL;
+}
+
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+bool	map<Key, T, Compare, Alloc, Monoid, Balance>::filter_enabled(void) const {
+	return this->_filter != NULL;
+}
+
+//필터가 없다고 하면 트리를 내려가지 않는다. 필터를 읽기만 하므로 const 조회끼리는 동시에 불러도 된다.
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+bool	map<Key, T, Compare, Alloc, Monoid, Balance>::__filter_rejects(const key_type &k) const {
+	if (this->_filter == NULL)
+		return false;
+	return !this->_filter->may_contain(k);
+}
+
+//잡아둔 크기의 두 배를 넘으면 오탐이 늘어나므로 지금 크기로 다시 만든다.
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::__filter_insert(const key_type &k) {
+	if (this->_filter == NULL)
+		return ;
+	if (this->size() > 2 * this->_filter->capacity())
+		this->__filter_rebuild();
+	else
+		this->_filter->insert(k);
+}
+
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::__filter_erase(size_type n) {
+	if (this->_filter == NULL)
+		return ;
+	//지운 키의 비트가 많이 남아 오탐이 늘었으면 지우는 쪽에서 바로 다시 만든다.
+	this->_filter->note_erase(n);
+	if (this->_filter->stale() > this->size() / 2 + 64)
+		this->__filter_rebuild();
+}
+
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::__filter_rebuild(void) {
+	this->_filter->reset(this->size());
+	for (const_iterator it = this->begin(); it != this->end(); ++it)
+		this->_filter->insert(it->first);
+}
+
+//복사한 컨테이너도 원본처럼 필터를 켠다. enable_filter를 거치지 않아 필터를 못 쓰는 타입도 복사된다.
+template<class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+void	map<Key, T, Compare, Alloc, Monoid, Balance>::__filter_copy(const filter_type *src) {
+	if (src == NULL)
+		return ;
+	this->_filter = new filter_type(src->bits_per_key());
+	this->__filter_rebuild();
 }
 
-template <class Key, class T, class Compare, class Alloc>
-bool	operator==(const map<Key, T, Compare, Alloc> &lhs,
-					const map<Key, T, Compare, Alloc> &rhs)
+template <class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+bool	operator==(const map<Key, T, Compare, Alloc, Monoid, Balance> &lhs,
+					const map<Key, T, Compare, Alloc, Monoid, Balance> &rhs)
 {
 	return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <class Key, class T, class Compare, class Alloc>
-bool	operator!=(const map<Key, T, Compare, Alloc> &lhs,
-					const map<Key, T, Compare, Alloc> &rhs) {
+template <class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+bool	operator!=(const map<Key, T, Compare, Alloc, Monoid, Balance> &lhs,
+					const map<Key, T, Compare, Alloc, Monoid, Balance> &rhs) {
 	return !(lhs == rhs);
 }
 
-template <class Key, class T, class Compare, class Alloc>
-bool	operator< (const map<Key, T, Compare, Alloc> &lhs,
-					const map<Key, T, Compare, Alloc> &rhs) {
+template <class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+bool	operator< (const map<Key, T, Compare, Alloc, Monoid, Balance> &lhs,
+					const map<Key, T, Compare, Alloc, Monoid, Balance> &rhs) {
 	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <class Key, class T, class Compare, class Alloc>
-bool	operator<=(const map<Key, T, Compare, Alloc> &lhs,
-					const map<Key, T, Compare, Alloc> &rhs) {
+template <class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+bool	operator<=(const map<Key, T, Compare, Alloc, Monoid, Balance> &lhs,
+					const map<Key, T, Compare, Alloc, Monoid, Balance> &rhs) {
 	return !(rhs < lhs);
 }
 
-template <class Key, class T, class Compare, class Alloc>
-bool	operator> (const map<Key, T, Compare, Alloc> &lhs,
-					const map<Key, T, Compare, Alloc> &rhs) {
+template <class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+bool	operator> (const map<Key, T, Compare, Alloc, Monoid, Balance> &lhs,
+					const map<Key, T, Compare, Alloc, Monoid, Balance> &rhs) {
 	return (rhs < lhs);
 }
 
-template <class Key, class T, class Compare, class Alloc>
-bool	operator>=(const map<Key, T, Compare, Alloc> &lhs,
-					const map<Key, T, Compare, Alloc> &rhs) {
+template <class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+bool	operator>=(const map<Key, T, Compare, Alloc, Monoid, Balance> &lhs,
+					const map<Key, T, Compare, Alloc, Monoid, Balance> &rhs) {
 	return !(lhs < rhs);
 }
 
-template <class Key, class T, class Compare, class Alloc>
-void	swap(map<Key, T, Compare, Alloc> &x, map<Key, T, Compare, Alloc> &y) {
+template <class Key, class T, class Compare, class Alloc, class Monoid, class Balance>
+void	swap(map<Key, T, Compare, Alloc, Monoid, Balance> &x, map<Key, T, Compare, Alloc, Monoid, Balance> &y) {
 	x.swap(y);
 }
 
@@ -0,0 +1,182 @@
+#ifndef MONOID_CLASS_HPP
+# define MONOID_CLASS_HPP
+
+# include "rbt.hpp"
+
+namespace ft
+{
+//ft::map의 Monoid 기본값. 요약값을 두지 않으므로 노드도 rbtNode 그대로다.
+struct __no_monoid
+{
+	typedef void	summary_type;
+};
+
+//요약값을 두는 map의 operator[]는 돌려준 참조로 값을 고쳐도 요약값을 맞출 수 없다.
+//정의는 true일 때만 있으므로 그런 map에서 operator[]를 부르면 컴파일되지 않는다. insert_or_assign이나 update를 쓴다.
+template <bool>
+struct __monoid_map_has_no_subscript;
+
+template <>
+struct __monoid_map_has_no_subscript<true> {};
+
+//모노이드는 summary_type, identity(), lift(원소), combine(a, b)를 갖는다.
+//combine은 결합법칙만 맞으면 되고 교환법칙은 필요 없다. 항상 키 순서대로 합친다.
+template <class T>
+struct sum_monoid
+{
+	typedef T	summary_type;
+
+	summary_type	identity(void) const { return T(); }
+	template <class V>
+	summary_type	lift(const V &v) const { return v.second; }
+	summary_type	combine(const summary_type &a, const summary_type &b) const { return a + b; }
+};
+
+//비어 있으면 T의 가장 큰 값.
+template <class T>
+struct min_monoid
+{
+	typedef T	summary_type;
+
+	summary_type	identity(void) const { return std::numeric_limits<T>::max(); }
+	template <class V>
+	summary_type	lift(const V &v) const { return v.second; }
+	summary_type	combine(const summary_type &a, const summary_type &b) const { return b < a ? b : a; }
+};
+
+//비어 있으면 T의 가장 작은 값.
+template <class T>
+struct max_monoid
+{
+	typedef T	summary_type;
+
+	summary_type	identity(void) const { return std::numeric_limits<T>::is_integer ? std::numeric_limits<T>::min() : -std::numeric_limits<T>::max(); }
+	template <class V>
+	summary_type	lift(const V &v) const { return v.second; }
+	summary_type	combine(const summary_type &a, const summary_type &b) const { return a < b ? b : a; }
+};
+
+//rbtNode에 부분트리 요약값(_sum)을 더한 노드.
+template <typename T, typename S>
+struct	__monoid_node
+{
+	bool			_is_black;
+	bool			_is_nul;
+	T				_data;
+	__monoid_node	*_parent;
+	__monoid_node	*_left;
+	__monoid_node	*_right;
+	S				_sum;
+};
+
+//_sum = 왼쪽 요약 + 자기 값 + 오른쪽 요약.
+template <typename Node, typename Monoid>
+struct __monoid_augment
+{
+	typedef typename Monoid::summary_type	summary_type;
+
+	static const bool	enabled = true;
+
+	Monoid	monoid;
+
+	__monoid_augment(const Monoid &m = Monoid()) : monoid(m) {}
+
+	//노드는 값만 만들어 두므로 _sum은 여기서 만들고 지운다.
+	void
+	construct(Node *n) const
+	{
+		std::allocator<summary_type> alloc;
+
+		alloc.construct(&n->_sum, monoid.identity());
+	}
+
+	void
+	destroy(Node *n) const
+	{
+		std::allocator<summary_type> alloc;
+
+		alloc.destroy(&n->_sum);
+	}
+
+	void
+	update(Node *n) const
+	{
+		summary_type s = monoid.lift(n->_data);
+
+		if (n->_left != NULL)
+			s = monoid.combine(n->_left->_sum, s);
+		if (n->_right != NULL)
+			s = monoid.combine(s, n->_right->_sum);
+		n->_sum = s;
+	}
+
+	//키가 [lo, hi)인 원소를 키 순서대로 합친다. less는 less(값, 키)와 less(키, 값)을 모두 받는다.
+	//lo와 hi의 탐색 경로가 갈라지는 노드를 찾고, 거기서 양쪽 경로 안쪽의 부분트리 요약값만 모은다. O(log n)
+	template <class K, class Less>
+	summary_type
+	aggregate(const Node *n, const K &lo, const K &hi, const Less &less) const
+	{
+		while (n != NULL)
+		{
+			if (less(n->_data, lo))
+				n = n->_right;
+			else if (!less(n->_data, hi))
+				n = n->_left;
+			else
+				break;
+		}
+		if (n == NULL)
+			return monoid.identity();
+
+		summary_type left = monoid.identity();
+		summary_type right = monoid.identity();
+
+		//lo 이상인 원소. 왼쪽으로 내려갈 때마다 지금 노드와 오른쪽 부분트리가 앞에서 모은 것보다 앞선다.
+		for (const Node *c = n->_left; c != NULL; )
+		{
+			if (less(c->_data, lo))
+				c = c->_right;
+			else
+			{
+				summary_type s = monoid.lift(c->_data);
+				if (c->_right != NULL)
+					s = monoid.combine(s, c->_right->_sum);
+				left = monoid.combine(s, left);
+				c = c->_left;
+			}
+		}
+		//hi 미만인 원소. 오른쪽으로 내려갈 때마다 왼쪽 부분트리와 지금 노드를 뒤에 붙인다.
+		for (const Node *c = n->_right; c != NULL; )
+		{
+			if (!less(c->_data, hi))
+				c = c->_left;
+			else
+			{
+				if (c->_left != NULL)
+					right = monoid.combine(right, c->_left->_sum);
+				right = monoid.combine(right, monoid.lift(c->_data));
+				c = c->_right;
+			}
+		}
+		return monoid.combine(monoid.combine(left, monoid.lift(n->_data)), right);
+	}
+};
+
+//Monoid에 맞는 노드와 Augment를 고른다.
+template <class Value, class Monoid>
+struct __monoid_traits
+{
+	typedef ft::__monoid_node<Value, typename Monoid::summary_type>	node_type;
+	typedef ft::__monoid_augment<node_type, Monoid>				augment_type;
+};
+
+template <class Value>
+struct __monoid_traits<Value, __no_monoid>
+{
+	typedef ft::rbtNode<Value>		node_type;
+	typedef ft::__rbt_no_augment	augment_type;
+};
+
+}
+
+#endif
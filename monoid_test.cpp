@@ -0,0 +1,170 @@
+#include <map>
+#include <string>
+#include <stdlib.h>
+#include "map.hpp"
+#include "tester.hpp"
+
+//교환법칙이 없는 모노이드. 키 순서대로 이어 붙인 문자열이 나와야 한다.
+struct concat_monoid
+{
+	typedef std::string	summary_type;
+
+	summary_type	identity(void) const { return std::string(); }
+	template <class V>
+	summary_type	lift(const V &v) const { return std::string(1, v.second); }
+	summary_type	combine(const summary_type &a, const summary_type &b) const { return a + b; }
+};
+
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::sum_monoid<long> >	sum_t;
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::min_monoid<int> >	min_t;
+typedef ft::map<int, char, std::less<int>, std::allocator<ft::pair<const int, char> >, concat_monoid>		cat_t;
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::max_monoid<int>, ft::splay_balance>	splay_max_t;
+
+struct Set
+{
+	int	v;
+
+	void	operator()(int &x) const { x = v; }
+};
+
+struct Add
+{
+	int	v;
+
+	void	operator()(int &x) const { x += v; }
+};
+
+struct AddThenThrow
+{
+	void	operator()(int &x) const { x += 1000; throw 45; }
+};
+
+struct Odd
+{
+	bool	operator()(const ft::pair<const int, int> &p) const { return p.first % 2 != 0; }
+};
+
+static long
+brute_sum(const std::map<int, int> &ref, int lo, int hi)
+{
+	long s = 0;
+
+	for (std::map<int, int>::const_iterator it = ref.lower_bound(lo); it != ref.end() && it->first < hi; ++it)
+		s += it->second;
+	return s;
+}
+
+int main(void)
+{
+	srand(45);
+
+	//operator[]로 고치던 예: 고친 값이 요약값에 바로 들어가야 한다.
+	{
+		min_t mn;
+		for (int i = 0; i < 100; i++)
+			mn.insert(ft::make_pair(i, 0));
+		for (int i = 0; i < 100; i++)
+		{
+			Set s = {100 - i};
+			mn.update(i, s);
+		}
+		FT_CHECK(mn.aggregate() == 1);
+		FT_CHECK(mn.insert_or_assign(99, 500).second == false && mn.aggregate() == 2);
+		FT_CHECK(mn.insert_or_assign(200, -3).second == true && mn.aggregate() == -3 && mn.size() == 101);
+		FT_CHECK(mn.aggregate(0, 200) == 2 && mn.aggregate(50, 60) == 41);
+
+		//반복자로 고친 뒤에는 refresh.
+		min_t::iterator it = mn.find(10);
+		it->second = -7;
+		mn.refresh(it);
+		FT_CHECK(mn.aggregate(0, 200) == -7);
+
+		//fn이 던져도 요약값은 이미 고친 값을 따른다.
+		bool thrown = false;
+		try { mn.update(200, AddThenThrow()); } catch (int) { thrown = true; }
+		FT_CHECK(thrown && mn.find(200)->second == 997 && mn.aggregate() == -7);
+	}
+
+	//무작위로 넣고 바꾸고 지우면서 구간 합을 std::map과 맞춘다.
+	{
+		sum_t m;
+		std::map<int, int> ref;
+		bool ok = true;
+		for (int i = 0; i < 20000; i++)
+		{
+			int k = rand() % 2000;
+			int v = rand() % 1000 - 500;
+			switch (rand() % 4)
+			{
+			case 0:
+				ok = ok && m.erase(k) == ref.erase(k);
+				break;
+			case 1:
+			{
+				Add a = {v};
+				m.update(k, a);
+				ref[k] += v;
+				break;
+			}
+			default:
+				m.insert_or_assign(k, v);
+				ref[k] = v;
+			}
+			if (i % 50 == 0)
+			{
+				int lo = rand() % 2100 - 50;
+				int hi = lo + rand() % 500;
+				ok = ok && m.aggregate(lo, hi) == brute_sum(ref, lo, hi)
+					&& m.aggregate() == brute_sum(ref, -1, 2001);
+			}
+		}
+		FT_CHECK(ok);
+
+		//여러 개를 지우고 다시 짜는 길과 복사본도 요약값이 맞다.
+		Odd odd;
+		m.erase_if(odd);
+		for (std::map<int, int>::iterator it = ref.begin(); it != ref.end(); )
+		{
+			if (it->first % 2)
+				ref.erase(it++);
+			else
+				++it;
+		}
+		FT_CHECK(m.aggregate() == brute_sum(ref, -1, 2001) && m.aggregate(100, 900) == brute_sum(ref, 100, 900));
+		sum_t copy(m);
+		m.erase(m.begin(), m.lower_bound(1000));
+		FT_CHECK(copy.aggregate() == brute_sum(ref, -1, 2001) && m.aggregate() == brute_sum(ref, 1000, 2001));
+		m.clear();
+		FT_CHECK(m.aggregate() == 0);
+	}
+
+	//합치는 순서는 키 순서다.
+	{
+		cat_t c;
+		const char *word = "persistent";
+		for (int i = 9; i >= 0; i--)
+			c.insert(ft::make_pair(i, word[i]));
+		FT_CHECK(c.aggregate() == "persistent" && c.aggregate(3, 7) == "sist");
+		c.insert_or_assign(0, 'P');
+		c.erase(9);
+		FT_CHECK(c.aggregate() == "Persisten" && c.aggregate(-5, 1) == "P");
+	}
+
+	//splay로 찾기만 해도 트리가 바뀌지만 요약값은 그대로다.
+	{
+		splay_max_t s;
+		for (int i = 0; i < 1000; i++)
+			s.insert_or_assign(i, (i * 37) % 1000);
+		bool ok = true;
+		for (int i = 0; i < 200; i++)
+		{
+			int k = rand() % 1000;
+			ok = ok && s.find(k)->second == (k * 37) % 1000;
+		}
+		FT_CHECK(ok && s.aggregate() == 999 && s.aggregate(0, 10) == 333);
+		Set low = {-1};
+		s.update(27, low);
+		FT_CHECK(s.aggregate() == 998);
+	}
+	return ft_test::result("monoid");
+}
@@ -0,0 +1,442 @@
+#ifndef MULTIMAP_CLASS_HPP
+# define MULTIMAP_CLASS_HPP
+
+# include "rbt.hpp"
+# include "iterator_tree.hpp"
+# include "reverse_iterator.hpp"
+
+namespace ft
+{
+//같은 키를 여러 개 담는 map. 같은 키끼리는 넣은 순서대로 놓인다.
+template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< ft::pair<const Key,T> > >
+class multimap
+{
+public:
+	typedef Key											key_type;
+	typedef T											mapped_type;
+	typedef ft::pair<const key_type, mapped_type>			value_type;
+	typedef Compare										key_compare;
+	class	value_compare
+	{
+		friend class multimap;
+
+		public:
+		value_compare() : comp(Compare()) { };
+
+		protected:
+		Compare comp;
+		value_compare(Compare c) : comp(c) { };
+
+		public:
+		typedef bool		result_type;
+		typedef value_type	first_argument_type;
+		typedef value_type	second_argument_type;
+		bool	operator()(const value_type &x, const value_type &y) const {
+			return comp(x.first, y.first);
+		}
+	};
+
+	typedef Alloc										allocator_type;
+	typedef typename allocator_type::reference			reference;
+	typedef typename allocator_type::const_reference	const_reference;
+	typedef typename allocator_type::pointer			pointer;
+	typedef typename allocator_type::const_pointer		const_pointer;
+	typedef ft::rbtNode<value_type>						node_type;
+	typedef node_type*									node_ptr;
+
+	typedef ptrdiff_t									difference_type;
+	typedef size_t										size_type;
+
+	typedef ft::iter_tree<value_type, node_type>			iterator;
+	typedef ft::iter_tree<const value_type, node_type>		const_iterator;
+	typedef ft::reverse_iterator<iterator>				reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	explicit multimap(const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	template <class Ite>
+	multimap(typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+			Ite last, const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	multimap(const multimap &src);
+	virtual ~multimap(void);
+
+	multimap	&operator=(multimap const &rhs);
+
+	iterator				begin(void);
+	const_iterator			begin(void) const;
+	iterator				end(void);
+	const_iterator			end(void) const;
+	reverse_iterator		rbegin(void);
+	const_reverse_iterator	rbegin(void) const;
+	reverse_iterator		rend(void);
+	const_reverse_iterator	rend(void) const;
+
+	size_type	size(void) const;
+	size_type	max_size(void) const;
+	bool		empty(void) const;
+
+	iterator					insert(const value_type &val);
+	iterator					insert(iterator position, const value_type &val);
+	template <class Ite> void	insert(Ite first, Ite last);
+
+	void		erase(iterator position);
+	size_type	erase(const key_type &k);
+	void		erase(iterator first, iterator last);
+
+	void		swap(multimap &x);
+	void		clear(void);
+	void		clear_async(void);
+	bool		compact(size_type max_nodes = static_cast<size_type>(-1));
+
+	key_compare		key_comp(void) const;
+	value_compare	value_comp(void) const;
+
+	iterator		find(const key_type &k);
+	const_iterator	find(const key_type &k) const;
+	size_type		count(const key_type &k) const;
+
+	iterator		lower_bound(const key_type &k);
+	const_iterator	lower_bound(const key_type &k) const;
+	iterator		upper_bound(const key_type &k);
+	const_iterator	upper_bound(const key_type &k) const;
+	pair<const_iterator,const_iterator>	equal_range(const key_type &k) const;
+	pair<iterator,iterator>				equal_range(const key_type &k);
+
+private:
+	typedef value_compare		vc;
+	typedef ft::rbt<value_type, vc, allocator_type>	tree_type;
+	tree_type				_tree;
+	key_compare				_key_cmp;
+
+	//값의 키와 키를 양쪽 순서로 비교한다.
+	struct __key_less
+	{
+		key_compare	comp;
+
+		__key_less(const key_compare &c) : comp(c) {}
+		bool	operator()(const value_type &v, const key_type &k) const { return comp(v.first, k); }
+		bool	operator()(const key_type &k, const value_type &v) const { return comp(k, v.first); }
+	};
+
+};
+
+template <class Key, class T, class Compare, class Alloc>
+multimap<Key, T, Compare, Alloc>::multimap(const key_compare &comp, const allocator_type \
+		&alloc) : _key_cmp(comp)
+{
+	this->_tree._comp = value_compare(comp);
+	this->_tree._alloc = alloc;
+}
+
+template <class Key, class T, class Compare, class Alloc> template <class Ite>
+multimap<Key, T, Compare, Alloc>::multimap(
+	typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+	Ite last, const key_compare &comp, const allocator_type &alloc) : \
+		_key_cmp(comp)
+{
+	this->_tree._comp = value_compare(comp);
+	this->_tree._alloc = alloc;
+	this->insert(first, last);
+}
+
+//이미 정렬되어 있으므로 같은 키가 섞여 있어도 O(n)에 그대로 만든다.
+template<class Key, class T, class Compare, class Alloc>
+multimap<Key, T, Compare, Alloc>::multimap(multimap const &src) : \
+		_key_cmp(src._key_cmp)
+{
+	this->_tree._comp = src._tree.value_comp();
+	this->_tree._alloc = src._tree.__alloc();
+	this->_tree.build_sorted(src.begin(), src.size());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+multimap<Key, T, Compare, Alloc>::~multimap(void) {
+	this->clear();
+}
+
+template<class Key, class T, class Compare, class Alloc>
+multimap<Key, T, Compare, Alloc>&
+multimap<Key, T, Compare, Alloc>::operator=(multimap const &rhs) {
+	if (this == &rhs)
+		return (*this);
+	this->_key_cmp = rhs._key_cmp;
+	this->clear();
+	this->_tree._comp = rhs._tree.value_comp();
+	this->_tree._alloc = rhs._tree.__alloc();
+	this->_tree.build_sorted(rhs.begin(), rhs.size());
+	return (*this);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::begin(void) {
+	return iterator(_tree.begin());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::const_iterator
+multimap<Key, T, Compare, Alloc>::begin(void) const {
+	return const_iterator(_tree.begin());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::end(void) {
+	return iterator(_tree.end());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::const_iterator
+multimap<Key, T, Compare, Alloc>::end(void) const {
+	return const_iterator(_tree.end());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::reverse_iterator
+multimap<Key, T, Compare, Alloc>::rbegin(void) {
+	return reverse_iterator(_tree.end());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::const_reverse_iterator
+multimap<Key, T, Compare, Alloc>::rbegin(void) const {
+	return const_reverse_iterator(_tree.end());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::reverse_iterator
+multimap<Key, T, Compare, Alloc>::rend(void) {
+	return reverse_iterator(_tree.begin());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::const_reverse_iterator
+multimap<Key, T, Compare, Alloc>::rend(void) const {
+	return const_reverse_iterator(_tree.begin());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::size_type
+multimap<Key, T, Compare, Alloc>::size(void) const {
+	return this->_tree.size();
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::size_type
+multimap<Key, T, Compare, Alloc>::max_size(void) const {
+	return this->_tree.max_size();
+}
+
+template<class Key, class T, class Compare, class Alloc>
+bool	multimap<Key, T, Compare, Alloc>::empty(void) const {
+	return (this->_tree.size() == 0);
+}
+
+//같은 키가 있으면 그 뒤에 넣는다.
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::insert(const value_type &val) {
+	return iterator(this->_tree.insert_equal(val));
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::insert(iterator position, const value_type &val) {
+	(void)position;
+	return this->insert(val);
+}
+
+template<class Key, class T, class Compare, class Alloc> template <class Ite>
+void	multimap<Key, T, Compare, Alloc>::insert(Ite first, Ite last) {
+	while (first != last)
+	{
+		this->insert(*first++);
+	}
+}
+
+//찾지 않고 반복자의 노드를 바로 뗀다. 다른 반복자는 그대로 쓸 수 있다.
+template<class Key, class T, class Compare, class Alloc>
+void	multimap<Key, T, Compare, Alloc>::erase(iterator position)
+{
+	this->_tree.erase_node(position._node);
+}
+
+//같은 키의 첫 노드에서부터 키가 달라질 때까지 한 번에 지운다.
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::size_type
+multimap<Key, T, Compare, Alloc>::erase(const key_type &k)
+{
+	iterator it = this->lower_bound(k), ite = this->end();
+	size_type n = 0;
+
+	while (it != ite && !this->_key_cmp(k, it->first))
+	{
+		this->erase(it++);
+		++n;
+	}
+	return n;
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	multimap<Key, T, Compare, Alloc>::erase(iterator first, iterator last)
+{
+	while (first != last)
+		this->erase(first++);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	multimap<Key, T, Compare, Alloc>::swap(multimap &x) {
+	this->_tree.swap(x._tree);
+	std::swap(this->_key_cmp, x._key_cmp);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+void	multimap<Key, T, Compare, Alloc>::clear(void)
+{
+	this->_tree.clear();
+}
+
+//clear와 같지만 노드 해제는 reclaimer 스레드에 넘기고 바로 돌아온다. 쓰려면 reclaimer.hpp를 넣는다.
+template<class Key, class T, class Compare, class Alloc>
+void	multimap<Key, T, Compare, Alloc>::clear_async(void)
+{
+	this->_tree.clear_async();
+}
+
+//노드를 키 순서대로 연속된 메모리에 다시 놓아 순회를 빠르게 한다. 반복자는 무효가 된다.
+//max_nodes를 주면 그만큼만 옮기고, 다 옮길 때까지 다시 부르면 된다. 다 옮겼으면 true.
+template<class Key, class T, class Compare, class Alloc>
+bool	multimap<Key, T, Compare, Alloc>::compact(size_type max_nodes) {
+	return this->_tree.compact(max_nodes);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::key_compare
+multimap<Key, T, Compare, Alloc>::key_comp(void) const {
+	return (this->_key_cmp);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::value_compare
+multimap<Key, T, Compare, Alloc>::value_comp(void) const {
+	return (value_compare(this->_key_cmp));
+}
+
+//같은 키가 여럿이면 맨 앞의 것.
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::find(const key_type &k)
+{
+	iterator it = this->lower_bound(k);
+
+	if (it == this->end() || this->_key_cmp(k, it->first))
+		return this->end();
+	return it;
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::const_iterator
+multimap<Key, T, Compare, Alloc>::find(const key_type &k) const
+{
+	const_iterator it = this->lower_bound(k);
+
+	if (it == this->end() || this->_key_cmp(k, it->first))
+		return this->end();
+	return it;
+}
+
+//equal_range를 O(log n)에 찾고 그 사이를 센다.
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::size_type
+multimap<Key, T, Compare, Alloc>::count(const key_type &k) const
+{
+	ft::pair<const_iterator, const_iterator> range = this->equal_range(k);
+	size_type n = 0;
+
+	for (; range.first != range.second; ++range.first)
+		++n;
+	return n;
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::lower_bound(const key_type &k) {
+	return iterator(this->_tree.lower_bound(k, __key_less(this->_key_cmp)));
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::const_iterator
+multimap<Key, T, Compare, Alloc>::lower_bound(const key_type &k) const {
+	return const_iterator(this->_tree.lower_bound(k, __key_less(this->_key_cmp)));
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::iterator
+multimap<Key, T, Compare, Alloc>::upper_bound(const key_type &k) {
+	return iterator(this->_tree.upper_bound(k, __key_less(this->_key_cmp)));
+}
+
+template<class Key, class T, class Compare, class Alloc>
+typename multimap<Key, T, Compare, Alloc>::const_iterator
+multimap<Key, T, Compare, Alloc>::upper_bound(const key_type &k) const {
+	return const_iterator(this->_tree.upper_bound(k, __key_less(this->_key_cmp)));
+}
+
+template<class Key, class T, class Compare, class Alloc>
+ft::pair<typename multimap<Key, T, Compare, Alloc>::const_iterator, typename multimap<Key, T, Compare, Alloc>::const_iterator>
+multimap<Key, T, Compare, Alloc>::equal_range(const key_type &k) const {
+	return ft::pair<const_iterator, const_iterator>(lower_bound(k),upper_bound(k));
+}
+
+template<class Key, class T, class Compare, class Alloc>
+ft::pair<typename multimap<Key, T, Compare, Alloc>::iterator, typename multimap<Key, T, Compare, Alloc>::iterator>
+multimap<Key, T, Compare, Alloc>::equal_range(const key_type &k) {
+	return ft::pair<iterator, iterator>(lower_bound(k),upper_bound(k));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator==(const multimap<Key, T, Compare, Alloc> &lhs,
+					const multimap<Key, T, Compare, Alloc> &rhs)
+{
+	return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator!=(const multimap<Key, T, Compare, Alloc> &lhs,
+					const multimap<Key, T, Compare, Alloc> &rhs) {
+	return !(lhs == rhs);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator< (const multimap<Key, T, Compare, Alloc> &lhs,
+					const multimap<Key, T, Compare, Alloc> &rhs) {
+	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator<=(const multimap<Key, T, Compare, Alloc> &lhs,
+					const multimap<Key, T, Compare, Alloc> &rhs) {
+	return !(rhs < lhs);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator> (const multimap<Key, T, Compare, Alloc> &lhs,
+					const multimap<Key, T, Compare, Alloc> &rhs) {
+	return (rhs < lhs);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator>=(const multimap<Key, T, Compare, Alloc> &lhs,
+					const multimap<Key, T, Compare, Alloc> &rhs) {
+	return !(lhs < rhs);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	swap(multimap<Key, T, Compare, Alloc> &x, multimap<Key, T, Compare, Alloc> &y) {
+	x.swap(y);
+}
+
+}
+
+#endif
@@ -0,0 +1,140 @@
+#include <map>
+#include <set>
+#include <stdlib.h>
+#include "multimap.hpp"
+#include "multiset.hpp"
+#include "tester.hpp"
+
+typedef ft::multimap<int, int>	mmap_t;
+typedef ft::multiset<int>		mset_t;
+
+//값까지 같은 순서여야 같은 키끼리 넣은 순서가 지켜진 것이다.
+static bool
+same(const mmap_t &m, const std::multimap<int, int> &ref)
+{
+	if (m.size() != ref.size())
+		return false;
+	std::multimap<int, int>::const_iterator r = ref.begin();
+	for (mmap_t::const_iterator it = m.begin(); it != m.end(); ++it, ++r)
+		if (it->first != r->first || it->second != r->second)
+			return false;
+	std::multimap<int, int>::const_reverse_iterator rr = ref.rbegin();
+	for (mmap_t::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it, ++rr)
+		if (it->first != rr->first || it->second != rr->second)
+			return false;
+	return true;
+}
+
+static bool
+same(const mset_t &s, const std::multiset<int> &ref)
+{
+	if (s.size() != ref.size())
+		return false;
+	std::multiset<int>::const_iterator r = ref.begin();
+	for (mset_t::const_iterator it = s.begin(); it != s.end(); ++it, ++r)
+		if (*it != *r)
+			return false;
+	return true;
+}
+
+int main(void)
+{
+	srand(43);
+	{
+		mmap_t m;
+		std::multimap<int, int> ref;
+
+		for (int i = 0; i < 30000; i++)
+		{
+			int k = rand() % 300;
+			switch (rand() % 5)
+			{
+			case 0:
+				FT_CHECK(m.erase(k) == ref.erase(k));
+				break;
+			case 1:
+			{
+				//같은 키들 가운데 하나를 반복자로 지운다.
+				size_t n = ref.count(k);
+				if (n == 0)
+					break;
+				size_t skip = rand() % n;
+				mmap_t::iterator it = m.lower_bound(k);
+				std::multimap<int, int>::iterator r = ref.lower_bound(k);
+				for (size_t s = 0; s < skip; s++, ++it, ++r)
+					;
+				FT_CHECK(it->second == r->second);
+				m.erase(it);
+				ref.erase(r);
+				break;
+			}
+			case 2:
+				m.insert(m.begin(), ft::make_pair(k, i));
+				ref.insert(std::make_pair(k, i));
+				break;
+			default:
+				FT_CHECK(m.insert(ft::make_pair(k, i))->second == i);
+				ref.insert(std::make_pair(k, i));
+			}
+		}
+		FT_CHECK(same(m, ref));
+		bool ok = true;
+		for (int k = -1; k <= 300; k++)
+		{
+			ft::pair<mmap_t::iterator, mmap_t::iterator> er = m.equal_range(k);
+			ok = ok && m.count(k) == ref.count(k)
+				&& er.first == m.lower_bound(k) && er.second == m.upper_bound(k)
+				&& (ref.count(k) == 0 ? m.find(k) == m.end() : m.find(k)->first == k);
+			size_t n = 0;
+			for (; er.first != er.second; ++er.first)
+				++n;
+			ok = ok && n == ref.count(k);
+		}
+		FT_CHECK(ok);
+
+		mmap_t copy(m);
+		mmap_t assigned;
+		assigned = m;
+		m.erase(m.begin(), m.lower_bound(150));
+		ref.erase(ref.begin(), ref.lower_bound(150));
+		FT_CHECK(same(m, ref) && copy.size() == assigned.size() && copy.size() > m.size());
+		copy.swap(m);
+		FT_CHECK(same(copy, ref) && m.size() == assigned.size());
+		mmap_t ranged(copy.begin(), copy.end());
+		FT_CHECK(same(ranged, ref));
+		ranged.clear();
+		FT_CHECK(ranged.empty() && ranged.begin() == ranged.end());
+	}
+
+	{
+		mset_t s;
+		std::multiset<int> ref;
+		for (int i = 0; i < 30000; i++)
+		{
+			int k = rand() % 300;
+			if (rand() % 3 == 0)
+				FT_CHECK(s.erase(k) == ref.erase(k));
+			else if (rand() % 2 && s.count(k))
+			{
+				s.erase(s.find(k));
+				ref.erase(ref.find(k));
+			}
+			else
+			{
+				FT_CHECK(*s.insert(k) == k);
+				ref.insert(k);
+			}
+		}
+		FT_CHECK(same(s, ref));
+		bool ok = true;
+		for (int k = -1; k <= 300; k++)
+			ok = ok && s.count(k) == ref.count(k)
+				&& (s.lower_bound(k) == s.end() ? ref.lower_bound(k) == ref.end() : *s.lower_bound(k) == *ref.lower_bound(k));
+		FT_CHECK(ok);
+		mset_t copy(s);
+		s.erase(s.begin(), s.upper_bound(100));
+		ref.erase(ref.begin(), ref.upper_bound(100));
+		FT_CHECK(same(s, ref) && copy.size() > s.size() && *copy.begin() <= 100);
+	}
+	return ft_test::result("multimap");
+}
@@ -0,0 +1,782 @@
+#ifndef PERSISTENT_MAP_CLASS_HPP
+# define PERSISTENT_MAP_CLASS_HPP
+
+# include <stdexcept>
+# include "map.hpp"
+
+namespace ft
+{
+//여러 판이 함께 쓰는 노드. 만들어진 뒤에는 바뀌지 않고, refs가 0이 되면 지운다.
+template <class Value>
+struct __pnode
+{
+	Value			val;
+	__pnode			*left;
+	__pnode			*right;
+	volatile long	refs;
+	bool			red;
+};
+
+//부모 포인터가 없으므로 아직 오른쪽을 다 돌지 않은 조상들을 스택에 들고 다닌다. 맨 위가 현재 노드다.
+//레드블랙 트리의 높이는 2log(n+1)을 넘지 않으므로 크기를 고정해 둔다.
+template <class Node, class Value>
+class __pnode_iterator
+{
+public:
+	typedef Value						value_type;
+	typedef ptrdiff_t					difference_type;
+	typedef const value_type&			reference;
+	typedef const value_type*			pointer;
+	typedef std::forward_iterator_tag	iterator_category;
+
+	enum { max_depth = 2 * sizeof(size_t) * 8 };
+
+	const Node	*_stack[max_depth];
+	int			_depth;
+
+	__pnode_iterator(void) : _depth(0) {}
+
+	__pnode_iterator(const __pnode_iterator &src) : _depth(src._depth)
+	{
+		for (int i = 0; i < _depth; i++)
+			_stack[i] = src._stack[i];
+	}
+
+	__pnode_iterator &
+	operator=(const __pnode_iterator &rhs)
+	{
+		_depth = rhs._depth;
+		for (int i = 0; i < _depth; i++)
+			_stack[i] = rhs._stack[i];
+		return *this;
+	}
+
+	reference
+	operator*(void) const
+	{ return _stack[_depth - 1]->val; }
+
+	pointer
+	operator->(void) const
+	{ return &_stack[_depth - 1]->val; }
+
+	__pnode_iterator &
+	operator++(void)
+	{
+		const Node *n = _stack[--_depth]->right;
+
+		this->__push_left(n);
+		return *this;
+	}
+
+	__pnode_iterator
+	operator++(int)
+	{
+		__pnode_iterator tmp(*this);
+		++(*this);
+		return tmp;
+	}
+
+	bool
+	operator==(const __pnode_iterator &rhs) const
+	{
+		if (_depth == 0 || rhs._depth == 0)
+			return _depth == rhs._depth;
+		return _stack[_depth - 1] == rhs._stack[rhs._depth - 1];
+	}
+
+	bool
+	operator!=(const __pnode_iterator &rhs) const
+	{ return !(*this == rhs); }
+
+	void
+	__push(const Node *n)
+	{ _stack[_depth++] = n; }
+
+	void
+	__push_left(const Node *n)
+	{
+		for (; n != NULL; n = n->left)
+			_stack[_depth++] = n;
+	}
+};
+
+//판을 통째로 남길 수 있는 맵. 복사(snapshot)는 루트 하나를 공유하므로 O(1)이다.
+//insert/erase는 루트에서 바뀐 자리까지의 경로만 새로 만들고 나머지 노드는 옛 판과 함께 쓴다. (Kahrs의 함수형 레드블랙 트리)
+//노드 참조 수는 원자적으로 세므로 판마다 다른 스레드가 들고 있어도 된다. 한 판 객체를 여러 스레드가 함께 고치는 것은 안 된다.
+//원소는 여러 판이 함께 보므로 고칠 수 없다. 값을 바꾸려면 insert_or_assign을 쓴다.
+template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< ft::pair<const Key,T> > >
+class persistent_map
+{
+public:
+	typedef Key											key_type;
+	typedef T											mapped_type;
+	typedef ft::pair<const key_type, mapped_type>		value_type;
+	typedef Compare										key_compare;
+	typedef Alloc										allocator_type;
+	typedef typename allocator_type::const_reference	reference;
+	typedef typename allocator_type::const_reference	const_reference;
+	typedef typename allocator_type::const_pointer		pointer;
+	typedef typename allocator_type::const_pointer		const_pointer;
+	typedef ft::__pnode<value_type>						node_type;
+	typedef node_type*									node_ptr;
+
+	typedef ptrdiff_t									difference_type;
+	typedef size_t										size_type;
+
+	typedef ft::__pnode_iterator<node_type, value_type>	iterator;
+	typedef ft::__pnode_iterator<node_type, value_type>	const_iterator;
+
+	explicit persistent_map(const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	explicit persistent_map(const ft::map<Key, T, Compare, Alloc> &src);
+	template <class Ite>
+	persistent_map(typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+			Ite last, const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	persistent_map(const persistent_map &src);
+	virtual ~persistent_map(void);
+
+	persistent_map	&operator=(persistent_map const &rhs);
+
+	persistent_map	snapshot(void) const;
+
+	const_iterator	begin(void) const;
+	const_iterator	end(void) const;
+
+	size_type	size(void) const;
+	size_type	max_size(void) const;
+	bool		empty(void) const;
+
+	const mapped_type	&at(const key_type &k) const;
+
+	ft::pair<const_iterator, bool>	insert(const value_type &val);
+	template <class Ite> void		insert(Ite first, Ite last);
+	bool							insert_or_assign(const key_type &k, const mapped_type &v);
+
+	size_type	erase(const key_type &k);
+
+	void		swap(persistent_map &x);
+	void		clear(void);
+
+	key_compare		key_comp(void) const;
+
+	const_iterator	find(const key_type &k) const;
+	size_type		count(const key_type &k) const;
+	const_iterator	lower_bound(const key_type &k) const;
+	const_iterator	upper_bound(const key_type &k) const;
+
+	allocator_type	get_allocator(void) const;
+
+private:
+	typedef typename Alloc::template rebind<node_type>::other	node_allocator;
+
+	node_ptr		_root;
+	size_type		_size;
+	key_compare		_key_cmp;
+	allocator_type	_alloc;
+	node_allocator	_node_alloc;
+
+	static bool	__is_red(node_ptr n) { return n != NULL && n->red; }
+	static bool	__is_black(node_ptr n) { return n != NULL && !n->red; }
+
+	static node_ptr	__ref(node_ptr n);
+	void			__unref(node_ptr n);
+	node_ptr		__make(bool red, node_ptr l, const value_type &v, node_ptr r);
+
+	node_ptr	__blacken(node_ptr n);
+	node_ptr	__balance(node_ptr a, const value_type &x, node_ptr b);
+	node_ptr	__balleft(node_ptr l, const value_type &x, node_ptr r);
+	node_ptr	__balright(node_ptr l, const value_type &x, node_ptr r);
+	node_ptr	__sub1(node_ptr n);
+	node_ptr	__app(node_ptr a, node_ptr b);
+
+	node_ptr	__ins(node_ptr t, const value_type &x);
+	node_ptr	__upd(node_ptr t, const key_type &k, const mapped_type &v);
+	node_ptr	__del(node_ptr t, const key_type &k);
+	node_ptr	__lookup(const key_type &k) const;
+
+	template <class Ite> node_ptr	__build(Ite &first, size_type n, int depth, int red_depth);
+
+};
+
+template <class Key, class T, class Compare, class Alloc>
+persistent_map<Key, T, Compare, Alloc>::persistent_map(const key_compare &comp, const allocator_type &alloc) : \
+		_root(NULL), _size(0), _key_cmp(comp), _alloc(alloc)
+{
+}
+
+//정렬된 맵에서는 O(n)으로 만든다. 마지막 층만 빨간 노드로 둔다.
+template <class Key, class T, class Compare, class Alloc>
+persistent_map<Key, T, Compare, Alloc>::persistent_map(const ft::map<Key, T, Compare, Alloc> &src) : \
+		_root(NULL), _size(src.size()), _key_cmp(src.key_comp())
+{
+	typename ft::map<Key, T, Compare, Alloc>::const_iterator it = src.begin();
+	int full = 0;
+
+	while ((static_cast<size_type>(2) << full) - 1 <= this->_size)
+		full++;
+	this->_root = this->__build(it, this->_size, 0, full);
+}
+
+template <class Key, class T, class Compare, class Alloc> template <class Ite>
+persistent_map<Key, T, Compare, Alloc>::persistent_map(
+	typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+	Ite last, const key_compare &comp, const allocator_type &alloc) : \
+		_root(NULL), _size(0), _key_cmp(comp), _alloc(alloc)
+{
+	this->insert(first, last);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+persistent_map<Key, T, Compare, Alloc>::persistent_map(persistent_map const &src) : \
+		_root(__ref(src._root)), _size(src._size), _key_cmp(src._key_cmp), _alloc(src._alloc)
+{
+}
+
+template <class Key, class T, class Compare, class Alloc>
+persistent_map<Key, T, Compare, Alloc>::~persistent_map(void) {
+	this->__unref(this->_root);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+persistent_map<Key, T, Compare, Alloc>&
+persistent_map<Key, T, Compare, Alloc>::operator=(persistent_map const &rhs) {
+	node_ptr old = this->_root;
+
+	this->_root = __ref(rhs._root);
+	this->__unref(old);
+	this->_size = rhs._size;
+	this->_key_cmp = rhs._key_cmp;
+	return (*this);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+persistent_map<Key, T, Compare, Alloc>
+persistent_map<Key, T, Compare, Alloc>::snapshot(void) const {
+	return *this;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::const_iterator
+persistent_map<Key, T, Compare, Alloc>::begin(void) const {
+	const_iterator it;
+
+	it.__push_left(this->_root);
+	return it;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::const_iterator
+persistent_map<Key, T, Compare, Alloc>::end(void) const {
+	return const_iterator();
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::size_type
+persistent_map<Key, T, Compare, Alloc>::size(void) const {
+	return this->_size;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::size_type
+persistent_map<Key, T, Compare, Alloc>::max_size(void) const {
+	return this->_node_alloc.max_size();
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	persistent_map<Key, T, Compare, Alloc>::empty(void) const {
+	return (this->_size == 0);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+const typename persistent_map<Key, T, Compare, Alloc>::mapped_type&
+persistent_map<Key, T, Compare, Alloc>::at(const key_type &k) const
+{
+	node_ptr n = this->__lookup(k);
+
+	if (n == NULL)
+		throw std::out_of_range("persistent_map");
+	return n->val.second;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+ft::pair<typename persistent_map<Key, T, Compare, Alloc>::const_iterator, bool>
+persistent_map<Key, T, Compare, Alloc>::insert(const value_type &val)
+{
+	node_ptr old = this->_root;
+
+	if (this->__lookup(val.first) != NULL)
+		return ft::make_pair(this->find(val.first), false);
+	this->_root = this->__blacken(this->__ins(old, val));
+	this->__unref(old);
+	this->_size++;
+	return ft::make_pair(this->find(val.first), true);
+}
+
+template <class Key, class T, class Compare, class Alloc> template <class Ite>
+void	persistent_map<Key, T, Compare, Alloc>::insert(Ite first, Ite last) {
+	for (; first != last; ++first)
+		this->insert(*first);
+}
+
+//없으면 넣고 true, 있으면 그 경로만 복사해 값을 바꾸고 false.
+template <class Key, class T, class Compare, class Alloc>
+bool	persistent_map<Key, T, Compare, Alloc>::insert_or_assign(const key_type &k, const mapped_type &v)
+{
+	node_ptr old = this->_root;
+
+	if (this->__lookup(k) == NULL)
+	{
+		this->insert(value_type(k, v));
+		return true;
+	}
+	this->_root = this->__upd(old, k, v);
+	this->__unref(old);
+	return false;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::size_type
+persistent_map<Key, T, Compare, Alloc>::erase(const key_type &k)
+{
+	node_ptr old = this->_root;
+
+	if (this->__lookup(k) == NULL)
+		return 0;
+	this->_root = this->__blacken(this->__del(old, k));
+	this->__unref(old);
+	this->_size--;
+	return 1;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	persistent_map<Key, T, Compare, Alloc>::swap(persistent_map &x) {
+	std::swap(this->_root, x._root);
+	std::swap(this->_size, x._size);
+	std::swap(this->_key_cmp, x._key_cmp);
+	std::swap(this->_alloc, x._alloc);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	persistent_map<Key, T, Compare, Alloc>::clear(void) {
+	this->__unref(this->_root);
+	this->_root = NULL;
+	this->_size = 0;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::key_compare
+persistent_map<Key, T, Compare, Alloc>::key_comp(void) const {
+	return this->_key_cmp;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::node_ptr
+persistent_map<Key, T, Compare, Alloc>::__lookup(const key_type &k) const
+{
+	node_ptr n = this->_root;
+
+	while (n != NULL)
+	{
+		if (this->_key_cmp(k, n->val.first))
+			n = n->left;
+		else if (this->_key_cmp(n->val.first, k))
+			n = n->right;
+		else
+			return n;
+	}
+	return NULL;
+}
+
+//왼쪽으로 내려간 조상만 스택에 쌓는다.
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::const_iterator
+persistent_map<Key, T, Compare, Alloc>::find(const key_type &k) const
+{
+	const_iterator it;
+	node_ptr n = this->_root;
+
+	while (n != NULL)
+	{
+		if (this->_key_cmp(k, n->val.first))
+		{
+			it.__push(n);
+			n = n->left;
+		}
+		else if (this->_key_cmp(n->val.first, k))
+			n = n->right;
+		else
+		{
+			it.__push(n);
+			return it;
+		}
+	}
+	return this->end();
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::size_type
+persistent_map<Key, T, Compare, Alloc>::count(const key_type &k) const {
+	return (this->__lookup(k) != NULL);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::const_iterator
+persistent_map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) const
+{
+	const_iterator it;
+	node_ptr n = this->_root;
+
+	while (n != NULL)
+	{
+		if (this->_key_cmp(n->val.first, k))
+			n = n->right;
+		else
+		{
+			it.__push(n);
+			n = n->left;
+		}
+	}
+	return it;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::const_iterator
+persistent_map<Key, T, Compare, Alloc>::upper_bound(const key_type &k) const
+{
+	const_iterator it;
+	node_ptr n = this->_root;
+
+	while (n != NULL)
+	{
+		if (!this->_key_cmp(k, n->val.first))
+			n = n->right;
+		else
+		{
+			it.__push(n);
+			n = n->left;
+		}
+	}
+	return it;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::allocator_type
+persistent_map<Key, T, Compare, Alloc>::get_allocator(void) const {
+	return this->_alloc;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::node_ptr
+persistent_map<Key, T, Compare, Alloc>::__ref(node_ptr n)
+{
+	if (n != NULL)
+		__sync_fetch_and_add(&n->refs, 1);
+	return n;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	persistent_map<Key, T, Compare, Alloc>::__unref(node_ptr n)
+{
+	while (n != NULL && __sync_sub_and_fetch(&n->refs, 1) == 0)
+	{
+		node_ptr right = n->right;
+
+		this->__unref(n->left);
+		this->_alloc.destroy(&n->val);
+		this->_node_alloc.deallocate(n, 1);
+		n = right;
+	}
+}
+
+//아래에 오는 함수들은 l, r, a, b로 받은 노드의 참조를 가져가고, 새로 만든 노드의 참조를 돌려준다.
+//x나 t는 빌려 쓰기만 한다. 가져간 노드는 결과를 다 만든 뒤에 놓는다.
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::node_ptr
+persistent_map<Key, T, Compare, Alloc>::__make(bool red, node_ptr l, const value_type &v, node_ptr r)
+{
+	node_ptr n = this->_node_alloc.allocate(1);
+
+	this->_alloc.construct(&n->val, v);
+	n->left = l;
+	n->right = r;
+	n->refs = 1;
+	n->red = red;
+	return n;
+}
+
+//루트는 검게 칠한다. 혼자 들고 있는 노드면 그대로 칠하고, 함께 쓰는 노드면 복사한다.
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::node_ptr
+persistent_map<Key, T, Compare, Alloc>::__blacken(node_ptr n)
+{
+	node_ptr res;
+
+	if (!__is_red(n))
+		return n;
+	if (n->refs == 1)
+	{
+		n->red = false;
+		return n;
+	}
+	res = this->__make(false, __ref(n->left), n->val, __ref(n->right));
+	this->__unref(n);
+	return res;
+}
+
+//빨강-빨강을 풀며 검은 노드 하나로 묶는다.
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::node_ptr
+persistent_map<Key, T, Compare, Alloc>::__balance(node_ptr a, const value_type &x, node_ptr b)
+{
+	node_ptr res;
+
+	if (__is_red(a) && __is_red(b))
+	{
+		res = this->__make(true,
+				this->__make(false, __ref(a->left), a->val, __ref(a->right)), x,
+				this->__make(false, __ref(b->left), b->val, __ref(b->right)));
+		this->__unref(a);
+		this->__unref(b);
+	}
+	else if (__is_red(a) && __is_red(a->left))
+	{
+		res = this->__make(true,
+				this->__make(false, __ref(a->left->left), a->left->val, __ref(a->left->right)), a->val,
+				this->__make(false, __ref(a->right), x, b));
+		this->__unref(a);
+	}
+	else if (__is_red(a) && __is_red(a->right))
+	{
+		res = this->__make(true,
+				this->__make(false, __ref(a->left), a->val, __ref(a->right->left)), a->right->val,
+				this->__make(false, __ref(a->right->right), x, b));
+		this->__unref(a);
+	}
+	else if (__is_red(b) && __is_red(b->right))
+	{
+		res = this->__make(true,
+				this->__make(false, a, x, __ref(b->left)), b->val,
+				this->__make(false, __ref(b->right->left), b->right->val, __ref(b->right->right)));
+		this->__unref(b);
+	}
+	else if (__is_red(b) && __is_red(b->left))
+	{
+		res = this->__make(true,
+				this->__make(false, a, x, __ref(b->left->left)), b->left->val,
+				this->__make(false, __ref(b->left->right), b->val, __ref(b->right)));
+		this->__unref(b);
+	}
+	else
+		res = this->__make(false, a, x, b);
+	return res;
+}
+
+//검은 높이가 하나 줄어든 l을 맞춘다.
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::node_ptr
+persistent_map<Key, T, Compare, Alloc>::__balleft(node_ptr l, const value_type &x, node_ptr r)
+{
+	node_ptr res;
+
+	if (__is_red(l))
+	{
+		res = this->__make(true, this->__make(false, __ref(l->left), l->val, __ref(l->right)), x, r);
+		this->__unref(l);
+	}
+	else if (__is_black(r))
+	{
+		res = this->__balance(l, x, this->__make(true, __ref(r->left), r->val, __ref(r->right)));
+		this->__unref(r);
+	}
+	else
+	{
+		res = this->__make(true,
+				this->__make(false, l, x, __ref(r->left->left)), r->left->val,
+				this->__balance(__ref(r->left->right), r->val, this->__sub1(__ref(r->right))));
+		this->__unref(r);
+	}
+	return res;
+}
+
+//검은 높이가 하나 줄어든 r을 맞춘다.
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::node_ptr
+persistent_map<Key, T, Compare, Alloc>::__balright(node_ptr l, const value_type &x, node_ptr r)
+{
+	node_ptr res;
+
+	if (__is_red(r))
+	{
+		res = this->__make(true, l, x, this->__make(false, __ref(r->left), r->val, __ref(r->right)));
+		this->__unref(r);
+	}
+	else if (__is_black(l))
+	{
+		res = this->__balance(this->__make(true, __ref(l->left), l->val, __ref(l->right)), x, r);
+		this->__unref(l);
+	}
+	else
+	{
+		res = this->__make(true,
+				this->__balance(this->__sub1(__ref(l->left)), l->val, __ref(l->right->left)), l->right->val,
+				this->__make(false, __ref(l->right->right), x, r));
+		this->__unref(l);
+	}
+	return res;
+}
+
+//검은 노드를 빨갛게 바꿔 검은 높이를 하나 줄인다.
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::node_ptr
+persistent_map<Key, T, Compare, Alloc>::__sub1(node_ptr n)
+{
+	node_ptr res = this->__make(true, __ref(n->left), n->val, __ref(n->right));
+
+	this->__unref(n);
+	return res;
+}
+
+//지운 노드의 두 서브트리를 이어 붙인다.
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::node_ptr
+persistent_map<Key, T, Compare, Alloc>::__app(node_ptr a, node_ptr b)
+{
+	node_ptr res;
+	node_ptr bc;
+
+	if (a == NULL)
+		return b;
+	if (b == NULL)
+		return a;
+	if (a->red && b->red)
+	{
+		bc = this->__app(__ref(a->right), __ref(b->left));
+		if (__is_red(bc))
+		{
+			res = this->__make(true,
+					this->__make(true, __ref(a->left), a->val, __ref(bc->left)), bc->val,
+					this->__make(true, __ref(bc->right), b->val, __ref(b->right)));
+			this->__unref(bc);
+		}
+		else
+			res = this->__make(true, __ref(a->left), a->val, this->__make(true, bc, b->val, __ref(b->right)));
+		this->__unref(a);
+		this->__unref(b);
+	}
+	else if (!a->red && !b->red)
+	{
+		bc = this->__app(__ref(a->right), __ref(b->left));
+		if (__is_red(bc))
+		{
+			res = this->__make(true,
+					this->__make(false, __ref(a->left), a->val, __ref(bc->left)), bc->val,
+					this->__make(false, __ref(bc->right), b->val, __ref(b->right)));
+			this->__unref(bc);
+		}
+		else
+			res = this->__balleft(__ref(a->left), a->val, this->__make(false, bc, b->val, __ref(b->right)));
+		this->__unref(a);
+		this->__unref(b);
+	}
+	else if (b->red)
+	{
+		res = this->__make(true, this->__app(a, __ref(b->left)), b->val, __ref(b->right));
+		this->__unref(b);
+	}
+	else
+	{
+		res = this->__make(true, __ref(a->left), a->val, this->__app(__ref(a->right), b));
+		this->__unref(a);
+	}
+	return res;
+}
+
+//x의 키가 t에 없을 때만 부른다.
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::node_ptr
+persistent_map<Key, T, Compare, Alloc>::__ins(node_ptr t, const value_type &x)
+{
+	if (t == NULL)
+		return this->__make(true, NULL, x, NULL);
+	if (this->_key_cmp(x.first, t->val.first))
+	{
+		if (t->red)
+			return this->__make(true, this->__ins(t->left, x), t->val, __ref(t->right));
+		return this->__balance(this->__ins(t->left, x), t->val, __ref(t->right));
+	}
+	if (t->red)
+		return this->__make(true, __ref(t->left), t->val, this->__ins(t->right, x));
+	return this->__balance(__ref(t->left), t->val, this->__ins(t->right, x));
+}
+
+//k가 t에 있을 때만 부른다. 모양은 그대로 두고 값만 바꾼 경로를 만든다.
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::node_ptr
+persistent_map<Key, T, Compare, Alloc>::__upd(node_ptr t, const key_type &k, const mapped_type &v)
+{
+	if (this->_key_cmp(k, t->val.first))
+		return this->__make(t->red, this->__upd(t->left, k, v), t->val, __ref(t->right));
+	if (this->_key_cmp(t->val.first, k))
+		return this->__make(t->red, __ref(t->left), t->val, this->__upd(t->right, k, v));
+	return this->__make(t->red, __ref(t->left), value_type(t->val.first, v), __ref(t->right));
+}
+
+//k가 t에 있을 때만 부른다.
+template <class Key, class T, class Compare, class Alloc>
+typename persistent_map<Key, T, Compare, Alloc>::node_ptr
+persistent_map<Key, T, Compare, Alloc>::__del(node_ptr t, const key_type &k)
+{
+	if (this->_key_cmp(k, t->val.first))
+	{
+		if (__is_black(t->left))
+			return this->__balleft(this->__del(t->left, k), t->val, __ref(t->right));
+		return this->__make(true, this->__del(t->left, k), t->val, __ref(t->right));
+	}
+	if (this->_key_cmp(t->val.first, k))
+	{
+		if (__is_black(t->right))
+			return this->__balright(__ref(t->left), t->val, this->__del(t->right, k));
+		return this->__make(true, __ref(t->left), t->val, this->__del(t->right, k));
+	}
+	return this->__app(__ref(t->left), __ref(t->right));
+}
+
+//정렬된 first에서 n개로 균형 잡힌 트리를 만든다. red_depth 층의 노드만 빨갛다.
+template <class Key, class T, class Compare, class Alloc> template <class Ite>
+typename persistent_map<Key, T, Compare, Alloc>::node_ptr
+persistent_map<Key, T, Compare, Alloc>::__build(Ite &first, size_type n, int depth, int red_depth)
+{
+	node_ptr left;
+	node_ptr res;
+
+	if (n == 0)
+		return NULL;
+	left = this->__build(first, (n - 1) / 2, depth + 1, red_depth);
+	res = this->__make(depth == red_depth, left, *first, NULL);
+	++first;
+	res->right = this->__build(first, n - 1 - (n - 1) / 2, depth + 1, red_depth);
+	return res;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator==(const persistent_map<Key, T, Compare, Alloc> &lhs,
+					const persistent_map<Key, T, Compare, Alloc> &rhs)
+{
+	return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	operator!=(const persistent_map<Key, T, Compare, Alloc> &lhs,
+					const persistent_map<Key, T, Compare, Alloc> &rhs) {
+	return !(lhs == rhs);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	swap(persistent_map<Key, T, Compare, Alloc> &x, persistent_map<Key, T, Compare, Alloc> &y) {
+	x.swap(y);
+}
+
+}
+
+#endif
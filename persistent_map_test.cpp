@@ -0,0 +1,159 @@
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <pthread.h>
+#include <stdlib.h>
+#include "persistent_map.hpp"
+#include "tester.hpp"
+
+//지금 살아 있는 노드 수를 센다. 판을 모두 버리면 0으로 돌아와야 한다.
+static volatile long	g_live = 0;
+
+template <class T>
+class CountAlloc : public std::allocator<T>
+{
+public:
+	template <class U>
+	struct rebind { typedef CountAlloc<U> other; };
+
+	CountAlloc(void) {}
+	template <class U>
+	CountAlloc(const CountAlloc<U> &) {}
+
+	T *
+	allocate(size_t n, const void * = 0)
+	{
+		__sync_fetch_and_add(&g_live, static_cast<long>(n));
+		return std::allocator<T>::allocate(n);
+	}
+
+	void
+	deallocate(T *p, size_t n)
+	{
+		__sync_fetch_and_sub(&g_live, static_cast<long>(n));
+		std::allocator<T>::deallocate(p, n);
+	}
+};
+
+typedef ft::persistent_map<int, int, std::less<int>, CountAlloc<ft::pair<const int, int> > >	map_t;
+
+static bool
+same(const map_t &m, const std::map<int, int> &ref)
+{
+	if (m.size() != ref.size())
+		return false;
+	std::map<int, int>::const_iterator r = ref.begin();
+	for (map_t::const_iterator it = m.begin(); it != m.end(); ++it, ++r)
+		if (r == ref.end() || it->first != r->first || it->second != r->second)
+			return false;
+	return r == ref.end();
+}
+
+//판 하나를 여러 스레드가 복사하고 버린다. 참조 수가 어긋나면 노드가 새거나 두 번 지워진다.
+static map_t	g_shared;
+
+static void *
+holder(void *)
+{
+	long sum = 0;
+
+	for (int i = 0; i < 2000; i++)
+	{
+		map_t mine = g_shared.snapshot();
+		mine.insert_or_assign(i % 64, -i);
+		mine.erase(i % 64 + 64);
+		sum += mine.size();
+	}
+	return sum == 2000L * 127 ? NULL : reinterpret_cast<void *>(1);
+}
+
+int main(void)
+{
+	srand(40);
+	{
+		map_t m;
+		std::map<int, int> ref;
+		std::vector<map_t> versions;
+		std::vector<std::map<int, int> > refs;
+
+		//바꾸는 도중 남긴 판은 그 뒤의 쓰기를 보지 않는다.
+		for (int i = 0; i < 30000; i++)
+		{
+			int k = rand() % 3000;
+			switch (rand() % 3)
+			{
+			case 0:
+				FT_CHECK(m.erase(k) == ref.erase(k));
+				break;
+			case 1:
+				FT_CHECK(m.insert(ft::make_pair(k, i)).second == ref.insert(std::make_pair(k, i)).second);
+				break;
+			default:
+				FT_CHECK(m.insert_or_assign(k, i) == (ref.count(k) == 0));
+				ref[k] = i;
+			}
+			if (i % 1000 == 0)
+			{
+				versions.push_back(m.snapshot());
+				refs.push_back(ref);
+			}
+		}
+		FT_CHECK(same(m, ref));
+		bool ok = true;
+		for (size_t v = 0; v < versions.size(); v++)
+			ok = ok && same(versions[v], refs[v]);
+		FT_CHECK(ok);
+
+		FT_CHECK(m.lower_bound(1500)->first == ref.lower_bound(1500)->first);
+		FT_CHECK(m.upper_bound(1500)->first == ref.upper_bound(1500)->first);
+		FT_CHECK(m.find(-1) == m.end() && m.count(-1) == 0);
+		bool thrown = false;
+		try { m.at(-1); } catch (std::out_of_range &) { thrown = true; }
+		FT_CHECK(thrown && m.at(ref.begin()->first) == ref.begin()->second);
+
+		//판끼리 대입과 swap은 루트만 바꾼다.
+		map_t a = versions[3];
+		a = versions[5];
+		FT_CHECK(same(a, refs[5]));
+		a.swap(versions[3]);
+		FT_CHECK(same(a, refs[3]) && same(versions[3], refs[5]));
+		a.clear();
+		FT_CHECK(a.empty() && a.begin() == a.end() && same(versions[3], refs[5]));
+	}
+	FT_CHECK(g_live == 0);
+
+	//ft::map과 구간에서 만들기.
+	{
+		ft::map<int, int, std::less<int>, CountAlloc<ft::pair<const int, int> > > src;
+		std::map<int, int> ref;
+		for (int n = 0; n < 300; n++)
+		{
+			map_t built(src);
+			map_t ranged(src.begin(), src.end());
+			FT_CHECK(same(built, ref) && same(ranged, ref));
+			built.insert(ft::make_pair(-1, -1));
+			FT_CHECK(built.size() == ref.size() + 1 && built.begin()->first == -1);
+			src[n * 7] = n;
+			ref[n * 7] = n;
+		}
+	}
+	FT_CHECK(g_live == 0);
+
+	for (int k = 0; k < 128; k++)
+		g_shared.insert(ft::make_pair(k, k));
+	pthread_t th[4];
+	for (int t = 0; t < 4; t++)
+		pthread_create(&th[t], NULL, holder, NULL);
+	bool ok = true;
+	for (int t = 0; t < 4; t++)
+	{
+		void *bad;
+		pthread_join(th[t], &bad);
+		ok = ok && bad == NULL;
+	}
+	FT_CHECK(ok && g_shared.size() == 128 && g_shared.at(5) == 5);
+	g_shared.clear();
+	FT_CHECK(g_live == 0);
+	return ft_test::result("persistent_map");
+}
@@ -0,0 +1,353 @@
+#ifndef RADIX_SORT_HPP
+# define RADIX_SORT_HPP
+
+# include <algorithm>
+# include <climits>
+# include <functional>
+# include <limits>
+# include "vector.hpp"
+
+//스레드 풀 없이 쓰는 정렬. sort, stable_sort, radix_sort.
+//map, set처럼 정렬만 필요한 헤더는 pthread를 끌어오지 않도록 algorithm.hpp 대신 이것을 넣는다.
+namespace ft
+{
+/*
+** sort (introsort)
+*/
+//이보다 짧은 구간은 삽입정렬이 더 빠르다.
+static const size_t __insertion_threshold = 16;
+
+template <class It, class Comp>
+void
+__insertion_sort(It first, It last, Comp comp)
+{
+	typedef typename ft::iterator_traits<It>::value_type value_type;
+
+	if (first == last)
+		return ;
+	for (It i = first + 1; i != last; ++i)
+	{
+		value_type val = *i;
+		It j = i;
+		for (; j != first && comp(val, *(j - 1)); --j)
+			*j = *(j - 1);
+		*j = val;
+	}
+}
+
+template <class It, class Comp>
+void
+__sift_down(It first, size_t root, size_t n, Comp comp)
+{
+	typedef typename ft::iterator_traits<It>::value_type value_type;
+
+	value_type val = first[root];
+	size_t child;
+	while ((child = 2 * root + 1) < n)
+	{
+		if (child + 1 < n && comp(first[child], first[child + 1]))
+			++child;
+		if (!comp(val, first[child]))
+			break;
+		first[root] = first[child];
+		root = child;
+	}
+	first[root] = val;
+}
+
+//재귀가 너무 깊어지면(나쁜 피벗이 반복될 때) 힙정렬로 바꿔 O(n log n)을 보장.
+template <class It, class Comp>
+void
+__heap_sort(It first, It last, Comp comp)
+{
+	size_t n = static_cast<size_t>(last - first);
+
+	for (size_t i = n / 2; i > 0; --i)
+		ft::__sift_down(first, i - 1, n, comp);
+	for (size_t i = n; i > 1; --i)
+	{
+		std::swap(first[0], first[i - 1]);
+		ft::__sift_down(first, 0, i - 1, comp);
+	}
+}
+
+//세 값의 중간값을 first로 옮겨 피벗으로 쓴다.
+template <class It, class Comp>
+void
+__median_to_first(It first, It a, It b, It c, Comp comp)
+{
+	if (comp(*a, *b))
+	{
+		if (comp(*b, *c))
+			std::swap(*first, *b);
+		else if (comp(*a, *c))
+			std::swap(*first, *c);
+		else
+			std::swap(*first, *a);
+	}
+	else if (comp(*a, *c))
+		std::swap(*first, *a);
+	else if (comp(*b, *c))
+		std::swap(*first, *c);
+	else
+		std::swap(*first, *b);
+}
+
+template <class It, class Comp>
+It
+__partition_pivot(It first, It last, Comp comp)
+{
+	It mid = first + (last - first) / 2;
+	ft::__median_to_first(first, first + 1, mid, last - 1, comp);
+	It left = first + 1;
+	It right = last;
+	for (;;)
+	{
+		while (comp(*left, *first))
+			++left;
+		--right;
+		while (comp(*first, *right))
+			--right;
+		if (!(left < right))
+			return left;
+		std::swap(*left, *right);
+		++left;
+	}
+}
+
+template <class It, class Comp>
+void
+__introsort_loop(It first, It last, size_t depth, Comp comp)
+{
+	while (static_cast<size_t>(last - first) > __insertion_threshold)
+	{
+		if (depth == 0)
+		{
+			ft::__heap_sort(first, last, comp);
+			return ;
+		}
+		--depth;
+		It cut = ft::__partition_pivot(first, last, comp);
+		ft::__introsort_loop(cut, last, depth, comp);
+		last = cut;
+	}
+}
+
+template <class It, class Comp>
+void
+sort(It first, It last, Comp comp)
+{
+	size_t n = static_cast<size_t>(last - first);
+	size_t depth = 0;
+
+	if (n < 2)
+		return ;
+	for (size_t k = n; k > 1; k >>= 1)
+		depth += 2;
+	ft::__introsort_loop(first, last, depth, comp);
+	ft::__insertion_sort(first, last, comp);
+}
+
+template <class It>
+void
+sort(It first, It last)
+{
+	ft::sort(first, last, std::less<typename ft::iterator_traits<It>::value_type>());
+}
+
+/*
+** stable_sort (merge sort)
+*/
+//정렬된 [first, mid)와 [mid, last)를 합친다. 왼쪽 구간은 buf에 옮겨두고 쓴다.
+//값이 같으면 왼쪽을 먼저 내보내서 순서가 유지된다.
+template <class It, class T, class Comp>
+void
+__merge_adjacent(It first, It mid, It last, T *buf, Comp comp)
+{
+	if (first == mid || mid == last || !comp(*mid, *(mid - 1)))
+		return ;
+	T *b = buf;
+	for (It it = first; it != mid; ++it)
+		*b++ = *it;
+	T *l = buf;
+	It r = mid;
+	It out = first;
+	while (l != b && r != last)
+	{
+		if (comp(*r, *l))
+			*out++ = *r++;
+		else
+			*out++ = *l++;
+	}
+	while (l != b)
+		*out++ = *l++;
+}
+
+template <class It, class T, class Comp>
+void
+__merge_sort(It first, It last, T *buf, Comp comp)
+{
+	size_t n = static_cast<size_t>(last - first);
+
+	if (n <= __insertion_threshold * 2)
+	{
+		ft::__insertion_sort(first, last, comp);
+		return ;
+	}
+	It mid = first + n / 2;
+	ft::__merge_sort(first, mid, buf, comp);
+	ft::__merge_sort(mid, last, buf, comp);
+	ft::__merge_adjacent(first, mid, last, buf, comp);
+}
+
+template <class It, class Comp>
+void
+stable_sort(It first, It last, Comp comp)
+{
+	typedef typename ft::iterator_traits<It>::value_type value_type;
+
+	size_t n = static_cast<size_t>(last - first);
+	if (n < 2)
+		return ;
+	ft::vector<value_type> buf(first, first + (n + 1) / 2);
+	ft::__merge_sort(first, last, &buf[0], comp);
+}
+
+template <class It>
+void
+stable_sort(It first, It last)
+{
+	ft::stable_sort(first, last, std::less<typename ft::iterator_traits<It>::value_type>());
+}
+
+/*
+** radix_sort (LSD, 8비트 자리)
+*/
+//unsigned long에 담기는 정수 키만 자리로 나눈다. 더 넓은 키는 비교 정렬을 쓴다.
+template <typename K>
+struct __radix_key
+{
+	static bool const value = std::numeric_limits<K>::is_integer && sizeof(K) <= sizeof(unsigned long);
+};
+
+//radix_sort가 다룰 수 있는 값과, 그 값의 정렬 키.
+template <typename T>
+struct __radix_traits
+{
+	static bool const value = __radix_key<T>::value;
+	typedef T	key_type;
+
+	static const key_type &
+	key(const T &v)
+	{ return v; }
+};
+
+template <typename K, typename V>
+struct __radix_traits<ft::pair<K, V> >
+{
+	static bool const value = __radix_key<K>::value;
+	typedef K	key_type;
+
+	static const key_type &
+	key(const ft::pair<K, V> &v)
+	{ return v.first; }
+};
+
+//radix_sort로 정렬한 순서가 비교함수의 순서와 같은 키. (정수 키 + std::less)
+template <typename Key, typename Comp>
+struct is_radix_orderable
+{
+	static bool const value = false;
+};
+
+template <typename Key>
+struct is_radix_orderable<Key, std::less<Key> >
+{
+	static bool const value = __radix_key<Key>::value;
+};
+
+//키를 부호없는 정수로 바꾼다. 부호있는 타입은 부호비트를 뒤집으면 크기 순서가 그대로 유지된다.
+//K는 __radix_key를 만족하므로 밀어내는 폭이 unsigned long의 비트 수를 넘지 않는다.
+template <typename K>
+unsigned long
+__radix_bits(const K &k)
+{
+	const size_t key_bits = sizeof(K) * CHAR_BIT;
+	const size_t word_bits = sizeof(unsigned long) * CHAR_BIT;
+	unsigned long bits = static_cast<unsigned long>(k);
+
+	if (std::numeric_limits<K>::is_signed)
+		bits ^= 1UL << (key_bits - 1);
+	if (key_bits >= word_bits)
+		return bits;
+	return bits & (~0UL >> (word_bits - key_bits));
+}
+
+template <typename T>
+struct __radix_less
+{
+	bool
+	operator()(const T &a, const T &b) const
+	{ return __radix_traits<T>::key(a) < __radix_traits<T>::key(b); }
+};
+
+//이보다 작은 입력은 히스토그램을 만드는 비용이 더 크다.
+static const size_t __radix_threshold = 256;
+
+//키만 보고 정렬하는 안정 정렬. pair는 first만 키로 쓰고 같은 키끼리는 입력 순서를 유지한다.
+//작은 입력은 비교 정렬로 넘긴다. (정수는 순서가 보이지 않으니 introsort, pair는 안정성을 위해 stable_sort)
+template <class It>
+typename ft::enable_if<__radix_traits<typename ft::iterator_traits<It>::value_type>::value>::type
+radix_sort(It first, It last)
+{
+	typedef typename ft::iterator_traits<It>::value_type	value_type;
+	typedef __radix_traits<value_type>						traits;
+	typedef typename traits::key_type						key_type;
+
+	const size_t n = static_cast<size_t>(last - first);
+	if (n < __radix_threshold)
+	{
+		if (std::numeric_limits<value_type>::is_integer)
+			ft::sort(first, last, __radix_less<value_type>());
+		else
+			ft::stable_sort(first, last, __radix_less<value_type>());
+		return ;
+	}
+
+	const size_t passes = sizeof(key_type);
+	size_t count[sizeof(key_type)][256] = {};
+	ft::vector<value_type> a(first, last);
+	ft::vector<value_type> b(a);
+	value_type *src = &a[0];
+	value_type *dst = &b[0];
+
+	//모든 자리의 히스토그램을 한 번에 센다.
+	for (size_t i = 0; i < n; i++)
+	{
+		unsigned long bits = ft::__radix_bits(traits::key(src[i]));
+		for (size_t p = 0; p < passes; p++)
+			++count[p][(bits >> (p * 8)) & 0xFF];
+	}
+	for (size_t p = 0; p < passes; p++)
+	{
+		size_t *c = count[p];
+		//모든 키의 이 자리 값이 같으면 건너뛴다.
+		if (c[(ft::__radix_bits(traits::key(src[0])) >> (p * 8)) & 0xFF] == n)
+			continue;
+		size_t offset = 0;
+		for (size_t d = 0; d < 256; d++)
+		{
+			size_t cnt = c[d];
+			c[d] = offset;
+			offset += cnt;
+		}
+		for (size_t i = 0; i < n; i++)
+			dst[c[(ft::__radix_bits(traits::key(src[i])) >> (p * 8)) & 0xFF]++] = src[i];
+		std::swap(src, dst);
+	}
+	for (size_t i = 0; i < n; i++)
+		first[i] = src[i];
+}
+}
+
+#endif
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <set>
+#include <vector>
+#include <stdlib.h>
+#include "radix_sort.hpp"
+#include "map.hpp"
+#include "set.hpp"
+#include "tester.hpp"
+
+//unsigned long보다 넓은 정수처럼 보이는 키. 자리로 나누지 않아야 한다.
+struct Wide
+{
+	unsigned long	hi;
+	unsigned long	lo;
+};
+
+namespace std
+{
+template <>
+struct numeric_limits<Wide>
+{
+	static const bool	is_integer = true;
+	static const bool	is_signed = false;
+};
+}
+
+template <typename T>
+static void
+check_sort(size_t n, long range)
+{
+	ft::vector<T> v;
+	std::vector<T> ref;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		T x = static_cast<T>(rand() % range - range / 2);
+		v.push_back(x);
+		ref.push_back(x);
+	}
+	ft::radix_sort(v.begin(), v.end());
+	std::sort(ref.begin(), ref.end());
+	FT_CHECK(std::equal(ref.begin(), ref.end(), v.begin()));
+}
+
+int main(void)
+{
+	srand(7);
+	//__radix_threshold 아래는 비교 정렬, 위는 자리 정렬.
+	size_t sizes[] = {0, 1, 100, 255, 256, 10000};
+
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+	{
+		check_sort<int>(sizes[s], 2000000);
+		check_sort<char>(sizes[s], 200);
+		check_sort<unsigned char>(sizes[s], 200);
+		check_sort<short>(sizes[s], 60000);
+		check_sort<long>(sizes[s], 2000000000);
+		check_sort<long long>(sizes[s], 2000000000);
+		check_sort<unsigned int>(sizes[s], 2000000000);
+	}
+
+	//극단값과 부호.
+	ft::vector<long> ext;
+	ext.push_back(std::numeric_limits<long>::max());
+	ext.push_back(std::numeric_limits<long>::min());
+	ext.push_back(0);
+	ext.push_back(-1);
+	for (int i = 0; i < 300; i++)
+		ext.push_back(rand() - RAND_MAX / 2);
+	std::vector<long> ext_ref(ext.begin(), ext.end());
+	ft::radix_sort(ext.begin(), ext.end());
+	std::sort(ext_ref.begin(), ext_ref.end());
+	FT_CHECK(std::equal(ext_ref.begin(), ext_ref.end(), ext.begin()));
+
+	//pair는 first만 보고, 같은 키는 넣은 순서를 유지한다.
+	ft::vector<ft::pair<int, int> > p;
+	std::vector<std::pair<int, int> > pref;
+	for (int i = 0; i < 5000; i++)
+	{
+		int k = rand() % 100 - 50;
+		p.push_back(ft::make_pair(k, i));
+		pref.push_back(std::make_pair(k, i));
+	}
+	ft::radix_sort(p.begin(), p.end());
+	std::stable_sort(pref.begin(), pref.end());
+	bool stable = true;
+	for (size_t i = 0; i < p.size(); i++)
+		stable = stable && p[i].first == pref[i].first && p[i].second == pref[i].second;
+	FT_CHECK(stable);
+
+	//넓은 키는 자리 정렬과 map의 정수 대량 생성 경로를 타지 않는다.
+	FT_CHECK(!ft::__radix_key<Wide>::value);
+	FT_CHECK(!(ft::is_radix_orderable<Wide, std::less<Wide> >::value));
+	FT_CHECK((ft::is_radix_orderable<long, std::less<long> >::value));
+	FT_CHECK(!(ft::is_radix_orderable<int, std::greater<int> >::value));
+
+	//정렬되지 않은 정수 입력으로 map과 set을 만든다. 같은 키는 처음 것만 남는다.
+	std::vector<std::pair<int, int> > in;
+	for (int i = 0; i < 20000; i++)
+		in.push_back(std::make_pair(rand() % 5000 - 2500, i));
+	ft::vector<ft::pair<int, int> > fin;
+	for (size_t i = 0; i < in.size(); i++)
+		fin.push_back(ft::make_pair(in[i].first, in[i].second));
+	ft::map<int, int> m(fin.begin(), fin.end());
+	std::map<int, int> mref(in.begin(), in.end());
+	FT_CHECK(m.size() == mref.size());
+	bool same = true;
+	std::map<int, int>::iterator r = mref.begin();
+	for (ft::map<int, int>::iterator it = m.begin(); it != m.end(); ++it, ++r)
+		same = same && it->first == r->first && it->second == r->second;
+	FT_CHECK(same);
+
+	ft::vector<int> keys;
+	for (size_t i = 0; i < in.size(); i++)
+		keys.push_back(in[i].first);
+	ft::set<int> s(keys.begin(), keys.end());
+	std::set<int> sref(keys.begin(), keys.end());
+	FT_CHECK(s.size() == sref.size() && std::equal(sref.begin(), sref.end(), s.begin()));
+	return ft_test::result("radix_sort");
+}
@@ -1,6 +1,12 @@
 #ifndef RBT_CLASS_HPP
 # define RBT_CLASS_HPP
 
+# include <cstddef>
+# include <iostream>
+# include <functional>
+# include <limits>
+# include <memory>
+
 namespace ft 
 {
 //rbt노드 구조체
@@ -17,22 +23,48 @@ struct	rbtNode
 	rbtNode(const T &data_ = T()) : _is_black(false), _is_nul(false), _data(data_), _parent(NULL), _left(NULL), _right(NULL) {};
 };
 
-template<typename T, typename Comp = std::less<T>, typename Alloc = std::allocator<T> >
-class rbt
+//부분트리 요약값을 두지 않는 기본 정책.
+//요약값을 둘 때는 enabled를 true로 하고, update(n)에서 n과 두 자식의 요약값으로 n의 요약값을 다시 계산한다.
+//construct, destroy는 노드의 값을 만든 뒤, 지우기 전에 불려 요약값 칸을 만들고 지운다.
+struct __rbt_no_augment
+{
+	static const bool	enabled = false;
+
+	template <class Node>
+	void	construct(Node *) const {}
+	template <class Node>
+	void	destroy(Node *) const {}
+	template <class Node>
+	void	update(Node *) const {}
+};
+
+//균형 정책. rb_balance는 레드블랙 트리, splay_balance는 넣거나 찾거나 지운 노드(또는 그 부모)를 루트로 끌어올린다.
+//splay는 자주 찾는 키가 루트 가까이에 모여 치우친 조회에 유리하지만, 찾기도 트리를 바꾸고
+//한 번의 연산은 최악 O(n)일 수 있다. (분할상환 O(log n))
+struct rb_balance
+{
+	static const bool	splay = false;
+};
+
+struct splay_balance
+{
+	static const bool	splay = true;
+};
+
+//rbt의 연결과 균형 잡기만 맡는다. 노드는 _is_black, _is_nul, _parent, _left, _right만 있으면 되고 값은 보지 않는다.
+//ft::rbt와 침습형 트리(intrusive_rbt.hpp)가 함께 쓴다. 회전은 루트의 부모를 NULL로 보므로
+//끝 노드(end)는 __link, __unlink 동안만 떼어 두었다가 다시 루트의 부모이자 양쪽 자식으로 건다.
+template <typename Node, typename Augment = __rbt_no_augment, typename Balance = rb_balance>
+class rbt_base
 {
 public:
-	typedef rbtNode<T>		node;
+	typedef Node	node;
 	node	*_root;
-	Comp	_comp;
-	Alloc	_alloc;
+	Augment	_augment;
 
-private:
-	node	*_inserted_node;
-	node	*_end_node;
-	size_t	_size;
-	size_t	_max_size;
-	typename Alloc::template rebind<node>::other _node_alloc;
+	rbt_base(void) : _root(NULL) {}
 
+protected:
     node	*most_right(node *node) const {
         while (node->_right != NULL)
             node = node->_right;
@@ -45,112 +77,202 @@ private:
         return (node);
     }
 
-public:
-	rbt(const Comp& comp_ = Comp(), const Alloc& alloc_ = Alloc()) : _root(NULL), _comp(comp_), _alloc(alloc_), _inserted_node(NULL) , _size(0)
+	//NULL 잎은 검정.
+	static bool
+	__is_black(node *node_)
 	{
-		size_t div = sizeof( node ) / 2;
-		if (div == 0)
-			div = 1;
-		this->_max_size = std::numeric_limits<ptrdiff_t>::max() / div;
+		return (node_ == NULL || node_->_is_black);
+	}
 
-		node *nul		=  _node_alloc.allocate(1);
-		_alloc.construct(&nul->_data, T());
-		nul->_is_nul = true;
-		nul->_is_black = true;
-		_end_node = nul;
+	void
+	__open(node *end)
+	{
+		end->_left = NULL;
+		end->_right = NULL;
+		if (_root != NULL)
+			_root->_parent = NULL;
 	}
 
-	~rbt() { 
-		clear();
-		_alloc.destroy(&_end_node->_data);
-		_node_alloc.deallocate(_end_node, 1);
-		};
+	void
+	__close(node *end)
+	{
+		if (_root != NULL)
+			_root->_parent = end;
+		end->_left = _root;
+		end->_right = _root;
+	}
 
-	node*
-	begin() const {
-		if (_size == 0)
-			return _end_node;
-		return this->most_left(this->_root);
-		};
+	//parent의 left(또는 right) 빈자리에 n을 빨강으로 걸고 균형을 맞춘다. 빈 트리면 parent는 NULL.
+	void
+	__link(node *end, node *n, node *parent, bool left)
+	{
+		n->_is_black = false;
+		n->_is_nul = false;
+		n->_parent = parent;
+		n->_left = NULL;
+		n->_right = NULL;
+		this->__open(end);
+		if (parent == NULL)
+			_root = n;
+		else if (left)
+			parent->_left = n;
+		else
+			parent->_right = n;
+		this->__update_path(n);
+		if (Balance::splay)
+			this->__splay(n);
+		else
+			this->insert_case1(n);
+		this->__close(end);
+	}
 
-	node*
-	end() const
+	//찾은 노드를 알린다. splay_balance면 루트로 끌어올린다.
+	void
+	__access(node *end, node *n)
 	{
-		return _end_node;
+		if (!Balance::splay || n == _root)
+			return ;
+		this->__open(end);
+		this->__splay(n);
+		this->__close(end);
 	}
 
-	node*
-	rbegin() const {
-		if (_size == 0)
-			return _end_node;		
-		return this->most_right(this->_root);
-		};
+	//n을 트리에서 떼어 낸다. 값을 옮기지 않고 노드 자리를 바꾸므로 다른 노드의 주소와 반복자는 그대로다.
+	void
+	__unlink(node *end, node *n)
+	{
+		this->__open(end);
+		if (n->_left != NULL && n->_right != NULL)
+		{
+			this->__swap_nodes(n, this->most_left(n->_right));
+			this->_augment.update(n);
+		}
 
-	node*
-	rend() const
+		node *child = (n->_left != NULL) ? n->_left : n->_right;
+
+		//자식이 하나뿐이면 n은 검정, 자식은 빨강이다.
+		if (!Balance::splay && child != NULL)
+			child->_is_black = true;
+		else if (!Balance::splay && n->_is_black)
+			this->delete_case1(n);
+		this->__replace(n, child);
+		//회전한 노드는 그때그때 고쳤고, n이 빠지면서 요약값이 바뀌는 것은 n의 조상뿐이다.
+		this->__update_path(n->_parent);
+		if (Balance::splay && n->_parent != NULL)
+			this->__splay(n->_parent);
+		this->__close(end);
+		n->_parent = NULL;
+		n->_left = NULL;
+		n->_right = NULL;
+	}
+
+	//n부터 루트까지 요약값을 다시 계산한다.
+	void
+	__update_path(node *n)
 	{
-		return _end_node;
+		if (!Augment::enabled)
+			return ;
+		for (; n != NULL; n = n->_parent)
+			this->_augment.update(n);
 	}
 
-	//일반 이진트리처럼 데이터를 넣고 rbt의 조건으로 검사 및 수정 한다.
-	node*
-	insert(const T& data_)
+	//x를 루트까지 올린다. 부모와 조부모가 같은 쪽이면 조부모부터(zig-zig), 아니면 부모부터(zig-zag) 돌린다.
+	void
+	__splay(node *x)
 	{
-		if (_root != NULL)
+		while (x->_parent != NULL)
 		{
-			_end_node->_left = NULL;
-			_end_node->_right = NULL;
-			_root->_parent = NULL;
+			node *p = x->_parent;
+			node *g = p->_parent;
+
+			if (g == NULL)
+			{
+				if (x == p->_left)
+					this->rotate_right(p);
+				else
+					this->rotate_left(p);
+			}
+			else if ((x == p->_left) == (p == g->_left))
+			{
+				if (x == p->_left)
+				{
+					this->rotate_right(g);
+					this->rotate_right(p);
+				}
+				else
+				{
+					this->rotate_left(g);
+					this->rotate_left(p);
+				}
+			}
+			else if (x == p->_left)
+			{
+				this->rotate_right(p);
+				this->rotate_left(g);
+			}
+			else
+			{
+				this->rotate_left(p);
+				this->rotate_right(g);
+			}
 		}
-		_root = insert_value(this->_root, data_, NULL);
-        insert_case1(this->_inserted_node);
-		_root->_parent = _end_node;
-		_end_node->_left = _root;
-		_end_node->_right = _root;
-		return _inserted_node;
 	}
 
-	// 이진탐색으로 삽입할 자리를 찾고 노드객체를 생성.
-	node*
-    insert_value(node *node_, const T& data_, node *parent_node_)
+	//n 자리에 child를 건다.
+	void
+	__replace(node *n, node *child)
 	{
-        if (node_ == NULL)
-		{
-			node *n					= _node_alloc.allocate(1);
-			_alloc.construct(&n->_data, data_);
-            n->_parent				= parent_node_;
-			n->_left				= NULL;
-			n->_right				= NULL;
-            this->_inserted_node	= n;
-			++this->_size;
-			return n;
-		};
-		if (_comp(data_,node_->_data))
-			node_->_left = this->insert_value(node_->_left, data_, node_);
-		else if (_comp(node_->_data, data_))
-			node_->_right = this->insert_value(node_->_right, data_, node_);
-        return node_;
-	};
+		node *p = n->_parent;
 
-	node*
-	find(const T& search_key) const
+		if (child != NULL)
+			child->_parent = p;
+		if (p == NULL)
+			_root = child;
+		else if (p->_left == n)
+			p->_left = child;
+		else
+			p->_right = child;
+	}
+
+	//자식이 둘인 n과 그 다음 노드 next의 자리와 색을 맞바꾼다. next는 왼쪽 자식이 없다.
+	void
+	__swap_nodes(node *n, node *next)
 	{
-        return this->find_value(this->_root, search_key);
-	};
+		node *p = n->_parent;
+		node *next_p = next->_parent;
+		node *next_r = next->_right;
+		bool color = n->_is_black;
 
-	node*
-	find_value(node *node_, const T& search_key) const
-	{
-        if (node_ == NULL)
-            return _end_node;
-        else if (_comp(node_->_data, search_key))
-            return this->find_value(node_->_right, search_key);
-        else if (_comp(search_key, node_->_data))
-            return this->find_value(node_->_left, search_key);
+		n->_is_black = next->_is_black;
+		next->_is_black = color;
+		next->_parent = p;
+		if (p == NULL)
+			_root = next;
+		else if (p->_left == n)
+			p->_left = next;
 		else
-			return node_;
-	};
+			p->_right = next;
+		next->_left = n->_left;
+		next->_left->_parent = next;
+		if (next_p == n)
+		{
+			next->_right = n;
+			n->_parent = next;
+		}
+		else
+		{
+			next->_right = n->_right;
+			next->_right->_parent = next;
+			next_p->_left = n;
+			n->_parent = next_p;
+		}
+		n->_left = NULL;
+		n->_right = next_r;
+		if (next_r != NULL)
+			next_r->_parent = n;
+	}
 
+public:
 	// 조부모 노드 찾기
     node*
 	find_grandparent_node(node *node_) const
@@ -261,6 +383,9 @@ public:
             else
                 p->_right = c;
 		};
+		//아래로 내려간 node_를 먼저, 올라온 c를 나중에 고친다.
+		this->_augment.update(node_);
+		this->_augment.update(c);
 	};
 
     void
@@ -288,6 +413,8 @@ public:
             else
                 p->_left = c;
 		};
+		this->_augment.update(node_);
+		this->_augment.update(c);
 	};
      
     void
@@ -303,244 +430,615 @@ public:
             this->rotate_left(grandparent);
 	};
 
-	bool
-	delete_node(const T& data_)
+	//형제찾기.
+	node*
+	find_sibling(node *node_) const
 	{
-		
-		node *target = find(data_);
-		if (target == _end_node)
-			return false;
-		
-		_end_node->_left = NULL;
-		_end_node->_right = NULL;
-		_root->_parent = NULL;
+		if (node_->_parent)
+		{
+			if (node_ == node_->_parent->_left)
+				return node_->_parent->_right;
+			if (node_ == node_->_parent->_right)
+				return node_->_parent->_left;
+		}
+		return NULL;
+	}
+
+	//검정 노드 node_를 떼어 내기 전에 부른다. node_쪽 경로의 검정이 하나 모자란다고 보고 맞춘다.
+	//case1. node_가 루트면 끝.
+	void
+	delete_case1(node *node_)
+	{
+		if (node_->_parent != NULL)
+			this->delete_case2(node_);
+	}
+
+	//case2. 형제가 빨강이면 부모를 축으로 돌려 검정 형제를 만든다.
+	void
+	delete_case2(node *node_)
+	{
+		node *sibling = this->find_sibling(node_);
 
-		if (target->_right != NULL)
+		if (!__is_black(sibling))
 		{
-			node *close = most_left(target->_right);
+			node_->_parent->_is_black = false;
+			sibling->_is_black = true;
+			if (node_ == node_->_parent->_left)
+				this->rotate_left(node_->_parent);
+			else
+				this->rotate_right(node_->_parent);
+		}
+		this->delete_case3(node_);
+	}
 
-			if (close->_right)
-			{
-				close->_right->_is_black = true;
-				close->_is_black = false;
-				rotate_left(close);
-			}
+	//case3. 부모, 형제, 조카가 모두 검정이면 형제를 빨강으로 바꾸고 부모에서 다시 맞춘다.
+	void
+	delete_case3(node *node_)
+	{
+		node *sibling = this->find_sibling(node_);
 
-			data_swap(target, close);
+		if (node_->_parent->_is_black && sibling->_is_black &&
+			__is_black(sibling->_left) && __is_black(sibling->_right))
+		{
+			sibling->_is_black = false;
+			this->delete_case1(node_->_parent);
 		}
-		else if (target->_left != NULL)
+		else
+			this->delete_case4(node_);
+	}
+
+	//case4. 부모만 빨강이면 부모와 형제의 색을 바꾸면 끝.
+	void
+	delete_case4(node *node_)
+	{
+		node *sibling = this->find_sibling(node_);
+
+		if (!node_->_parent->_is_black && sibling->_is_black &&
+			__is_black(sibling->_left) && __is_black(sibling->_right))
 		{
-			node *close = most_right(target->_left);
+			sibling->_is_black = false;
+			node_->_parent->_is_black = true;
+		}
+		else
+			this->delete_case5(node_);
+	}
 
-			if (close->_left)
-			{
-				close->_left->_is_black = true;
-				close->_is_black = false;
-				rotate_right(close);
-			}
+	//case5. 가까운 조카만 빨강이면 형제를 돌려 먼 조카가 빨강이 되게 한다.
+	void
+	delete_case5(node *node_)
+	{
+		node *sibling = this->find_sibling(node_);
 
-			data_swap(target, close);
+		if (node_ == node_->_parent->_left && __is_black(sibling->_right))
+		{
+			sibling->_is_black = false;
+			sibling->_left->_is_black = true;
+			this->rotate_right(sibling);
 		}
+		else if (node_ == node_->_parent->_right && __is_black(sibling->_left))
+		{
+			sibling->_is_black = false;
+			sibling->_right->_is_black = true;
+			this->rotate_left(sibling);
+		}
+		this->delete_case6(node_);
+	}
+
+	//case6. 먼 조카가 빨강. 부모를 축으로 돌리고 형제가 부모의 색을 물려받는다.
+	void
+	delete_case6(node *node_)
+	{
+		node *sibling = this->find_sibling(node_);
 
-		if (target->_parent == NULL)
-			_root = NULL;
+		sibling->_is_black = node_->_parent->_is_black;
+		node_->_parent->_is_black = true;
+		if (node_ == node_->_parent->_left)
+		{
+			sibling->_right->_is_black = true;
+			this->rotate_left(node_->_parent);
+		}
 		else
 		{
-			node *sibling = find_sibling(target);
-
-			if (target->_parent->_left == target)
-				target->_parent->_left = NULL;
-			else if (target->_parent->_right == target)
-				target->_parent->_right = NULL;
-			delete_case1(sibling);
+			sibling->_left->_is_black = true;
+			this->rotate_right(node_->_parent);
 		}
+	}
+};
 
-		if (_root != NULL)
-			_root->_parent = _end_node;
-		_end_node->_left = _root;
-		_end_node->_right = _root;
+//clear_async가 떼어 낸 트리를 넘기는 곳. pthread가 필요해서 reclaimer.hpp에 정의한다.
+//clear_async를 부르는데 reclaimer.hpp가 없으면 불완전한 타입이라는 컴파일 오류가 난다.
+template <class Tree>
+struct __async_clear;
 
-		_alloc.destroy(&target->_data);
-		_node_alloc.deallocate(target, 1);
-		if (_size)
-			--_size;
-		return true;
+//Node는 rbtNode와 같은 멤버를 가진 노드 타입. 부분트리 요약값을 둘 때는 Node에 칸을 더하고 Augment로 계산한다.
+template<typename T, typename Comp = std::less<T>, typename Alloc = std::allocator<T>,
+		typename Node = rbtNode<T>, typename Augment = __rbt_no_augment, typename Balance = rb_balance>
+class rbt : public rbt_base< Node, Augment, Balance >
+{
+public:
+	typedef Node		node;
+	using rbt_base<node, Augment, Balance>::_root;
+	Comp	_comp;
+	Alloc	_alloc;
+
+private:
+	//compact가 노드를 키 순서대로 옮겨 담는 연속된 블록. 안의 노드가 모두 지워지면 블록째 해제한다.
+	struct __slab
+	{
+		node	*base;
+		size_t	cap;
+		size_t	used;
+		size_t	live;
+		__slab	*next;
+	};
+
+	node	*_end_node;
+	size_t	_size;
+	size_t	_max_size;
+	typename Alloc::template rebind<node>::other _node_alloc;
+	__slab	*_slabs;
+	__slab	*_filling;
+	node	*_cursor;
+
+public:
+	rbt(const Comp& comp_ = Comp(), const Alloc& alloc_ = Alloc()) : _comp(comp_), _alloc(alloc_), _size(0),
+		_slabs(NULL), _filling(NULL), _cursor(NULL)
+	{
+		size_t div = sizeof( node ) / 2;
+		if (div == 0)
+			div = 1;
+		this->_max_size = std::numeric_limits<ptrdiff_t>::max() / div;
+
+		node *nul		=  _node_alloc.allocate(1);
+		_alloc.construct(&nul->_data, T());
+		nul->_is_nul = true;
+		nul->_is_black = true;
+		nul->_parent = NULL;
+		nul->_left = NULL;
+		nul->_right = NULL;
+		_end_node = nul;
 	}
 
-	void
-	data_swap(node *n1, node *n2)
-	{
-		node temp;
-		node temp2;
-		bool p_path;
-		bool p_path2;
-
-		if (_root == n1)
-			_root = n2;
-		
-		temp._is_black = n1->_is_black;
-		temp._left = n1->_left;
-		temp._parent = n1->_parent;
-		temp._right = n1->_right;
-		temp2._is_black = n2->_is_black;
-		temp2._left = n2->_left;
-		temp2._parent = n2->_parent;
-		temp2._right = n2->_right;
-
-		if (n1->_parent)
-		{
-			if (n1->_parent->_left == n1)
-				p_path = true;
+	~rbt() { 
+		clear();
+		_alloc.destroy(&_end_node->_data);
+		_node_alloc.deallocate(_end_node, 1);
+		};
+
+	node*
+	begin() const {
+		if (_size == 0)
+			return _end_node;
+		return this->most_left(this->_root);
+		};
+
+	node*
+	end() const
+	{
+		return _end_node;
+	}
+
+	node*
+	rbegin() const {
+		if (_size == 0)
+			return _end_node;		
+		return this->most_right(this->_root);
+		};
+
+	node*
+	rend() const
+	{
+		return _end_node;
+	}
+
+	//일반 이진트리처럼 자리를 찾아 노드를 걸고 rbt의 조건으로 검사 및 수정 한다. 이미 있으면 그 노드를 돌려준다.
+	node*
+	insert(const T& data_)
+	{
+		node *parent = NULL;
+		node *cur = _root;
+		bool left = false;
+
+		while (cur != NULL)
+		{
+			parent = cur;
+			if (_comp(data_, cur->_data))
+			{
+				left = true;
+				cur = cur->_left;
+			}
+			else if (_comp(cur->_data, data_))
+			{
+				left = false;
+				cur = cur->_right;
+			}
 			else
-				p_path = false;
+				return cur;
 		}
-		if (n2->_parent)
+
+		node *n = _node_alloc.allocate(1);
+		_alloc.construct(&n->_data, data_);
+		this->_augment.construct(n);
+		++this->_size;
+		this->__link(_end_node, n, parent, left);
+		return n;
+	}
+
+
+	//같은 값이 있어도 넣는다. 같은 값들의 맨 뒤에 걸리므로 넣은 순서가 유지된다. (multimap, multiset용)
+	node*
+	insert_equal(const T& data_)
+	{
+		node *parent = NULL;
+		node *cur = _root;
+		bool left = false;
+
+		while (cur != NULL)
 		{
-			if (n2->_parent->_left == n2)
-				p_path2 = true;
-			else
-				p_path2 = false;
+			parent = cur;
+			left = _comp(data_, cur->_data);
+			cur = left ? cur->_left : cur->_right;
 		}
 
-		n1->_is_black = temp2._is_black;
-		if (temp2._left == n1)
-			n1->_left = n2;
-		else
-			n1->_left = temp2._left;
-		if (temp2._parent == n1)
-			n1->_parent = n2;
-		else
-			n1->_parent = temp2._parent;
-		if (temp2._right == n1)
-			n1->_right = n2;
-		else
-			n1->_right = temp2._right;
+		node *n = _node_alloc.allocate(1);
+		_alloc.construct(&n->_data, data_);
+		this->_augment.construct(n);
+		++this->_size;
+		this->__link(_end_node, n, parent, left);
+		return n;
+	}
 
-		n2->_is_black = temp._is_black;
-		if (temp._left == n2)
-			n2->_left = n1;
-		else
-			n2->_left = temp._left;
-		if (temp._parent == n2)
-			n2->_parent = n1;
-		else
-			n2->_parent = temp._parent;
-		if (temp._right == n2)
-			n2->_right = n1;
-		else
-			n2->_right = temp._right;
-		
-		if (n1->_left)
-			n1->_left->_parent = n1;
-		if (n1->_right)
-			n1->_right->_parent = n1;
-		if (n1->_parent)
-		{
-			if (p_path2)
-				n1->_parent->_left = n1;
+	//k 이상인 첫 노드. 없으면 _end_node. less는 less(값, 키)와 less(키, 값)을 모두 받는다.
+	template <class K, class Less>
+	node*
+	lower_bound(const K &k, const Less &less) const
+	{
+		node *cur = _root;
+		node *res = _end_node;
+
+		while (cur != NULL)
+		{
+			if (!less(cur->_data, k))
+			{
+				res = cur;
+				cur = cur->_left;
+			}
 			else
-				n1->_parent->_right = n1;
+				cur = cur->_right;
 		}
+		return res;
+	}
 
-		if (n2->_left)
-			n2->_left->_parent = n2;
-		if (n2->_right)
-			n2->_right->_parent = n2;
-		if (n2->_parent)
+	//k보다 큰 첫 노드. 없으면 _end_node.
+	template <class K, class Less>
+	node*
+	upper_bound(const K &k, const Less &less) const
+	{
+		node *cur = _root;
+		node *res = _end_node;
+
+		while (cur != NULL)
 		{
-			if (p_path)
-				n2->_parent->_left = n2;
+			if (less(k, cur->_data))
+			{
+				res = cur;
+				cur = cur->_left;
+			}
 			else
-				n2->_parent->_right = n2;
+				cur = cur->_right;
 		}
+		return res;
 	}
 
-	//형제찾기.
+	//const로 찾을 때는 트리를 건드리지 않으므로 여러 스레드가 함께 읽어도 된다.
 	node*
-	find_sibling(node *node_)
+	find(const T& search_key) const
 	{
-		if (node_->_parent)
+		node *n = this->_root;
+
+		while (n != NULL)
 		{
-			if (node_ == node_->_parent->_left)
-				return node_->_parent->_right;
-			if (node_ == node_->_parent->_right)
-				return node_->_parent->_left;
+			if (_comp(n->_data, search_key))
+				n = n->_right;
+			else if (_comp(search_key, n->_data))
+				n = n->_left;
+			else
+				return n;
 		}
-		return NULL;
+		return _end_node;
+	};
+
+	//splay_balance면 찾은 노드를 루트로 올린다.
+	node*
+	find(const T& search_key)
+	{
+		node *n = static_cast<const rbt *>(this)->find(search_key);
+
+		if (n != _end_node)
+			this->__access(_end_node, n);
+		return n;
 	}
 
+	bool
+	delete_node(const T& data_)
+	{
+		node *target = find(data_);
+		if (target == _end_node)
+			return false;
+		this->erase_node(target);
+		return true;
+	}
+
+	//n의 값을 제자리에서 고친 뒤 부른다. n부터 루트까지 요약값을 다시 계산한다.
+	void
+	refresh(node *n)
+	{
+		if (!Augment::enabled)
+			return ;
+		for (; n != _end_node; n = n->_parent)
+			this->_augment.update(n);
+	}
+
+	//찾지 않고 노드를 바로 떼어 내 해제한다.
 	void
-	delete_case1(node *sibling)
+	erase_node(node *target)
+	{
+		if (target == _cursor)
+			_cursor = this->__next(target);
+		this->__unlink(_end_node, target);
+		this->__free_node(target);
+		if (_size)
+			--_size;
+	}
+
+	//pred가 참인 원소를 모두 지우고 지운 개수를 돌려준다. pred는 원소마다 키 순서대로 한 번씩 부른다.
+	//하나씩 떼어 내다가, 앞쪽 probe개 중 7/8 이상이 지워졌으면 나머지는 남은 원소를 순서대로 엮어
+	//기존 노드 그대로 균형 트리를 O(n)에 다시 만든다. probe가 0이면 처음부터 다시 만들고, -1이면 다시 만들지 않는다.
+	//남은 원소를 가리키는 반복자는 어느 쪽이든 유효하다.
+	template <class Pred>
+	size_t
+	erase_if(Pred pred, size_t probe)
 	{
-		if (sibling != NULL && sibling->_is_black == false)
+		size_t erased = 0;
+		size_t seen = 0;
+		node *n = this->begin();
+
+		while (n != _end_node)
 		{
-			sibling->_is_black = true;
-			sibling->_parent->_is_black = false;
-			if (sibling == sibling->_parent->_right)
-				rotate_left(sibling->_parent);
-			else
-				rotate_right(sibling->_parent);
+			if (seen == probe && erased * 8 >= probe * 7)
+				return erased + this->__erase_rebuild(pred, n);
+			node *next = this->__next(n);
+
+			if (pred(n->_data))
+			{
+				this->erase_node(n);
+				++erased;
+			}
+			++seen;
+			n = next;
 		}
-		else if (sibling != NULL && sibling->_is_black == true)
-			delete_case2(sibling);
+		return erased;
 	}
 
-	void
-	delete_case2(node *sibling)
+	//모든 노드가 compact가 만든 블록 안에 있는지. 다시 만들기는 이때만 하나씩 지우기보다 빠르다.
+	bool
+	compacted(void) const
+	{
+		size_t live = 0;
+
+		if (_filling != NULL || _size == 0)
+			return false;
+		for (__slab *s = _slabs; s != NULL; s = s->next)
+			live += s->live;
+		return live == _size;
+	}
+
+	//노드를 키 순서대로 새 연속 블록에 옮겨 담아 순회가 메모리를 차례로 읽게 한다.
+	//모양과 색은 그대로이고 옮긴 노드를 가리키던 반복자는 무효가 된다.
+	//max_nodes개까지만 옮기고 돌아오며, 다음 호출이 이어서 옮긴다. 다 옮겼으면 true.
+	bool
+	compact(size_t max_nodes = static_cast<size_t>(-1))
 	{
-		//형제와 그 자식 모두 검정일 때.
-		if (!(sibling->_left != NULL && !sibling->_left->_is_black) &&
-			!(sibling->_right != NULL && !sibling->_right->_is_black))
+		if (_filling == NULL)
 		{
-			sibling->_is_black = false;
-			sibling->_parent->_is_black = true;
+			if (_size == 0)
+				return true;
+			_filling = new __slab;
+			_filling->base = _node_alloc.allocate(_size);
+			_filling->cap = _size;
+			_filling->used = 0;
+			_filling->live = 0;
+			_filling->next = _slabs;
+			_slabs = _filling;
+			_cursor = this->begin();
 		}
-		else
-			delete_case3(sibling);
+		for (; max_nodes > 0 && _cursor != _end_node; --max_nodes)
+		{
+			if (_filling->used == _filling->cap)
+				break;
+			node *next = this->__next(_cursor);
+
+			this->__move_node(_cursor, _filling->base + _filling->used++);
+			_cursor = next;
+		}
+		if (_cursor != _end_node && _filling->used != _filling->cap)
+			return false;
+		//compact 중에 모두 지워졌으면 여기서 해제한다.
+		__slab *done = _filling;
+
+		_filling = NULL;
+		_cursor = NULL;
+		if (done->live == 0)
+			this->__free_slab(done);
+		return true;
 	}
 
-	//형제의 자식에 레드가 있을 때.
-	void
-	delete_case3(node *sibling)
+	//[first, last)에서 최대 max개의 키를 찾아 res에 노드(없으면 _end_node)를 넣고 처리한 키 개수를 돌려준다.
+	//less(값, 키)와 less(키, 값)을 모두 받는 비교자를 쓴다.
+	//키 8개의 탐색을 한 단계씩 번갈아 진행하고 다음 노드를 미리 읽어서, 캐시 미스를 여러 개 겹쳐 기다린다.
+	template <class Ite, class Less>
+	size_t
+	find_many(Ite &first, Ite last, const Less &less, node **res, size_t max) const
 	{
-		if (sibling == sibling->_parent->_right)
+		const size_t	group = 8;
+		node			*cur[group];
+		Ite				keys[group];
+		size_t			done = 0;
+
+		while (done < max && first != last)
 		{
-			//가까운 조카가 레드일 때.
-			if ((sibling->_left != NULL && sibling->_left->_is_black == false) &&
-				!(sibling->_right != NULL && sibling->_right->_is_black == false))
+			size_t n = 0;
+			while (n < group && done + n < max && first != last)
 			{
-				sibling->_left->_is_black = true;
-				sibling->_is_black = false;
-				rotate_right(sibling);
-				sibling = sibling->_parent;
+				keys[n] = first++;
+				cur[n] = _root;
+				res[done + n] = _end_node;
+				++n;
 			}
-			if (sibling->_right != NULL && sibling->_right->_is_black == false)
+			bool active = true;
+			while (active)
 			{
-				sibling->_is_black = sibling->_parent->_is_black;
-				sibling->_parent->_is_black = true;
-				sibling->_right->_is_black = true;
-				rotate_left(sibling->_parent);
+				active = false;
+				for (size_t i = 0; i < n; i++)
+				{
+					node *c = cur[i];
+					if (c == NULL)
+						continue;
+					if (less(c->_data, *keys[i]))
+						c = c->_right;
+					else if (less(*keys[i], c->_data))
+						c = c->_left;
+					else
+					{
+						res[done + i] = c;
+						c = NULL;
+					}
+					if (c != NULL)
+					{
+						__builtin_prefetch(c);
+						active = true;
+					}
+					cur[i] = c;
+				}
 			}
+			done += n;
 		}
-		else
+		return done;
+	}
+
+	//오름차순으로 정렬된 키용. 직전 탐색이 끝난 노드(finger)에서 키를 품는 가장 낮은 조상까지만
+	//올라갔다가 내려가므로 가까운 키끼리는 루트부터 다시 내려가지 않는다.
+	template <class Ite, class Less>
+	size_t
+	find_many_sorted(Ite &first, Ite last, const Less &less, node **res, size_t max, node *&finger) const
+	{
+		size_t done = 0;
+
+		if (finger == NULL)
+			finger = _root;
+		for (; done < max && first != last; ++first, ++done)
 		{
-			//깉은 상황, 형제 위치 반대.
-			if ((sibling->_right != NULL && sibling->_right->_is_black == false) &&
-				!(sibling->_left != NULL && sibling->_left->_is_black == false))
+			node *n = finger;
+			res[done] = _end_node;
+			if (n == NULL)
+				continue;
+			while (n->_parent != _end_node)
 			{
-				sibling->_right->_is_black = true;
-				sibling->_is_black = false;
-				rotate_left(sibling);
-				sibling = sibling->_parent;
+				node *p = n->_parent;
+				if (n == p->_left && less(*first, p->_data))
+					break;
+				n = p;
 			}
-			if (sibling->_left != NULL && sibling->_left->_is_black == false)
+			while (n != NULL)
 			{
-				sibling->_is_black = sibling->_parent->_is_black;
-				sibling->_parent->_is_black = true;
-				sibling->_left->_is_black = true;
-				rotate_right(sibling->_parent);
+				finger = n;
+				if (less(n->_data, *first))
+					n = n->_right;
+				else if (less(*first, n->_data))
+					n = n->_left;
+				else
+				{
+					res[done] = n;
+					break;
+				}
 			}
 		}
+		return done;
+	}
+
+	//정렬된 n개의 값으로 트리를 O(n)에 새로 만든다. 같은 값은 주어진 순서대로 놓인다.
+	template <class It>
+	void
+	build_sorted(It first, size_t n)
+	{
+		__value_source<It> src(this, first);
+
+		this->clear();
+		this->__build_tree(src, n);
+	}
+
+	//중위순회 순서대로 새 노드를 하나씩 만들어 주는 소스.
+	template <class It>
+	struct __value_source
+	{
+		rbt		*tree;
+		It		it;
+
+		__value_source(rbt *tree_, It it_) : tree(tree_), it(it_) {}
+
+		node*
+		next(void)
+		{
+			node *n = tree->_node_alloc.allocate(1);
+			tree->_alloc.construct(&n->_data, *it);
+			tree->_augment.construct(n);
+			n->_is_nul = false;
+			++it;
+			return n;
+		}
+	};
+
+	//src가 주는 노드 n개를 균형잡힌 트리로 잇는다. 트리는 비어있어야 한다.
+	template <class Source>
+	void
+	__build_tree(Source &src, size_t n)
+	{
+		size_t red_depth = 0;
+
+		for (size_t k = n; k > 1; k >>= 1)
+			++red_depth;
+		if (red_depth == 0)
+			red_depth = static_cast<size_t>(-1);
+		_root = this->__build_subtree(src, n, 0, red_depth);
+		_size = n;
+		if (_root != NULL)
+			_root->_parent = _end_node;
+		_end_node->_left = _root;
+		_end_node->_right = _root;
+	}
+
+	//가운데 원소를 루트로 삼아 재귀로 만든다. 양쪽 크기 차이가 1 이하라서 마지막 층을 빼면 꽉 찬 트리가 된다.
+	//마지막 층(red_depth)만 빨강으로 칠하면 모든 경로의 검정 노드 수가 같아진다.
+	template <class Source>
+	node*
+	__build_subtree(Source &src, size_t n, size_t depth, size_t red_depth)
+	{
+		if (n == 0)
+			return NULL;
+		node *left = this->__build_subtree(src, n / 2, depth + 1, red_depth);
+		node *n_ = src.next();
+		node *right = this->__build_subtree(src, n - n / 2 - 1, depth + 1, red_depth);
+
+		n_->_parent = NULL;
+		n_->_left = left;
+		n_->_right = right;
+		if (left != NULL)
+			left->_parent = n_;
+		if (right != NULL)
+			right->_parent = n_;
+		n_->_is_black = (depth != red_depth);
+		this->_augment.update(n_);
+		return n_;
 	}
 
 	void
@@ -550,23 +1048,93 @@ public:
 		_end_node->_right = NULL;
 		if (this->_size != 0)
 			tree_clear(this->_root);
-		_inserted_node = NULL;
 		_root = NULL;
 		this->_size = 0;
+		_filling = NULL;
+		_cursor = NULL;
+		while (_slabs != NULL)
+			this->__free_slab(_slabs);
 	}
 
 	//후위순회로 동적할당된 노드를 모두 해제.
 	void
 	tree_clear(node *node_) 
 	{
-		if (node_ == NULL)
-			return ;
-		this->tree_clear(node_->_left);
-		this->tree_clear(node_->_right);
-		_alloc.destroy(&node_->_data);
-		_node_alloc.deallocate(node_, 1);
+		this->__clear_from(node_, static_cast<size_t>(-1));
 	};
 
+	//지금 트리를 빈 트리와 바꿔 O(1)에 비우고, 떼어 낸 노드는 reclaimer 스레드가 묶음씩 해제한다.
+	//떼어 낸 노드를 가리키던 반복자는 바로 무효가 된다. 부르는 쪽은 reclaimer.hpp를 넣어야 한다.
+	void
+	clear_async()
+	{
+		if (this->_size == 0)
+		{
+			this->clear();
+			return ;
+		}
+		rbt *garbage = new rbt(_comp, _alloc);
+
+		this->swap(*garbage);
+		this->_augment = garbage->_augment;
+		ft::__async_clear<rbt>::submit(&rbt::__reclaim, garbage);
+	}
+
+private:
+	//reclaimer가 부른다. 한 번에 __reclaim_batch개까지 해제하고, 다 비웠으면 트리도 지운다.
+	static bool
+	__reclaim(void *arg)
+	{
+		static const size_t __reclaim_batch = 4096;
+		rbt *garbage = static_cast<rbt *>(arg);
+
+		garbage->_filling = NULL;
+		garbage->_cursor = NULL;
+		if (garbage->_root != NULL && garbage->__clear_from(garbage->_root, __reclaim_batch) != NULL)
+			return false;
+		garbage->_root = NULL;
+		garbage->_size = 0;
+		delete garbage;
+		return true;
+	}
+
+	//node_의 부분트리를 후위순회로 budget개까지 해제한다. 다 해제했으면 NULL, 아니면 아직 남은 node_를 돌려준다.
+	//splay_balance에서는 깊이가 n까지 갈 수 있으므로 재귀 없이 부모 링크로 올라온다.
+	node*
+	__clear_from(node *node_, size_t budget)
+	{
+		node *top = node_;
+		node *stop = (node_ == NULL) ? NULL : node_->_parent;
+
+		while (node_ != stop)
+		{
+			if (node_ != top && budget == 0)
+				return top;
+			if (node_->_left != NULL)
+				node_ = node_->_left;
+			else if (node_->_right != NULL)
+				node_ = node_->_right;
+			else
+			{
+				node *p = node_->_parent;
+
+				if (p != stop)
+				{
+					if (p->_left == node_)
+						p->_left = NULL;
+					else
+						p->_right = NULL;
+				}
+				this->__free_node(node_);
+				--budget;
+				node_ = p;
+			}
+		}
+		return NULL;
+	}
+
+public:
+
 	size_t
 	size() const { return this->_size; }
 
@@ -574,18 +1142,172 @@ public:
 	max_size() const { return this->_max_size; }
 
 	void
-	swap(rbt<T, Comp, Alloc>& tree2)
+	swap(rbt& tree2)
 	{
-		std::swap(this->_inserted_node, tree2._inserted_node);
 		std::swap(this->_root, tree2._root);
+		std::swap(this->_augment, tree2._augment);
 		std::swap(this->_size, tree2._size);
 		std::swap(this->_alloc, tree2._alloc);
 		std::swap(this->_comp, tree2._comp);
 		std::swap(this->_end_node, tree2._end_node);
+		std::swap(this->_slabs, tree2._slabs);
+		std::swap(this->_filling, tree2._filling);
+		std::swap(this->_cursor, tree2._cursor);
 	}
 
 	Comp value_comp() const { return _comp; }
 
+private:
+	node*
+	__next(node *n) const
+	{
+		if (n->_right != NULL)
+			return this->most_left(n->_right);
+		while (!n->_parent->_is_nul && n == n->_parent->_right)
+			n = n->_parent;
+		return n->_parent;
+	}
+
+	//erase_if의 나머지. from부터 pred를 부르고, 그 앞은 이미 pred를 거쳐 남은 원소다.
+	//남는 노드와 지울 노드를 각각 _left로 엮는다. 지나온 노드의 _left는 __next가 다시 읽지 않는다.
+	template <class Pred>
+	size_t
+	__erase_rebuild(Pred &pred, node *from)
+	{
+		node *keep_head = NULL;
+		node **keep_tail = &keep_head;
+		node *drop = NULL;
+		size_t kept = 0;
+		size_t erased = 0;
+		bool seen = false;
+		bool find_cursor = false;
+
+		for (node *n = this->begin(); n != _end_node; )
+		{
+			node *next = this->__next(n);
+
+			if (n == from)
+				seen = true;
+			if (n == _cursor)
+				find_cursor = true;
+			if (seen && pred(n->_data))
+			{
+				n->_left = drop;
+				drop = n;
+				++erased;
+			}
+			else
+			{
+				if (find_cursor)
+				{
+					_cursor = n;
+					find_cursor = false;
+				}
+				*keep_tail = n;
+				keep_tail = &n->_left;
+				++kept;
+			}
+			n = next;
+		}
+		*keep_tail = NULL;
+		if (find_cursor)
+			_cursor = _end_node;
+		while (drop != NULL)
+		{
+			node *n = drop;
+
+			drop = drop->_left;
+			this->__free_node(n);
+		}
+
+		__list_source src(keep_head);
+
+		_root = NULL;
+		this->__build_tree(src, kept);
+		return erased;
+	}
+
+	//_left로 엮은 노드를 차례로 내준다.
+	struct __list_source
+	{
+		node	*head;
+
+		__list_source(node *head_) : head(head_) {}
+
+		node*
+		next(void)
+		{
+			node *n = head;
+
+			head = head->_left;
+			return n;
+		}
+	};
+
+	//from의 값과 링크를 to로 옮기고 from을 해제한다. from을 가리키던 조상의 요약값도 다시 계산한다.
+	void
+	__move_node(node *from, node *to)
+	{
+		_alloc.construct(&to->_data, from->_data);
+		this->_augment.construct(to);
+		++_filling->live;
+		to->_is_black = from->_is_black;
+		to->_is_nul = false;
+		to->_parent = from->_parent;
+		to->_left = from->_left;
+		to->_right = from->_right;
+		if (to->_left != NULL)
+			to->_left->_parent = to;
+		if (to->_right != NULL)
+			to->_right->_parent = to;
+		if (to->_parent == _end_node)
+		{
+			_root = to;
+			_end_node->_left = to;
+			_end_node->_right = to;
+		}
+		else if (to->_parent->_left == from)
+			to->_parent->_left = to;
+		else
+			to->_parent->_right = to;
+		this->refresh(to);
+		this->__free_node(from);
+	}
+
+	//블록 안의 노드는 블록의 live만 줄이고, 블록이 비면 통째로 해제한다.
+	void
+	__free_node(node *n)
+	{
+		std::less<node *> less;
+
+		this->_augment.destroy(n);
+		_alloc.destroy(&n->_data);
+		for (__slab *s = _slabs; s != NULL; s = s->next)
+		{
+			if (!less(n, s->base) && less(n, s->base + s->cap))
+			{
+				if (--s->live == 0 && s != _filling)
+					this->__free_slab(s);
+				return ;
+			}
+		}
+		_node_alloc.deallocate(n, 1);
+	}
+
+	void
+	__free_slab(__slab *s)
+	{
+		__slab **link = &_slabs;
+
+		while (*link != s)
+			link = &(*link)->next;
+		*link = s->next;
+		_node_alloc.deallocate(s->base, s->cap);
+		delete s;
+	}
+
+public:
+
 	Alloc __alloc() const {return _alloc; }
 
 	//중위순회로 노드 모두 출력.
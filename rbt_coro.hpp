@@ -0,0 +1,208 @@
+#ifndef RBT_CORO_HPP
+# define RBT_CORO_HPP
+
+//C++20 빌드에서만 켜진다. C++98 빌드에서는 이 헤더가 아무것도 정의하지 않는다.
+# if __cplusplus >= 202002L && defined(__cpp_impl_coroutine)
+
+#  include <coroutine>
+#  include <cstddef>
+#  include <deque>
+#  include <exception>
+#  include <functional>
+#  include <utility>
+#  include <vector>
+
+namespace ft
+{
+namespace coro
+{
+//rbt 한 번 내려가기를 표현하는 코루틴. 자식 노드로 넘어갈 때마다 그 노드를 미리 읽고 멈춘다.
+//처음에는 멈춘 채로 만들어지고, 스케줄러가 resume할 때마다 한 레벨씩 내려간다.
+template <class Node>
+class lookup_task
+{
+public:
+	struct promise_type
+	{
+		Node	*result = nullptr;
+
+		lookup_task
+		get_return_object(void)
+		{ return lookup_task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+		std::suspend_always	initial_suspend(void) noexcept { return {}; }
+		std::suspend_always	final_suspend(void) noexcept { return {}; }
+		void				return_value(Node *n) noexcept { result = n; }
+		void				unhandled_exception(void) { std::terminate(); }
+	};
+
+	typedef std::coroutine_handle<promise_type>	handle_type;
+
+	lookup_task(void) : _h(nullptr) {}
+	explicit lookup_task(handle_type h_) : _h(h_) {}
+	lookup_task(lookup_task &&src) noexcept : _h(std::exchange(src._h, nullptr)) {}
+	lookup_task(const lookup_task &) = delete;
+
+	lookup_task &
+	operator=(lookup_task &&rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			if (_h)
+				_h.destroy();
+			_h = std::exchange(rhs._h, nullptr);
+		}
+		return *this;
+	}
+
+	~lookup_task()
+	{
+		if (_h)
+			_h.destroy();
+	}
+
+	bool
+	done(void) const
+	{ return !_h || _h.done(); }
+
+	void
+	resume(void)
+	{ _h.resume(); }
+
+	Node*
+	result(void) const
+	{ return _h.promise().result; }
+
+private:
+	handle_type	_h;
+};
+
+//다음 노드를 미리 읽으라고 하고 멈춘다. 다시 resume될 때쯤이면 노드가 캐시에 와 있다.
+struct prefetch_awaiter
+{
+	const void	*addr;
+
+	bool	await_ready(void) const noexcept { return false; }
+	void	await_suspend(std::coroutine_handle<>) const noexcept { __builtin_prefetch(addr); }
+	void	await_resume(void) const noexcept {}
+};
+
+//root부터 key를 찾아 내려간다. 없으면 not_found를 돌려준다.
+//less(값, 키)와 less(키, 값)을 모두 받는 비교자를 쓴다. (ft::map::find_many와 같은 규칙)
+template <class Node, class Key, class Less>
+lookup_task<Node>
+descend(Node *root, Node *not_found, Key key, Less less)
+{
+	Node *n = root;
+
+	while (n != nullptr)
+	{
+		if (less(n->_data, key))
+			n = n->_right;
+		else if (less(key, n->_data))
+			n = n->_left;
+		else
+			co_return n;
+		if (n != nullptr)
+			co_await prefetch_awaiter{n};
+	}
+	co_return not_found;
+}
+
+//ft::rbt에서 찾는다. 키와 비교자는 코루틴 안에 복사되므로 호출한 쪽이 들고 있을 필요가 없다.
+template <class Tree, class Key, class Less>
+lookup_task<typename Tree::node>
+find(const Tree &tree, Key key, Less less)
+{
+	return descend(tree._root, tree.end(), std::move(key), std::move(less));
+}
+
+//트리 자신의 비교자로 찾는다. (값 전체를 키로 쓰는 ft::set 트리용)
+template <class Tree, class Value>
+lookup_task<typename Tree::node>
+find(const Tree &tree, Value val)
+{
+	return descend(tree._root, tree.end(), std::move(val), tree.value_comp());
+}
+
+//진행 중인 탐색을 최대 width개 들고 돌아가며 한 레벨씩 진행시킨다.
+//넘치는 탐색은 기다렸다가 자리가 나면 들어간다. 끝난 탐색은 결과 노드로 done을 부른다.
+//이벤트 루프에서는 한 번 돌 때마다 poll()을 부르고, 한꺼번에 끝내려면 run()을 부른다.
+template <class Node>
+class lookup_scheduler
+{
+public:
+	typedef std::function<void (Node *)>	callback_type;
+
+	explicit lookup_scheduler(std::size_t width_ = 16) : _width(width_ == 0 ? 1 : width_) {}
+
+	void
+	submit(lookup_task<Node> task, callback_type done)
+	{
+		if (_active.size() < _width)
+			_active.push_back(slot{std::move(task), std::move(done)});
+		else
+			_waiting.push_back(slot{std::move(task), std::move(done)});
+	}
+
+	//진행 중인 탐색을 모두 한 단계씩 진행한다. 남은 일이 있으면 true.
+	bool
+	poll(void)
+	{
+		for (std::size_t i = 0; i < _active.size(); )
+		{
+			slot &s = _active[i];
+			if (!s.task.done())
+				s.task.resume();
+			if (!s.task.done())
+			{
+				++i;
+				continue;
+			}
+			callback_type done = std::move(s.done);
+			Node *result = s.task.result();
+			if (!_waiting.empty())
+			{
+				s = std::move(_waiting.front());
+				_waiting.pop_front();
+				++i;
+			}
+			else
+			{
+				s = std::move(_active.back());
+				_active.pop_back();
+			}
+			done(result);
+		}
+		return !_active.empty();
+	}
+
+	void
+	run(void)
+	{
+		while (this->poll())
+			;
+	}
+
+	std::size_t
+	pending(void) const
+	{ return _active.size() + _waiting.size(); }
+
+private:
+	struct slot
+	{
+		lookup_task<Node>	task;
+		callback_type		done;
+	};
+
+	std::size_t			_width;
+	std::vector<slot>	_active;
+	std::deque<slot>	_waiting;
+};
+
+}
+}
+
+# endif
+
+#endif
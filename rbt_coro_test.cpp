@@ -0,0 +1,98 @@
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <set>
+#include <vector>
+#include "rbt_coro.hpp"
+#include "rbt.hpp"
+#include "tester.hpp"
+
+//C++20의 std::allocator에는 rebind, construct가 없어서 rbt가 쓰는 C++98 모양을 따로 만든다.
+template <class T>
+struct legacy_allocator
+{
+	typedef T			value_type;
+	typedef T*			pointer;
+	typedef const T*	const_pointer;
+	typedef T&			reference;
+	typedef const T&	const_reference;
+	typedef std::size_t	size_type;
+
+	template <class U>
+	struct rebind { typedef legacy_allocator<U> other; };
+
+	legacy_allocator(void) {}
+	template <class U>
+	legacy_allocator(const legacy_allocator<U> &) {}
+
+	T *allocate(std::size_t n) { return static_cast<T *>(::operator new(n * sizeof(T))); }
+	void deallocate(T *p, std::size_t) { ::operator delete(p); }
+	void construct(T *p, const T &v) { new (p) T(v); }
+	void destroy(T *p) { p->~T(); }
+	std::size_t max_size(void) const { return static_cast<std::size_t>(-1) / sizeof(T); }
+};
+
+typedef ft::rbt<int, std::less<int>, legacy_allocator<int> >	tree_t;
+
+int main(void)
+{
+	std::srand(17);
+	tree_t tree;
+	std::set<int> ref;
+
+	for (int i = 0; i < 20000; i++)
+	{
+		int k = std::rand() % 100000;
+		tree.insert(k);
+		ref.insert(k);
+	}
+
+	//코루틴 하나를 끝까지 돌리면 find와 같은 노드가 나온다.
+	bool same = true;
+	for (int k = -1; k < 2000; k++)
+	{
+		ft::coro::lookup_task<tree_t::node> t = ft::coro::find(tree, k);
+		while (!t.done())
+			t.resume();
+		same = same && t.result() == tree.find(k);
+	}
+	FT_CHECK(same);
+
+	//폭보다 많이 넣으면 기다렸다가 들어간다. 결과는 어떤 순서로 와도 키마다 한 번씩이다.
+	std::size_t widths[] = {1, 4, 16, 64};
+	for (std::size_t w = 0; w < sizeof(widths) / sizeof(widths[0]); w++)
+	{
+		ft::coro::lookup_scheduler<tree_t::node> sched(widths[w]);
+		std::vector<int> keys;
+		std::vector<int> hits(1000, -1);
+		for (int i = 0; i < 1000; i++)
+			keys.push_back(std::rand() % 100001 - 1);
+		for (int i = 0; i < 1000; i++)
+		{
+			tree_t::node *end = tree.end();
+			sched.submit(ft::coro::find(tree, keys[i]),
+				[&hits, i, end](tree_t::node *n) { hits[i] = n != end; });
+		}
+		FT_CHECK(sched.pending() == 1000);
+		std::size_t polls = 0;
+		while (sched.poll())
+			++polls;
+		FT_CHECK(sched.pending() == 0 && polls > 0);
+		bool ok = true;
+		for (int i = 0; i < 1000; i++)
+			ok = ok && hits[i] == static_cast<int>(ref.count(keys[i]));
+		FT_CHECK(ok);
+	}
+
+	//빈 트리와, 끝난 뒤에 다시 넣는 경우.
+	tree_t empty;
+	ft::coro::lookup_scheduler<tree_t::node> sched;
+	int missing = 0;
+	sched.submit(ft::coro::find(empty, 3), [&missing, &empty](tree_t::node *n) { missing += n == empty.end(); });
+	sched.run();
+	sched.submit(ft::coro::find(empty, 4), [&missing, &empty](tree_t::node *n) { missing += n == empty.end(); });
+	sched.run();
+	FT_CHECK(missing == 2);
+	return ft_test::result("rbt_coro");
+}
@@ -0,0 +1,236 @@
+#ifndef RCU_MAP_CLASS_HPP
+# define RCU_MAP_CLASS_HPP
+
+# include <pthread.h>
+# include "map.hpp"
+# include "epoch.hpp"
+
+namespace ft
+{
+//읽기는 아주 많고 쓰기는 드문 ft::map을 위한 래퍼.
+//읽는 쪽은 epoch에 들어가 현재 판의 포인터를 하나 읽을 뿐이라 잠금도 CAS도 없다.
+//쓰는 쪽은 한 번에 하나씩, 현재 판을 통째로 복사해 고친 뒤 포인터를 바꿔 걸고 옛 판은 epoch로 넘긴다.
+//쓰기 한 번이 O(n)이므로 여러 변경은 update 한 번에 묶는다.
+//걸린 판은 const로만 읽고, ft::map의 const 조회는 필터를 포함해 아무것도 고치지 않으므로 함께 읽어도 된다.
+template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< ft::pair<const Key,T> > >
+class rcu_map
+{
+public:
+	typedef ft::map<Key, T, Compare, Alloc>			map_type;
+	typedef typename map_type::key_type				key_type;
+	typedef typename map_type::mapped_type			mapped_type;
+	typedef typename map_type::value_type			value_type;
+	typedef typename map_type::key_compare			key_compare;
+	typedef typename map_type::size_type			size_type;
+
+	//한 판을 붙잡고 읽는다. 살아 있는 동안 그 판은 지워지지 않고, 이후의 쓰기도 보이지 않는다.
+	//epoch는 스레드마다 따로이므로 만든 스레드 안에서만 쓴다.
+	class snapshot
+	{
+	public:
+		explicit snapshot(const rcu_map &src) { ft::epoch::enter(); _map = src.__load(); }
+		snapshot(const snapshot &src) : _map(src._map) { ft::epoch::enter(); }
+		~snapshot() { ft::epoch::leave(); }
+
+		const map_type	&operator*(void) const { return *_map; }
+		const map_type	*operator->(void) const { return _map; }
+
+	private:
+		const map_type	*_map;
+
+		snapshot	&operator=(const snapshot &);
+	};
+
+	rcu_map(void);
+	explicit rcu_map(const map_type &src);
+	virtual ~rcu_map(void);
+
+	snapshot	read(void) const;
+
+	bool		find(const key_type &k, mapped_type &out) const;
+	size_type	count(const key_type &k) const;
+	size_type	size(void) const;
+	bool		empty(void) const;
+
+	template <class Fn> void	update(Fn fn);
+	bool		insert(const value_type &val);
+	size_type	erase(const key_type &k);
+	void		store(const map_type &src);
+	void		clear(void);
+
+private:
+	map_type *volatile		_cur;
+	pthread_mutex_t			_write_lock;
+
+	rcu_map(const rcu_map &);
+	rcu_map	&operator=(const rcu_map &);
+
+	const map_type	*__load(void) const;
+	void			__publish(map_type *next);
+	static void		__delete_map(void *p);
+
+	struct __insert_fn
+	{
+		const value_type	*val;
+		bool				*inserted;
+
+		void	operator()(map_type &m) const { *inserted = m.insert(*val).second; }
+	};
+
+	struct __erase_fn
+	{
+		const key_type	*key;
+		size_type		*erased;
+
+		void	operator()(map_type &m) const { *erased = m.erase(*key); }
+	};
+
+};
+
+template <class Key, class T, class Compare, class Alloc>
+rcu_map<Key, T, Compare, Alloc>::rcu_map(void) : _cur(new map_type())
+{
+	pthread_mutex_init(&this->_write_lock, NULL);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+rcu_map<Key, T, Compare, Alloc>::rcu_map(const map_type &src) : _cur(new map_type(src))
+{
+	pthread_mutex_init(&this->_write_lock, NULL);
+}
+
+//읽는 스레드가 없을 때만 부른다. 이미 넘긴 옛 판은 epoch가 지운다.
+template <class Key, class T, class Compare, class Alloc>
+rcu_map<Key, T, Compare, Alloc>::~rcu_map(void)
+{
+	delete this->_cur;
+	pthread_mutex_destroy(&this->_write_lock);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+const typename rcu_map<Key, T, Compare, Alloc>::map_type*
+rcu_map<Key, T, Compare, Alloc>::__load(void) const {
+	return __atomic_load_n(&this->_cur, __ATOMIC_ACQUIRE);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename rcu_map<Key, T, Compare, Alloc>::snapshot
+rcu_map<Key, T, Compare, Alloc>::read(void) const {
+	return snapshot(*this);
+}
+
+//있으면 값을 out에 복사하고 true.
+template <class Key, class T, class Compare, class Alloc>
+bool	rcu_map<Key, T, Compare, Alloc>::find(const key_type &k, mapped_type &out) const
+{
+	ft::epoch_guard guard;
+	const map_type *m = this->__load();
+	typename map_type::const_iterator it = m->find(k);
+
+	if (it == m->end())
+		return false;
+	out = it->second;
+	return true;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename rcu_map<Key, T, Compare, Alloc>::size_type
+rcu_map<Key, T, Compare, Alloc>::count(const key_type &k) const {
+	ft::epoch_guard guard;
+	return this->__load()->count(k);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename rcu_map<Key, T, Compare, Alloc>::size_type
+rcu_map<Key, T, Compare, Alloc>::size(void) const {
+	ft::epoch_guard guard;
+	return this->__load()->size();
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	rcu_map<Key, T, Compare, Alloc>::empty(void) const {
+	return (this->size() == 0);
+}
+
+//현재 판을 복사해 fn(map_type &)으로 고치고 바꿔 건다. fn이 예외를 던지면 아무것도 바뀌지 않는다.
+template <class Key, class T, class Compare, class Alloc> template <class Fn>
+void	rcu_map<Key, T, Compare, Alloc>::update(Fn fn)
+{
+	map_type *next = NULL;
+
+	pthread_mutex_lock(&this->_write_lock);
+	try
+	{
+		next = new map_type(*this->_cur);
+		fn(*next);
+	}
+	catch (...)
+	{
+		delete next;
+		pthread_mutex_unlock(&this->_write_lock);
+		throw;
+	}
+	this->__publish(next);
+	pthread_mutex_unlock(&this->_write_lock);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	rcu_map<Key, T, Compare, Alloc>::insert(const value_type &val)
+{
+	bool inserted = false;
+	__insert_fn fn;
+
+	fn.val = &val;
+	fn.inserted = &inserted;
+	this->update(fn);
+	return inserted;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename rcu_map<Key, T, Compare, Alloc>::size_type
+rcu_map<Key, T, Compare, Alloc>::erase(const key_type &k)
+{
+	size_type erased = 0;
+	__erase_fn fn;
+
+	fn.key = &k;
+	fn.erased = &erased;
+	this->update(fn);
+	return erased;
+}
+
+//src로 통째로 바꾼다. 현재 판은 복사하지 않는다.
+template <class Key, class T, class Compare, class Alloc>
+void	rcu_map<Key, T, Compare, Alloc>::store(const map_type &src)
+{
+	map_type *next = new map_type(src);
+
+	pthread_mutex_lock(&this->_write_lock);
+	this->__publish(next);
+	pthread_mutex_unlock(&this->_write_lock);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	rcu_map<Key, T, Compare, Alloc>::clear(void)
+{
+	pthread_mutex_lock(&this->_write_lock);
+	this->__publish(new map_type(this->_cur->key_comp()));
+	pthread_mutex_unlock(&this->_write_lock);
+}
+
+//쓰기 잠금을 잡은 채로 부른다.
+template <class Key, class T, class Compare, class Alloc>
+void	rcu_map<Key, T, Compare, Alloc>::__publish(map_type *next)
+{
+	map_type *old = __atomic_exchange_n(&this->_cur, next, __ATOMIC_ACQ_REL);
+	ft::epoch::retire(old, &__delete_map);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	rcu_map<Key, T, Compare, Alloc>::__delete_map(void *p) {
+	delete static_cast<map_type *>(p);
+}
+
+}
+
+#endif
@@ -0,0 +1,133 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include "rcu_map.hpp"
+#include "tester.hpp"
+
+typedef ft::rcu_map<int, int>	rcu_t;
+
+//판마다 모든 값이 같은 세대 번호를 가진다. 읽는 쪽이 섞인 판을 보면 안 된다.
+static rcu_t		g_map;
+static const int	g_keys = 2000;
+static volatile int	g_stop = 0;
+static int			g_bad = 0;
+
+struct Bump
+{
+	void
+	operator()(ft::map<int, int> &m) const
+	{
+		for (ft::map<int, int>::iterator it = m.begin(); it != m.end(); ++it)
+			++it->second;
+	}
+};
+
+struct AddKeys
+{
+	int	from;
+	int	to;
+
+	void
+	operator()(ft::map<int, int> &m) const
+	{
+		for (int k = from; k < to; k++)
+			m[k] = k;
+	}
+};
+
+struct Throw
+{
+	void	operator()(ft::map<int, int> &m) const { m[-1] = -1; throw 42; }
+};
+
+static void *
+reader(void *arg)
+{
+	long id = reinterpret_cast<long>(arg);
+	int bad = 0;
+	int last = 0;
+
+	while (!__sync_fetch_and_add(&g_stop, 0))
+	{
+		rcu_t::snapshot snap = g_map.read();
+		int gen = snap->begin()->second;
+		if (gen < last || snap->size() != static_cast<size_t>(g_keys))
+			++bad;
+		last = gen;
+		for (ft::map<int, int>::const_iterator it = snap->begin(); it != snap->end(); ++it)
+			if (it->second != gen)
+				++bad;
+		int v = -1;
+		int k = static_cast<int>((id * 131 + gen) % (g_keys * 2));
+		if (g_map.find(k, v) != (k < g_keys) || g_map.count(k) != (k < g_keys))
+			++bad;
+	}
+	__sync_fetch_and_add(&g_bad, bad);
+	return NULL;
+}
+
+int main(void)
+{
+	srand(31);
+	{
+		rcu_t m;
+		FT_CHECK(m.empty());
+		FT_CHECK(m.insert(ft::make_pair(1, 10)) && !m.insert(ft::make_pair(1, 11)));
+		int v = 0;
+		FT_CHECK(m.find(1, v) && v == 10 && m.count(2) == 0);
+
+		//스냅샷은 잡은 뒤의 쓰기를 보지 않는다.
+		rcu_t::snapshot before = m.read();
+		AddKeys add = {2, 100};
+		m.update(add);
+		FT_CHECK(before->size() == 1 && m.size() == 99);
+		FT_CHECK(m.erase(50) == 1 && m.erase(50) == 0 && m.size() == 98);
+
+		//update가 던지면 아무것도 바뀌지 않는다.
+		bool thrown = false;
+		try { m.update(Throw()); } catch (int) { thrown = true; }
+		FT_CHECK(thrown && m.count(-1) == 0 && m.size() == 98);
+
+		ft::map<int, int> src;
+		src[7] = 7;
+		m.store(src);
+		FT_CHECK(m.size() == 1 && m.find(7, v) && v == 7);
+		m.clear();
+		FT_CHECK(m.empty());
+	}
+
+	//필터를 켠 판. 지운 키가 쌓여도 읽는 쪽은 판을 고치지 않는다.
+	{
+		ft::map<int, int> src;
+		src.enable_filter();
+		for (int i = 0; i < 5000; i++)
+			src[i] = i;
+		for (int i = 0; i < 5000; i += 2)
+			src.erase(i);
+		rcu_t fm(src);
+		bool ok = true;
+		for (int i = 0; i < 5000; i++)
+			ok = ok && fm.count(i) == static_cast<size_t>(i % 2);
+		FT_CHECK(ok);
+		FT_CHECK(fm.read()->filter_enabled());
+	}
+
+	//여러 읽는 스레드와 한 쓰는 스레드.
+	ft::map<int, int> init;
+	init.enable_filter();
+	for (int k = 0; k < g_keys; k++)
+		init[k] = 0;
+	g_map.store(init);
+	pthread_t th[4];
+	for (long t = 0; t < 4; t++)
+		pthread_create(&th[t], NULL, reader, reinterpret_cast<void *>(t));
+	for (int i = 0; i < 300; i++)
+		g_map.update(Bump());
+	__sync_lock_test_and_set(&g_stop, 1);
+	for (int t = 0; t < 4; t++)
+		pthread_join(th[t], NULL);
+	FT_CHECK(g_bad == 0);
+	FT_CHECK(g_map.read()->begin()->second == 300);
+	g_map.clear();
+	ft::epoch::synchronize();
+	return ft_test::result("rcu_map");
+}
@@ -0,0 +1,147 @@
+#ifndef RECLAIMER_CLASS_HPP
+# define RECLAIMER_CLASS_HPP
+
+# include <cstddef>
+# include <pthread.h>
+
+namespace ft
+{
+//뒤에서 해제할 일 하나. fn(arg)는 조금씩 해제하다가 다 끝났으면 true를 돌려준다.
+struct __reclaim_job
+{
+	bool			(*fn)(void *);
+	void			*arg;
+	__reclaim_job	*next;
+};
+
+//큰 자료구조를 부른 스레드 대신 해제하는 스레드 하나.
+//일은 넣은 순서대로 한 묶음씩 처리하고, 덜 끝난 일은 큐 뒤로 보내 여러 일이 번갈아 줄어들게 한다.
+class reclaimer
+{
+private:
+	pthread_t		_thread;
+	pthread_mutex_t	_lock;
+	pthread_cond_t	_wake;
+	pthread_cond_t	_idle;
+	__reclaim_job	*_head;
+	__reclaim_job	*_tail;
+	bool			_busy;
+
+	reclaimer(void)
+	: _head(NULL), _tail(NULL), _busy(false)
+	{
+		pthread_mutex_init(&_lock, NULL);
+		pthread_cond_init(&_wake, NULL);
+		pthread_cond_init(&_idle, NULL);
+		pthread_create(&_thread, NULL, &reclaimer::worker_main, NULL);
+		pthread_detach(_thread);
+	}
+
+	reclaimer(const reclaimer &);
+	reclaimer &operator=(const reclaimer &);
+
+	static reclaimer *&
+	__instance_ptr(void)
+	{
+		static reclaimer *r = NULL;
+		return r;
+	}
+
+	static void
+	__create(void)
+	{ __instance_ptr() = new reclaimer(); }
+
+	static void *
+	worker_main(void *)
+	{
+		reclaimer::instance().__loop();
+		return NULL;
+	}
+
+	//잠금 밖에서 한 묶음만 처리한다.
+	void
+	__loop(void)
+	{
+		for (;;)
+		{
+			pthread_mutex_lock(&_lock);
+			while (_head == NULL)
+				pthread_cond_wait(&_wake, &_lock);
+			__reclaim_job *job = _head;
+
+			_head = job->next;
+			if (_head == NULL)
+				_tail = NULL;
+			_busy = true;
+			pthread_mutex_unlock(&_lock);
+
+			bool done = job->fn(job->arg);
+
+			pthread_mutex_lock(&_lock);
+			_busy = false;
+			if (done)
+				delete job;
+			else
+				this->__push(job);
+			if (_head == NULL)
+				pthread_cond_broadcast(&_idle);
+			pthread_mutex_unlock(&_lock);
+		}
+	}
+
+	void
+	__push(__reclaim_job *job)
+	{
+		job->next = NULL;
+		if (_tail == NULL)
+			_head = job;
+		else
+			_tail->next = job;
+		_tail = job;
+	}
+
+public:
+	static reclaimer &
+	instance(void)
+	{
+		static pthread_once_t once = PTHREAD_ONCE_INIT;
+		pthread_once(&once, &reclaimer::__create);
+		return *__instance_ptr();
+	}
+
+	void
+	submit(bool (*fn)(void *), void *arg)
+	{
+		__reclaim_job *job = new __reclaim_job;
+
+		job->fn = fn;
+		job->arg = arg;
+		pthread_mutex_lock(&_lock);
+		this->__push(job);
+		pthread_cond_signal(&_wake);
+		pthread_mutex_unlock(&_lock);
+	}
+
+	//넣어 둔 일이 모두 끝날 때까지 기다린다.
+	void
+	drain(void)
+	{
+		pthread_mutex_lock(&_lock);
+		while (_head != NULL || _busy)
+			pthread_cond_wait(&_idle, &_lock);
+		pthread_mutex_unlock(&_lock);
+	}
+};
+
+//rbt::clear_async가 떼어 낸 트리를 넘기는 곳. rbt.hpp는 선언만 하므로 트리는 pthread를 몰라도 된다.
+template <class Tree>
+struct __async_clear
+{
+	static void
+	submit(bool (*fn)(void *), void *arg)
+	{ reclaimer::instance().submit(fn, arg); }
+};
+
+}
+
+#endif
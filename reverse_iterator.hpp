@@ -5,6 +5,14 @@
 
 namespace ft 
 {
+//반복자의 operator->를 그대로 쓴다. 프록시를 돌려주는 반복자(flat_map)도 ->가 된다.
+template <class _Iter>
+typename iterator_traits<_Iter>::pointer
+__arrow(const _Iter& __i) {return __i.operator->();}
+
+template <class _Tp>
+_Tp* __arrow(_Tp* __p) {return __p;}
+
 template <class _Iter>
 class reverse_iterator 
 {
@@ -38,7 +46,7 @@ public:
     
     reference operator*() const {_Iter __tmp = current; return *--__tmp;}
     
-    pointer  operator->() const {return &(this->operator*());}
+    pointer  operator->() const {_Iter __tmp = current; return __arrow(--__tmp);}
 
     reverse_iterator& operator++() {--current; return *this;}
     
@@ -4,10 +4,13 @@
 # include "rbt.hpp"
 # include "iterator_tree.hpp"
 # include "reverse_iterator.hpp"
+# include "radix_sort.hpp"
+# include "bloom_filter.hpp"
 
 namespace ft
 {
-template < class Key, class Compare = std::less<Key>, class Alloc = std::allocator< Key> >
+//Balance에 ft::splay_balance를 주면 찾은 키를 루트로 끌어올린다. (rbt.hpp) const 멤버는 끌어올리지 않는다.
+template < class Key, class Compare = std::less<Key>, class Alloc = std::allocator< Key>, class Balance = ft::rb_balance >
 class set
 {
 public:
@@ -62,9 +65,12 @@ public:
 	void		erase(iterator position);
 	size_type	erase(const key_type &k);
 	void		erase(iterator first, iterator last);
+	template <class Pred> size_type	erase_if(Pred pred);
 
 	void		swap(set &x);
 	void		clear(void);
+	void		clear_async(void);
+	bool		compact(size_type max_nodes = static_cast<size_type>(-1));
 
 	key_compare		key_comp(void) const;
 	value_compare	value_comp(void) const;
@@ -80,6 +86,12 @@ public:
 	pair<const_iterator,const_iterator>	equal_range(const key_type &k) const;
 	pair<iterator,iterator>				equal_range(const key_type &k);
 
+	template <class Ite, class Out> Out	find_many(Ite first, Ite last, Out out, bool sorted = false) const;
+	template <class Ite, class Out> Out	count_many(Ite first, Ite last, Out out, bool sorted = false) const;
+
+	void	enable_filter(size_type bits_per_key = 10);
+	void	disable_filter(void);
+	bool	filter_enabled(void) const;
 
 	void print_node() const
 	{
@@ -88,221 +100,314 @@ public:
 
 private:
 	typedef value_compare		vc;
-	typedef ft::rbt<value_type, vc, allocator_type>	tree_type;
+	typedef ft::rbt<value_type, vc, allocator_type, ft::rbtNode<value_type>, ft::__rbt_no_augment, Balance>	tree_type;
 	tree_type				_tree;
 	key_compare				_key_cmp;
 
+	//없는 키를 트리까지 가지 않고 걸러내는 블룸 필터. enable_filter()를 불러야 생긴다.
+	//키에 ft::hash가 있고 Compare가 std::less<Key>일 때만 켤 수 있다.
+	typedef ft::bloom_filter<Key, ft::hash<Key>, ft::__filter_usable<Key, Compare>::value>	filter_type;
+	filter_type				*_filter;
+
+	bool	__filter_rejects(const key_type &k) const;
+	void	__filter_insert(const key_type &k);
+	void	__filter_erase(size_type n);
+	void	__filter_rebuild(void);
+	void	__filter_copy(const filter_type *src);
+
+	template <class Ite> void	__bulk_insert(Ite first, Ite last, ft::__bool_tag<true>);
+	template <class Ite> void	__bulk_insert(Ite first, Ite last, ft::__bool_tag<false>);
+
+	static const size_t	__batch = 64;
+	//compact된 트리에서 erase_if가 앞쪽 이만큼(크기의 1/16)을 보고 다시 만들지 정한다.
+	static const size_t	__rebuild_probe = 16;
+
+	template <class Ite> size_t	__find_batch(Ite &first, Ite last, ft::rbtNode<value_type> **res, bool sorted, ft::rbtNode<value_type> *&finger) const;
+
 };
 
-template <class Key, class Compare, class Alloc>
-set<Key, Compare, Alloc>::set(const key_compare &comp, const allocator_type \
-		&alloc) : _key_cmp(comp)
+template <class Key, class Compare, class Alloc, class Balance>
+set<Key, Compare, Alloc, Balance>::set(const key_compare &comp, const allocator_type \
+		&alloc) : _key_cmp(comp), _filter(NULL)
 {
 	this->_tree._comp = value_compare(comp);
 	this->_tree._alloc = alloc;
 }
 
-template <class Key, class Compare, class Alloc> template <class Ite>
-set<Key, Compare, Alloc>::set(
+template <class Key, class Compare, class Alloc, class Balance> template <class Ite>
+set<Key, Compare, Alloc, Balance>::set(
 	typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
 	Ite last, const key_compare &comp, const allocator_type &alloc) : \
-		_key_cmp(comp)
+		_key_cmp(comp), _filter(NULL)
 {
 	this->_tree._comp = value_compare(comp);;
 	this->_tree._alloc = alloc;
-	this->insert(first, last);
+	this->__bulk_insert(first, last, ft::__bool_tag<ft::is_radix_orderable<Key, Compare>::value>());
 }
 
-template<class Key, class Compare, class Alloc>
-set<Key, Compare, Alloc>::set(set const &src) : \
-		_key_cmp(src._key_cmp)
+template<class Key, class Compare, class Alloc, class Balance>
+set<Key, Compare, Alloc, Balance>::set(set const &src) : \
+		_key_cmp(src._key_cmp), _filter(NULL)
 {
 	this->_tree._comp = src._tree.value_comp();
 	this->_tree._alloc = src._tree.__alloc();
-	insert(src.begin(), src.end());
+	this->_tree.build_sorted(src.begin(), src.size());
+	this->__filter_copy(src._filter);
 }
 
-template<class Key, class Compare, class Alloc>
-set<Key, Compare, Alloc>::~set(void) {
+template<class Key, class Compare, class Alloc, class Balance>
+set<Key, Compare, Alloc, Balance>::~set(void) {
 	this->clear();
+	delete this->_filter;
 }
 
-template<class Key, class Compare, class Alloc>
-set<Key, Compare, Alloc>&
-set<Key, Compare, Alloc>::operator=(set const &rhs) {
+template<class Key, class Compare, class Alloc, class Balance>
+set<Key, Compare, Alloc, Balance>&
+set<Key, Compare, Alloc, Balance>::operator=(set const &rhs) {
 	if (this == &rhs)
 		return (*this);
 	this->_key_cmp = rhs._key_cmp;
 	this->clear();
 	this->_tree.value_comp() = rhs._tree.value_comp();
 	this->_tree.__alloc() = rhs._tree.__alloc();
-	this->insert(rhs.begin(), rhs.end());
+	this->_tree.build_sorted(rhs.begin(), rhs.size());
+	if (this->_filter != NULL)
+		this->__filter_rebuild();
 	return (*this);
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::iterator
-set<Key, Compare, Alloc>::begin(void) {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::iterator
+set<Key, Compare, Alloc, Balance>::begin(void) {
 	return iterator(_tree.begin());
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::const_iterator
-set<Key, Compare, Alloc>::begin(void) const {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::const_iterator
+set<Key, Compare, Alloc, Balance>::begin(void) const {
 	return const_iterator(_tree.begin());
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::iterator
-set<Key, Compare, Alloc>::end(void) {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::iterator
+set<Key, Compare, Alloc, Balance>::end(void) {
 	return iterator(_tree.end());
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::const_iterator
-set<Key, Compare, Alloc>::end(void) const {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::const_iterator
+set<Key, Compare, Alloc, Balance>::end(void) const {
 	return const_iterator(_tree.end());
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::reverse_iterator
-set<Key, Compare, Alloc>::rbegin(void) {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::reverse_iterator
+set<Key, Compare, Alloc, Balance>::rbegin(void) {
 	return reverse_iterator(_tree.end());
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::const_reverse_iterator
-set<Key, Compare, Alloc>::rbegin(void) const {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::const_reverse_iterator
+set<Key, Compare, Alloc, Balance>::rbegin(void) const {
 	return const_reverse_iterator(_tree.end());
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::reverse_iterator
-set<Key, Compare, Alloc>::rend(void) {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::reverse_iterator
+set<Key, Compare, Alloc, Balance>::rend(void) {
 	return reverse_iterator(_tree.begin());
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::const_reverse_iterator
-set<Key, Compare, Alloc>::rend(void) const {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::const_reverse_iterator
+set<Key, Compare, Alloc, Balance>::rend(void) const {
 	return const_reverse_iterator(_tree.begin());
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::size_type
-set<Key, Compare, Alloc>::size(void) const {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::size_type
+set<Key, Compare, Alloc, Balance>::size(void) const {
 	return this->_tree.size();
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::size_type
-set<Key, Compare, Alloc>::max_size(void) const {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::size_type
+set<Key, Compare, Alloc, Balance>::max_size(void) const {
 	return this->_tree.max_size();
 }
 
-template<class Key, class Compare, class Alloc>
-bool	set<Key, Compare, Alloc>::empty(void) const {
+template<class Key, class Compare, class Alloc, class Balance>
+bool	set<Key, Compare, Alloc, Balance>::empty(void) const {
 	return (this->_tree.size() == 0);
 }
 
-template<class Key, class Compare, class Alloc>
-ft::pair<typename set<Key, Compare, Alloc>::iterator, bool>
-set<Key, Compare, Alloc>::insert(const value_type &val) {
+template<class Key, class Compare, class Alloc, class Balance>
+ft::pair<typename set<Key, Compare, Alloc, Balance>::iterator, bool>
+set<Key, Compare, Alloc, Balance>::insert(const value_type &val) {
 	ft::pair<iterator, bool> res;
 
 	res.first = this->find(val);
 	res.second = res.first == end();
 	if (res.second)
+	{
 		res.first = iterator(this->_tree.insert(val));
+		this->__filter_insert(val);
+	}
 	return (res);
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::iterator
-set<Key, Compare, Alloc>::insert(iterator position, const value_type &val) {
-	if (position != position )
-		;
-	return iterator(this->_tree.insert(val));
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::iterator
+set<Key, Compare, Alloc, Balance>::insert(iterator position, const value_type &val) {
+	(void)position;
+	iterator it(this->_tree.insert(val));
+	this->__filter_insert(val);
+	return it;
 }
 
-template<class Key, class Compare, class Alloc> template <class Ite>
-void	set<Key, Compare, Alloc>::insert(Ite first, Ite last) {
+template<class Key, class Compare, class Alloc, class Balance> template <class Ite>
+void	set<Key, Compare, Alloc, Balance>::insert(Ite first, Ite last) {
 	while (first != last)
 	{
-		this->_tree.insert(*first++);
+		this->_tree.insert(*first);
+		this->__filter_insert(*first++);
 	}
 }
 
-template<class Key, class Compare, class Alloc>
-void	set<Key, Compare, Alloc>::erase(iterator position)
+//정수 키는 radix_sort로 정렬하고 중복을 지운 뒤 트리를 O(n)에 만든다.
+template<class Key, class Compare, class Alloc, class Balance> template <class Ite>
+void	set<Key, Compare, Alloc, Balance>::__bulk_insert(Ite first, Ite last, ft::__bool_tag<true>) {
+	ft::vector<Key> buf;
+	size_t n = 0;
+
+	for (; first != last; ++first)
+		buf.push_back(*first);
+	ft::radix_sort(buf.begin(), buf.end());
+	for (size_t i = 0; i < buf.size(); i++)
+	{
+		if (n == 0 || buf[n - 1] != buf[i])
+			buf[n++] = buf[i];
+	}
+	this->_tree.build_sorted(buf.begin(), n);
+}
+
+template<class Key, class Compare, class Alloc, class Balance> template <class Ite>
+void	set<Key, Compare, Alloc, Balance>::__bulk_insert(Ite first, Ite last, ft::__bool_tag<false>) {
+	this->insert(first, last);
+}
+
+template<class Key, class Compare, class Alloc, class Balance>
+void	set<Key, Compare, Alloc, Balance>::erase(iterator position)
 {
 	this->_tree.delete_node(*position);
+	this->__filter_erase(1);
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::size_type
-set<Key, Compare, Alloc>::erase(const key_type &k)
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::size_type
+set<Key, Compare, Alloc, Balance>::erase(const key_type &k)
 {
-	return this->_tree.delete_node(k);
+	size_type n = this->_tree.delete_node(k);
+
+	this->__filter_erase(n);
+	return n;
 }
 
-template<class Key, class Compare, class Alloc>
-void	set<Key, Compare, Alloc>::erase(iterator first, iterator last)
+template<class Key, class Compare, class Alloc, class Balance>
+void	set<Key, Compare, Alloc, Balance>::erase(iterator first, iterator last)
 {
 	while (first != last)
 	{
 		this->_tree.delete_node(*first++);
+		this->__filter_erase(1);
 	}
-		
 }
 
-template<class Key, class Compare, class Alloc>
-void	set<Key, Compare, Alloc>::swap(set &x) {
+//pred(원소)가 참인 원소를 모두 지우고 지운 개수를 돌려준다. 찾지 않고 한 번의 중위순회로 지운다.
+template<class Key, class Compare, class Alloc, class Balance>
+template <class Pred>
+typename set<Key, Compare, Alloc, Balance>::size_type
+set<Key, Compare, Alloc, Balance>::erase_if(Pred pred)
+{
+	size_type n = this->_tree.erase_if(pred, this->_tree.compacted()
+			? this->size() / __rebuild_probe + 1 : static_cast<size_t>(-1));
+
+	this->__filter_erase(n);
+	return n;
+}
+
+template<class Key, class Compare, class Alloc, class Balance>
+void	set<Key, Compare, Alloc, Balance>::swap(set &x) {
 	this->_tree.swap(x._tree);
+	std::swap(this->_filter, x._filter);
 }
 
-template<class Key, class Compare, class Alloc>
-void	set<Key, Compare, Alloc>::clear(void)
+template<class Key, class Compare, class Alloc, class Balance>
+void	set<Key, Compare, Alloc, Balance>::clear(void)
 {
 	this->_tree.clear();
+	if (this->_filter != NULL)
+		this->_filter->reset(0);
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::key_compare
-set<Key, Compare, Alloc>::key_comp(void) const {
+//clear와 같지만 노드 해제는 reclaimer 스레드에 넘기고 바로 돌아온다. 쓰려면 reclaimer.hpp를 넣는다.
+template<class Key, class Compare, class Alloc, class Balance>
+void	set<Key, Compare, Alloc, Balance>::clear_async(void)
+{
+	this->_tree.clear_async();
+	if (this->_filter != NULL)
+		this->_filter->reset(0);
+}
+
+//노드를 키 순서대로 연속된 메모리에 다시 놓아 순회를 빠르게 한다. 반복자는 무효가 된다.
+//max_nodes를 주면 그만큼만 옮기고, 다 옮길 때까지 다시 부르면 된다. 다 옮겼으면 true.
+template<class Key, class Compare, class Alloc, class Balance>
+bool	set<Key, Compare, Alloc, Balance>::compact(size_type max_nodes) {
+	return this->_tree.compact(max_nodes);
+}
+
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::key_compare
+set<Key, Compare, Alloc, Balance>::key_comp(void) const {
 	return (key_compare());
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::value_compare
-set<Key, Compare, Alloc>::value_comp(void) const {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::value_compare
+set<Key, Compare, Alloc, Balance>::value_comp(void) const {
 	return (value_compare(key_compare()));
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::iterator
-set<Key, Compare, Alloc>::find(const key_type &k)
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::iterator
+set<Key, Compare, Alloc, Balance>::find(const key_type &k)
 {
+	if (this->__filter_rejects(k))
+		return this->end();
 	return iterator(this->_tree.find(k));
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::const_iterator
-set<Key, Compare, Alloc>::find(const key_type &k) const
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::const_iterator
+set<Key, Compare, Alloc, Balance>::find(const key_type &k) const
 {
+	if (this->__filter_rejects(k))
+		return this->end();
 	return const_iterator(this->_tree.find(k));
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::size_type
-set<Key, Compare, Alloc>::count(const key_type &k) const
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::size_type
+set<Key, Compare, Alloc, Balance>::count(const key_type &k) const
 {
+	if (this->__filter_rejects(k))
+		return 0;
 	return !(this->_tree.find(k)->_is_nul);
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::iterator
-set<Key, Compare, Alloc>::lower_bound(const key_type &k) {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::iterator
+set<Key, Compare, Alloc, Balance>::lower_bound(const key_type &k) {
 	iterator it = this->begin(), ite = this->end();
 
 	while (it != ite)
@@ -314,9 +419,9 @@ set<Key, Compare, Alloc>::lower_bound(const key_type &k) {
 	return (it);
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::const_iterator
-set<Key, Compare, Alloc>::lower_bound(const key_type &k) const {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::const_iterator
+set<Key, Compare, Alloc, Balance>::lower_bound(const key_type &k) const {
 	const_iterator it = this->begin(), ite = this->end();
 
 	while (it != ite)
@@ -328,9 +433,9 @@ set<Key, Compare, Alloc>::lower_bound(const key_type &k) const {
 	return (it);
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::iterator
-set<Key, Compare, Alloc>::upper_bound(const key_type &k) {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::iterator
+set<Key, Compare, Alloc, Balance>::upper_bound(const key_type &k) {
 	iterator it = this->begin(), ite = this->end();
 
 	while (it != ite)
@@ -342,9 +447,9 @@ set<Key, Compare, Alloc>::upper_bound(const key_type &k) {
 	return (it);
 }
 
-template<class Key, class Compare, class Alloc>
-typename set<Key, Compare, Alloc>::const_iterator
-set<Key, Compare, Alloc>::upper_bound(const key_type &k) const {
+template<class Key, class Compare, class Alloc, class Balance>
+typename set<Key, Compare, Alloc, Balance>::const_iterator
+set<Key, Compare, Alloc, Balance>::upper_bound(const key_type &k) const {
 	const_iterator it = this->begin(), ite = this->end();
 
 	while (it != ite)
@@ -356,58 +461,161 @@ set<Key, Compare, Alloc>::upper_bound(const key_type &k) const {
 	return (it);
 }
 
-template<class Key, class Compare, class Alloc>
-ft::pair<typename set<Key, Compare, Alloc>::const_iterator, typename set<Key, Compare, Alloc>::const_iterator>
-set<Key, Compare, Alloc>::equal_range(const key_type &k) const
+template<class Key, class Compare, class Alloc, class Balance>
+ft::pair<typename set<Key, Compare, Alloc, Balance>::const_iterator, typename set<Key, Compare, Alloc, Balance>::const_iterator>
+set<Key, Compare, Alloc, Balance>::equal_range(const key_type &k) const
 {
 	return ft::pair<const_iterator, const_iterator>(lower_bound(k),upper_bound(k));
 }
 
-template<class Key, class Compare, class Alloc>
-ft::pair<typename set<Key, Compare, Alloc>::iterator, typename set<Key, Compare, Alloc>::iterator>
-set<Key, Compare, Alloc>::equal_range(const key_type &k) {
+template<class Key, class Compare, class Alloc, class Balance>
+ft::pair<typename set<Key, Compare, Alloc, Balance>::iterator, typename set<Key, Compare, Alloc, Balance>::iterator>
+set<Key, Compare, Alloc, Balance>::equal_range(const key_type &k) {
 	return ft::pair<iterator, iterator>(lower_bound(k),upper_bound(k));
 }
 
-template <class Key, class Compare, class Alloc>
-bool	operator==(const set<Key, Compare, Alloc> &lhs,
-					const set<Key, Compare, Alloc> &rhs)
+//키 묶음을 한 번에 찾는다. 각 키의 find 결과를 순서대로 out에 쓴다.
+//sorted이면 키가 오름차순이라고 보고 직전 결과에서 이어서 찾는다.
+template<class Key, class Compare, class Alloc, class Balance> template <class Ite, class Out>
+Out	set<Key, Compare, Alloc, Balance>::find_many(Ite first, Ite last, Out out, bool sorted) const {
+	ft::rbtNode<value_type> *res[__batch];
+	ft::rbtNode<value_type> *finger = NULL;
+
+	while (first != last)
+	{
+		size_t n = this->__find_batch(first, last, res, sorted, finger);
+		for (size_t i = 0; i < n; i++)
+			*out++ = const_iterator(res[i]);
+	}
+	return out;
+}
+
+template<class Key, class Compare, class Alloc, class Balance> template <class Ite, class Out>
+Out	set<Key, Compare, Alloc, Balance>::count_many(Ite first, Ite last, Out out, bool sorted) const {
+	ft::rbtNode<value_type> *res[__batch];
+	ft::rbtNode<value_type> *finger = NULL;
+
+	while (first != last)
+	{
+		size_t n = this->__find_batch(first, last, res, sorted, finger);
+		for (size_t i = 0; i < n; i++)
+			*out++ = static_cast<size_type>(!res[i]->_is_nul);
+	}
+	return out;
+}
+
+template<class Key, class Compare, class Alloc, class Balance> template <class Ite>
+size_t	set<Key, Compare, Alloc, Balance>::__find_batch(Ite &first, Ite last, ft::rbtNode<value_type> **res, bool sorted, ft::rbtNode<value_type> *&finger) const {
+	if (sorted)
+		return this->_tree.find_many_sorted(first, last, this->_key_cmp, res, __batch, finger);
+	return this->_tree.find_many(first, last, this->_key_cmp, res, __batch);
+}
+
+//필터를 켠다. 키 하나에 bits_per_key비트를 쓴다. (10비트면 오탐이 약 1%)
+template<class Key, class Compare, class Alloc, class Balance>
+void	set<Key, Compare, Alloc, Balance>::enable_filter(size_type bits_per_key) {
+	(void)sizeof(ft::__filter_needs_hash_and_std_less<ft::__filter_usable<Key, Compare>::value>);
+	delete this->_filter;
+	this->_filter = NULL;
+	this->_filter = new filter_type(bits_per_key);
+	this->__filter_rebuild();
+}
+
+template<class Key, class Compare, class Alloc, class Balance>
+void	set<Key, Compare, Alloc, Balance>::disable_filter(void) {
+	delete this->_filter;
+	this->_filter = NULL;
+}
+
+template<class Key, class Compare, class Alloc, class Balance>
+bool	set<Key, Compare, Alloc, Balance>::filter_enabled(void) const {
+	return this->_filter != NULL;
+}
+
+//필터가 없다고 하면 트리를 내려가지 않는다. 필터를 읽기만 하므로 const 조회끼리는 동시에 불러도 된다.
+template<class Key, class Compare, class Alloc, class Balance>
+bool	set<Key, Compare, Alloc, Balance>::__filter_rejects(const key_type &k) const {
+	if (this->_filter == NULL)
+		return false;
+	return !this->_filter->may_contain(k);
+}
+
+//잡아둔 크기의 두 배를 넘으면 오탐이 늘어나므로 지금 크기로 다시 만든다.
+template<class Key, class Compare, class Alloc, class Balance>
+void	set<Key, Compare, Alloc, Balance>::__filter_insert(const key_type &k) {
+	if (this->_filter == NULL)
+		return ;
+	if (this->size() > 2 * this->_filter->capacity())
+		this->__filter_rebuild();
+	else
+		this->_filter->insert(k);
+}
+
+template<class Key, class Compare, class Alloc, class Balance>
+void	set<Key, Compare, Alloc, Balance>::__filter_erase(size_type n) {
+	if (this->_filter == NULL)
+		return ;
+	//지운 키의 비트가 많이 남아 오탐이 늘었으면 지우는 쪽에서 바로 다시 만든다.
+	this->_filter->note_erase(n);
+	if (this->_filter->stale() > this->size() / 2 + 64)
+		this->__filter_rebuild();
+}
+
+template<class Key, class Compare, class Alloc, class Balance>
+void	set<Key, Compare, Alloc, Balance>::__filter_rebuild(void) {
+	this->_filter->reset(this->size());
+	for (const_iterator it = this->begin(); it != this->end(); ++it)
+		this->_filter->insert(*it);
+}
+
+//복사한 컨테이너도 원본처럼 필터를 켠다. enable_filter를 거치지 않아 필터를 못 쓰는 타입도 복사된다.
+template<class Key, class Compare, class Alloc, class Balance>
+void	set<Key, Compare, Alloc, Balance>::__filter_copy(const filter_type *src) {
+	if (src == NULL)
+		return ;
+	this->_filter = new filter_type(src->bits_per_key());
+	this->__filter_rebuild();
+}
+
+template <class Key, class Compare, class Alloc, class Balance>
+bool	operator==(const set<Key, Compare, Alloc, Balance> &lhs,
+					const set<Key, Compare, Alloc, Balance> &rhs)
 {
 	return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <class Key, class Compare, class Alloc>
-bool	operator!=(const set<Key, Compare, Alloc> &lhs,
-					const set<Key, Compare, Alloc> &rhs) {
+template <class Key, class Compare, class Alloc, class Balance>
+bool	operator!=(const set<Key, Compare, Alloc, Balance> &lhs,
+					const set<Key, Compare, Alloc, Balance> &rhs) {
 	return !(lhs == rhs);
 }
 
-template <class Key, class Compare, class Alloc>
-bool	operator< (const set<Key, Compare, Alloc> &lhs,
-					const set<Key, Compare, Alloc> &rhs) {
+template <class Key, class Compare, class Alloc, class Balance>
+bool	operator< (const set<Key, Compare, Alloc, Balance> &lhs,
+					const set<Key, Compare, Alloc, Balance> &rhs) {
 	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <class Key, class Compare, class Alloc>
-bool	operator<=(const set<Key, Compare, Alloc> &lhs,
-					const set<Key, Compare, Alloc> &rhs) {
+template <class Key, class Compare, class Alloc, class Balance>
+bool	operator<=(const set<Key, Compare, Alloc, Balance> &lhs,
+					const set<Key, Compare, Alloc, Balance> &rhs) {
 	return !(rhs < lhs);
 }
 
-template <class Key, class Compare, class Alloc>
-bool	operator> (const set<Key, Compare, Alloc> &lhs,
-					const set<Key, Compare, Alloc> &rhs) {
+template <class Key, class Compare, class Alloc, class Balance>
+bool	operator> (const set<Key, Compare, Alloc, Balance> &lhs,
+					const set<Key, Compare, Alloc, Balance> &rhs) {
 	return (rhs < lhs);
 }
 
-template <class Key, class Compare, class Alloc>
-bool	operator>=(const set<Key, Compare, Alloc> &lhs,
-					const set<Key, Compare, Alloc> &rhs) {
+template <class Key, class Compare, class Alloc, class Balance>
+bool	operator>=(const set<Key, Compare, Alloc, Balance> &lhs,
+					const set<Key, Compare, Alloc, Balance> &rhs) {
 	return !(lhs < rhs);
 }
 
-template <class Key, class Compare, class Alloc>
-void	swap(set<Key, Compare, Alloc> &x, set<Key, Compare, Alloc> &y) {
+template <class Key, class Compare, class Alloc, class Balance>
+void	swap(set<Key, Compare, Alloc, Balance> &x, set<Key, Compare, Alloc, Balance> &y) {
 	x.swap(y);
 }
 
@@ -0,0 +1,241 @@
+#ifndef SHARDED_MAP_CLASS_HPP
+# define SHARDED_MAP_CLASS_HPP
+
+# include <pthread.h>
+# include "map.hpp"
+# include "hash.hpp"
+
+namespace ft
+{
+//읽기/쓰기 잠금을 잡고 범위를 벗어나면 푼다. 콜백이 예외를 던져도 잠금이 남지 않는다.
+struct __read_guard
+{
+	pthread_rwlock_t	*lock;
+
+	explicit __read_guard(pthread_rwlock_t *lock_) : lock(lock_) { pthread_rwlock_rdlock(lock); }
+	~__read_guard() { pthread_rwlock_unlock(lock); }
+
+private:
+	__read_guard(const __read_guard &);
+	__read_guard	&operator=(const __read_guard &);
+};
+
+struct __write_guard
+{
+	pthread_rwlock_t	*lock;
+
+	explicit __write_guard(pthread_rwlock_t *lock_) : lock(lock_) { pthread_rwlock_wrlock(lock); }
+	~__write_guard() { pthread_rwlock_unlock(lock); }
+
+private:
+	__write_guard(const __write_guard &);
+	__write_guard	&operator=(const __write_guard &);
+};
+
+//키의 해시로 Shards개의 ft::map 중 하나를 고르고, 맵마다 따로 읽기/쓰기 잠금을 둔다.
+//서로 다른 조각의 키는 동시에 쓸 수 있고, 같은 조각이라도 읽기끼리는 막지 않는다.
+//잠금 밖으로 반복자나 참조를 내보내지 않으므로 값은 복사해 받거나 콜백 안에서 쓴다.
+//조각은 Hash로 고르고 조각 안에서는 Compare로 찾으므로, Compare로 같은 키는 Hash도 같아야 한다.
+//(기본값 ft::hash와 std::less는 맞다. 대소문자를 무시하는 Compare라면 Hash도 대소문자를 무시해야 한다)
+template < class Key, class T, size_t Shards = 16, class Hash = ft::hash<Key>,
+		class Compare = std::less<Key>, class Alloc = std::allocator< ft::pair<const Key,T> > >
+class sharded_map
+{
+public:
+	typedef Key										key_type;
+	typedef T										mapped_type;
+	typedef ft::pair<const key_type, mapped_type>	value_type;
+	typedef Hash									hasher;
+	typedef Compare									key_compare;
+	typedef ft::map<Key, T, Compare, Alloc>			shard_type;
+	typedef size_t									size_type;
+
+	sharded_map(void);
+	virtual ~sharded_map(void);
+
+	bool		find(const key_type &k, mapped_type &out) const;
+	size_type	count(const key_type &k) const;
+	template <class Fn> bool	visit(const key_type &k, Fn fn) const;
+
+	bool		insert(const value_type &val);
+	size_type	erase(const key_type &k);
+	template <class Fn> void	upsert(const key_type &k, Fn fn);
+
+	template <class Fn> void	for_each(Fn fn) const;
+
+	size_type	size(void) const;
+	bool		empty(void) const;
+	void		clear(void);
+
+	size_type	shard_count(void) const;
+
+private:
+	//Shards가 0이면 여기서 컴파일이 멈춘다. (조각을 고를 때 0으로 나누게 된다)
+	typedef char	__shards_must_be_positive[Shards > 0 ? 1 : -1];
+
+	//잠금끼리 같은 캐시라인을 나눠 쓰지 않도록 떨어뜨려 둔다.
+	struct __attribute__((aligned(64))) shard
+	{
+		mutable pthread_rwlock_t	lock;
+		shard_type					map;
+	};
+
+	shard	_shards[Shards];
+	hasher	_hash;
+
+	sharded_map(const sharded_map &);
+	sharded_map	&operator=(const sharded_map &);
+
+	shard		&__shard(const key_type &k);
+	const shard	&__shard(const key_type &k) const;
+
+};
+
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+sharded_map<Key, T, Shards, Hash, Compare, Alloc>::sharded_map(void)
+{
+	for (size_type i = 0; i < Shards; i++)
+		pthread_rwlock_init(&this->_shards[i].lock, NULL);
+}
+
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+sharded_map<Key, T, Shards, Hash, Compare, Alloc>::~sharded_map(void)
+{
+	for (size_type i = 0; i < Shards; i++)
+		pthread_rwlock_destroy(&this->_shards[i].lock);
+}
+
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+typename sharded_map<Key, T, Shards, Hash, Compare, Alloc>::shard&
+sharded_map<Key, T, Shards, Hash, Compare, Alloc>::__shard(const key_type &k) {
+	return this->_shards[this->_hash(k) % Shards];
+}
+
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+const typename sharded_map<Key, T, Shards, Hash, Compare, Alloc>::shard&
+sharded_map<Key, T, Shards, Hash, Compare, Alloc>::__shard(const key_type &k) const {
+	return this->_shards[this->_hash(k) % Shards];
+}
+
+//있으면 값을 out에 복사하고 true.
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+bool	sharded_map<Key, T, Shards, Hash, Compare, Alloc>::find(const key_type &k, mapped_type &out) const
+{
+	const shard &s = this->__shard(k);
+	__read_guard guard(&s.lock);
+	typename shard_type::const_iterator it = s.map.find(k);
+
+	if (it == s.map.end())
+		return false;
+	out = it->second;
+	return true;
+}
+
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+typename sharded_map<Key, T, Shards, Hash, Compare, Alloc>::size_type
+sharded_map<Key, T, Shards, Hash, Compare, Alloc>::count(const key_type &k) const
+{
+	const shard &s = this->__shard(k);
+	__read_guard guard(&s.lock);
+
+	return s.map.count(k);
+}
+
+//있으면 읽기 잠금을 잡은 채 fn(const T &)을 부르고 true.
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc> template <class Fn>
+bool	sharded_map<Key, T, Shards, Hash, Compare, Alloc>::visit(const key_type &k, Fn fn) const
+{
+	const shard &s = this->__shard(k);
+	__read_guard guard(&s.lock);
+	typename shard_type::const_iterator it = s.map.find(k);
+
+	if (it == s.map.end())
+		return false;
+	fn(it->second);
+	return true;
+}
+
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+bool	sharded_map<Key, T, Shards, Hash, Compare, Alloc>::insert(const value_type &val)
+{
+	shard &s = this->__shard(val.first);
+	__write_guard guard(&s.lock);
+
+	return s.map.insert(val).second;
+}
+
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+typename sharded_map<Key, T, Shards, Hash, Compare, Alloc>::size_type
+sharded_map<Key, T, Shards, Hash, Compare, Alloc>::erase(const key_type &k)
+{
+	shard &s = this->__shard(k);
+	__write_guard guard(&s.lock);
+
+	return s.map.erase(k);
+}
+
+//operator[]처럼 없으면 T()를 넣고, 쓰기 잠금을 잡은 채 fn(T &)으로 값을 고친다.
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc> template <class Fn>
+void	sharded_map<Key, T, Shards, Hash, Compare, Alloc>::upsert(const key_type &k, Fn fn)
+{
+	shard &s = this->__shard(k);
+	__write_guard guard(&s.lock);
+
+	fn(s.map[k]);
+}
+
+//조각마다 읽기 잠금을 잡고 그 조각의 값을 키 순서로 fn에 넘긴다.
+//한 조각 안에서는 한 시점의 모습이지만, 조각끼리는 서로 다른 시점일 수 있다.
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc> template <class Fn>
+void	sharded_map<Key, T, Shards, Hash, Compare, Alloc>::for_each(Fn fn) const
+{
+	for (size_type i = 0; i < Shards; i++)
+	{
+		const shard &s = this->_shards[i];
+		__read_guard guard(&s.lock);
+
+		for (typename shard_type::const_iterator it = s.map.begin(); it != s.map.end(); ++it)
+			fn(*it);
+	}
+}
+
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+typename sharded_map<Key, T, Shards, Hash, Compare, Alloc>::size_type
+sharded_map<Key, T, Shards, Hash, Compare, Alloc>::size(void) const
+{
+	size_type n = 0;
+
+	for (size_type i = 0; i < Shards; i++)
+	{
+		__read_guard guard(&this->_shards[i].lock);
+		n += this->_shards[i].map.size();
+	}
+	return n;
+}
+
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+bool	sharded_map<Key, T, Shards, Hash, Compare, Alloc>::empty(void) const
+{
+	return this->size() == 0;
+}
+
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+void	sharded_map<Key, T, Shards, Hash, Compare, Alloc>::clear(void)
+{
+	for (size_type i = 0; i < Shards; i++)
+	{
+		__write_guard guard(&this->_shards[i].lock);
+		this->_shards[i].map.clear();
+	}
+}
+
+template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+typename sharded_map<Key, T, Shards, Hash, Compare, Alloc>::size_type
+sharded_map<Key, T, Shards, Hash, Compare, Alloc>::shard_count(void) const
+{
+	return Shards;
+}
+
+}
+
+#endif
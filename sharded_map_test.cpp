@@ -0,0 +1,123 @@
+#include <map>
+#include <string>
+#include <pthread.h>
+#include <stdlib.h>
+#include "sharded_map.hpp"
+#include "tester.hpp"
+
+typedef ft::sharded_map<int, long, 8>	map_t;
+
+struct Add
+{
+	long	n;
+
+	explicit Add(long n_) : n(n_) {}
+	void	operator()(long &v) const { v += n; }
+};
+
+struct Sum
+{
+	long	*total;
+	size_t	*seen;
+
+	void	operator()(const ft::pair<const int, long> &p) const { *total += p.second; ++*seen; }
+};
+
+struct Copy
+{
+	long	*out;
+
+	void	operator()(const long &v) const { *out = v; }
+};
+
+static map_t	g_map;
+static const int	g_threads = 4;
+static const int	g_per_thread = 20000;
+
+//스레드마다 자기 키를 넣고 지우고, 모두가 같은 카운터 키 100개를 올린다.
+static void *
+worker(void *arg)
+{
+	long id = reinterpret_cast<long>(arg);
+	long v;
+
+	for (int i = 0; i < g_per_thread; i++)
+	{
+		int own = 1000 + static_cast<int>(id) * g_per_thread + i;
+		g_map.insert(ft::make_pair(own, static_cast<long>(own)));
+		g_map.upsert(i % 100, Add(1));
+		if (i % 2)
+			g_map.erase(own);
+		else if (!g_map.find(own, v) || v != own)
+			g_map.upsert(-1, Add(1));
+		g_map.count(i % 100);
+	}
+	return NULL;
+}
+
+int main(void)
+{
+	srand(23);
+	map_t m;
+	std::map<int, long> ref;
+
+	FT_CHECK(m.empty() && m.shard_count() == 8);
+	for (int i = 0; i < 50000; i++)
+	{
+		int k = rand() % 5000;
+		switch (rand() % 4)
+		{
+		case 0:
+			FT_CHECK(m.erase(k) == ref.erase(k));
+			break;
+		case 1:
+			FT_CHECK(m.insert(ft::make_pair(k, static_cast<long>(i))) == ref.insert(std::make_pair(k, static_cast<long>(i))).second);
+			break;
+		case 2:
+			m.upsert(k, Add(i));
+			ref[k] += i;
+			break;
+		default:
+		{
+			long v = -1;
+			bool found = m.find(k, v);
+			FT_CHECK(found == (ref.count(k) == 1) && m.count(k) == ref.count(k));
+			if (found)
+				FT_CHECK(v == ref[k]);
+		}
+		}
+	}
+	FT_CHECK(m.size() == ref.size());
+	long total = 0, ref_total = 0;
+	size_t seen = 0;
+	Sum sum = {&total, &seen};
+	m.for_each(sum);
+	for (std::map<int, long>::iterator it = ref.begin(); it != ref.end(); ++it)
+		ref_total += it->second;
+	FT_CHECK(total == ref_total && seen == ref.size());
+	long got = 0;
+	Copy copy = {&got};
+	FT_CHECK(m.visit(ref.begin()->first, copy) && got == ref.begin()->second);
+	FT_CHECK(!m.visit(-7, copy));
+	m.clear();
+	FT_CHECK(m.empty() && m.count(ref.begin()->first) == 0);
+
+	//여러 스레드에서. 카운터는 잃어버린 증가가 없어야 하고, 자기 키는 짝수 번째만 남는다.
+	pthread_t th[g_threads];
+	for (long t = 0; t < g_threads; t++)
+		pthread_create(&th[t], NULL, worker, reinterpret_cast<void *>(t));
+	for (int t = 0; t < g_threads; t++)
+		pthread_join(th[t], NULL);
+	long counters = 0;
+	bool ok = true;
+	for (int k = 0; k < 100; k++)
+	{
+		long v = 0;
+		ok = ok && g_map.find(k, v);
+		counters += v;
+	}
+	FT_CHECK(ok && counters == static_cast<long>(g_threads) * g_per_thread);
+	FT_CHECK(g_map.count(-1) == 0);
+	FT_CHECK(g_map.size() == 100 + static_cast<size_t>(g_threads) * g_per_thread / 2);
+	return ft_test::result("sharded_map");
+}
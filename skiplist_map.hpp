@@ -0,0 +1,677 @@
+#ifndef SKIPLIST_MAP_CLASS_HPP
+# define SKIPLIST_MAP_CLASS_HPP
+
+# include <new>
+# include "utils.hpp"
+# include "vector.hpp"
+# include "epoch.hpp"
+
+namespace ft
+{
+//높이만큼의 next가 뒤에 붙어 할당된다. next의 가장 아래 비트가 켜져 있으면 그 층에서 지워진 노드다.
+//finished는 넣은 스레드와 지운 스레드가 각자 끝날 때 하나씩 올리고, 두 번째로 올린 쪽이 노드를 retire한다.
+template <class Value>
+struct __skip_node
+{
+	Value					val;
+	int						height;
+	volatile int			finished;
+	__skip_node *volatile	next[1];
+};
+
+//0층을 따라가는 정방향 반복자. 지워진 노드는 건너뛴다.
+//다른 스레드가 동시에 고치는 중이면 그 변경이 보일 수도 안 보일 수도 있다. (약한 일관성)
+template <class Node, class Value>
+class __skip_iterator
+{
+public:
+	typedef Value						value_type;
+	typedef ptrdiff_t					difference_type;
+	typedef value_type&					reference;
+	typedef value_type*					pointer;
+	typedef std::forward_iterator_tag	iterator_category;
+
+	Node	*_node;
+
+	__skip_iterator(void) : _node(NULL) {}
+
+	explicit __skip_iterator(Node *node_) : _node(node_) {}
+
+	template <class V>
+	__skip_iterator(const __skip_iterator<Node, V> &src) : _node(src._node) {}
+
+	reference
+	operator*(void) const
+	{ return _node->val; }
+
+	pointer
+	operator->(void) const
+	{ return &_node->val; }
+
+	__skip_iterator &
+	operator++(void)
+	{
+		Node *n = __unmark(__load(_node->next[0]));
+
+		while (n != NULL && __is_marked(__load(n->next[0])))
+			n = __unmark(__load(n->next[0]));
+		_node = n;
+		return *this;
+	}
+
+	__skip_iterator
+	operator++(int)
+	{
+		__skip_iterator tmp(*this);
+		++(*this);
+		return tmp;
+	}
+
+	template <class V>
+	bool
+	operator==(const __skip_iterator<Node, V> &rhs) const
+	{ return _node == rhs._node; }
+
+	template <class V>
+	bool
+	operator!=(const __skip_iterator<Node, V> &rhs) const
+	{ return _node != rhs._node; }
+
+	//링크를 읽을 때는 늘 acquire로 읽는다. 노드 값은 CAS로 걸기 전에 만들어 둔다.
+	static Node *
+	__load(Node *volatile const &p)
+	{ return __atomic_load_n(&p, __ATOMIC_ACQUIRE); }
+
+	static bool
+	__is_marked(Node *p)
+	{ return (reinterpret_cast<size_t>(p) & 1) != 0; }
+
+	static Node *
+	__unmark(Node *p)
+	{ return reinterpret_cast<Node *>(reinterpret_cast<size_t>(p) & ~static_cast<size_t>(1)); }
+};
+
+//락 없이 여러 스레드가 동시에 넣고 찾고 지울 수 있는 정렬된 맵.
+//각 층의 링크를 CAS로 바꾸고, 떼어 낸 노드는 ft::epoch로 회수한다.
+//멤버 함수는 알아서 epoch에 들어가지만, 반복자나 원소 참조를 들고 있는 동안은 호출한 쪽이 ft::epoch_guard를 잡고 있어야 한다.
+//값(mapped_type)을 여러 스레드가 함께 고치는 것은 막아 주지 않는다. 생성자, 소멸자, operator=, swap은 다른 스레드가 쓰지 않을 때만 부른다.
+template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator< ft::pair<const Key,T> > >
+class skiplist_map
+{
+public:
+	typedef Key											key_type;
+	typedef T											mapped_type;
+	typedef ft::pair<const key_type, mapped_type>		value_type;
+	typedef Compare										key_compare;
+	class	value_compare
+	{
+		friend class skiplist_map;
+
+		public:
+		value_compare() : comp(Compare()) { };
+
+		protected:
+		Compare comp;
+		value_compare(Compare c) : comp(c) { };
+
+		public:
+		typedef bool		result_type;
+		typedef value_type	first_argument_type;
+		typedef value_type	second_argument_type;
+		bool	operator()(const value_type &x, const value_type &y) const {
+			return comp(x.first, y.first);
+		}
+	};
+
+	typedef Alloc										allocator_type;
+	typedef typename allocator_type::reference			reference;
+	typedef typename allocator_type::const_reference	const_reference;
+	typedef typename allocator_type::pointer			pointer;
+	typedef typename allocator_type::const_pointer		const_pointer;
+	typedef ft::__skip_node<value_type>					node_type;
+	typedef node_type*									node_ptr;
+
+	typedef ptrdiff_t									difference_type;
+	typedef size_t										size_type;
+
+	typedef ft::__skip_iterator<node_type, value_type>			iterator;
+	typedef ft::__skip_iterator<node_type, const value_type>	const_iterator;
+
+	explicit skiplist_map(const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	template <class Ite>
+	skiplist_map(typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+			Ite last, const key_compare &comp = key_compare(),
+			const allocator_type &alloc = allocator_type());
+	skiplist_map(const skiplist_map &src);
+	virtual ~skiplist_map(void);
+
+	skiplist_map	&operator=(skiplist_map const &rhs);
+
+	iterator		begin(void);
+	const_iterator	begin(void) const;
+	iterator		end(void);
+	const_iterator	end(void) const;
+
+	size_type	size(void) const;
+	size_type	max_size(void) const;
+	bool		empty(void) const;
+
+	mapped_type	&operator[](const key_type &k);
+
+	ft::pair<iterator, bool>	insert(const value_type &val);
+	iterator					insert(iterator position, const value_type &val);
+	template <class Ite> void	insert(Ite first, Ite last);
+
+	void		erase(iterator position);
+	size_type	erase(const key_type &k);
+	void		erase(iterator first, iterator last);
+
+	void		swap(skiplist_map &x);
+	void		clear(void);
+
+	key_compare		key_comp(void) const;
+	value_compare	value_comp(void) const;
+
+	iterator		find(const key_type &k);
+	const_iterator	find(const key_type &k) const;
+	size_type		count(const key_type &k) const;
+	iterator		lower_bound(const key_type &k);
+	const_iterator	lower_bound(const key_type &k) const;
+	iterator		upper_bound(const key_type &k);
+	const_iterator	upper_bound(const key_type &k) const;
+
+	allocator_type	get_allocator(void) const;
+
+private:
+	enum { __max_height = 24 };
+
+	typedef typename Alloc::template rebind<char>::other	byte_allocator;
+
+	node_ptr			_head;
+	volatile long		_size;
+	key_compare			_key_cmp;
+	allocator_type		_alloc;
+
+	static node_ptr	__load(node_ptr volatile const &p) { return iterator::__load(p); }
+	static bool		__is_marked(node_ptr p) { return iterator::__is_marked(p); }
+	static node_ptr	__unmark(node_ptr p) { return iterator::__unmark(p); }
+	static node_ptr	__mark(node_ptr p) { return reinterpret_cast<node_ptr>(reinterpret_cast<size_t>(p) | 1); }
+
+	static size_type	__bytes(int height);
+	static node_ptr		__alloc_node(int height);
+	static void			__free_node(void *p);
+	static int			__random_height(void);
+
+	bool		__find(const key_type &k, node_ptr *preds, node_ptr *succs) const;
+	node_ptr	__lower(const key_type &k) const;
+	void		__finish(node_ptr n);
+	void		__destroy_all(void);
+
+};
+
+template <class Key, class T, class Compare, class Alloc>
+skiplist_map<Key, T, Compare, Alloc>::skiplist_map(const key_compare &comp, const allocator_type &alloc) : \
+		_head(__alloc_node(__max_height)), _size(0), _key_cmp(comp), _alloc(alloc)
+{
+}
+
+template <class Key, class T, class Compare, class Alloc> template <class Ite>
+skiplist_map<Key, T, Compare, Alloc>::skiplist_map(
+	typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+	Ite last, const key_compare &comp, const allocator_type &alloc) : \
+		_head(__alloc_node(__max_height)), _size(0), _key_cmp(comp), _alloc(alloc)
+{
+	this->insert(first, last);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+skiplist_map<Key, T, Compare, Alloc>::skiplist_map(skiplist_map const &src) : \
+		_head(__alloc_node(__max_height)), _size(0), _key_cmp(src._key_cmp), _alloc(src._alloc)
+{
+	this->insert(src.begin(), src.end());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+skiplist_map<Key, T, Compare, Alloc>::~skiplist_map(void) {
+	this->__destroy_all();
+	byte_allocator().deallocate(reinterpret_cast<char *>(this->_head), __bytes(__max_height));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+skiplist_map<Key, T, Compare, Alloc>&
+skiplist_map<Key, T, Compare, Alloc>::operator=(skiplist_map const &rhs) {
+	if (this == &rhs)
+		return (*this);
+	this->clear();
+	this->_key_cmp = rhs._key_cmp;
+	this->insert(rhs.begin(), rhs.end());
+	return (*this);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::size_type
+skiplist_map<Key, T, Compare, Alloc>::__bytes(int height) {
+	return sizeof(node_type) + (height - 1) * sizeof(node_ptr);
+}
+
+//값은 만들지 않은 채 링크만 비워 둔다. (_head는 값 없이 쓴다)
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::node_ptr
+skiplist_map<Key, T, Compare, Alloc>::__alloc_node(int height)
+{
+	node_ptr n = reinterpret_cast<node_ptr>(byte_allocator().allocate(__bytes(height)));
+
+	n->height = height;
+	n->finished = 0;
+	for (int i = 0; i < height; i++)
+		n->next[i] = NULL;
+	return n;
+}
+
+//epoch가 부른다. 맵이 먼저 사라질 수 있으므로 할당자는 새로 만들어 쓴다.
+template <class Key, class T, class Compare, class Alloc>
+void	skiplist_map<Key, T, Compare, Alloc>::__free_node(void *p)
+{
+	node_ptr n = static_cast<node_ptr>(p);
+
+	Alloc().destroy(&n->val);
+	byte_allocator().deallocate(reinterpret_cast<char *>(n), __bytes(n->height));
+}
+
+//높이 h일 확률이 2^-h. 스레드마다 따로 xorshift를 돌린다.
+template <class Key, class T, class Compare, class Alloc>
+int		skiplist_map<Key, T, Compare, Alloc>::__random_height(void)
+{
+	static __thread unsigned long long seed = 0;
+	int h = 1;
+
+	if (seed == 0)
+		seed = reinterpret_cast<size_t>(&seed) * 0x9E3779B97F4A7C15ULL | 1;
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	for (unsigned long long r = seed; (r & 1) && h < __max_height; r >>= 1)
+		h++;
+	return h;
+}
+
+//층마다 k보다 작은 마지막 노드(preds)와 그다음 노드(succs)를 찾는다.
+//가는 길에 지워진 노드를 만나면 떼어 내고, 떼는 CAS가 실패하면 처음부터 다시 찾는다.
+template <class Key, class T, class Compare, class Alloc>
+bool	skiplist_map<Key, T, Compare, Alloc>::__find(const key_type &k, node_ptr *preds, node_ptr *succs) const
+{
+retry:
+	node_ptr pred = this->_head;
+	node_ptr curr = NULL;
+
+	for (int lv = __max_height - 1; lv >= 0; lv--)
+	{
+		curr = __unmark(__load(pred->next[lv]));
+		while (curr != NULL)
+		{
+			node_ptr succ = __load(curr->next[lv]);
+
+			while (__is_marked(succ))
+			{
+				if (!__sync_bool_compare_and_swap(&pred->next[lv], curr, __unmark(succ)))
+					goto retry;
+				curr = __unmark(succ);
+				if (curr == NULL)
+					break ;
+				succ = __load(curr->next[lv]);
+			}
+			if (curr == NULL || !this->_key_cmp(curr->val.first, k))
+				break ;
+			pred = curr;
+			curr = __unmark(succ);
+		}
+		preds[lv] = pred;
+		succs[lv] = curr;
+	}
+	return curr != NULL && !this->_key_cmp(k, curr->val.first);
+}
+
+//k 이상인 첫 노드. 고치지 않고 지워진 노드를 건너뛰기만 한다.
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::node_ptr
+skiplist_map<Key, T, Compare, Alloc>::__lower(const key_type &k) const
+{
+	node_ptr pred = this->_head;
+	node_ptr curr = NULL;
+
+	for (int lv = __max_height - 1; lv >= 0; lv--)
+	{
+		curr = __unmark(__load(pred->next[lv]));
+		while (curr != NULL)
+		{
+			node_ptr succ = __load(curr->next[lv]);
+
+			if (!__is_marked(succ))
+			{
+				if (!this->_key_cmp(curr->val.first, k))
+					break ;
+				pred = curr;
+			}
+			curr = __unmark(succ);
+		}
+	}
+	return curr;
+}
+
+//넣은 쪽과 지운 쪽 중 나중에 끝난 쪽이 노드를 retire한다.
+//지워진 노드가 아직 어느 층에 걸려 있을 수 있으므로 한 번 더 찾아 떼어 낸 뒤에 올린다.
+template <class Key, class T, class Compare, class Alloc>
+void	skiplist_map<Key, T, Compare, Alloc>::__finish(node_ptr n)
+{
+	node_ptr preds[__max_height];
+	node_ptr succs[__max_height];
+
+	if (__is_marked(__load(n->next[0])))
+		this->__find(n->val.first, preds, succs);
+	if (__sync_fetch_and_add(&n->finished, 1) == 1)
+		ft::epoch::retire(n, &__free_node);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	skiplist_map<Key, T, Compare, Alloc>::__destroy_all(void)
+{
+	node_ptr n = __unmark(this->_head->next[0]);
+
+	while (n != NULL)
+	{
+		node_ptr next = __unmark(n->next[0]);
+		__free_node(n);
+		n = next;
+	}
+	for (int i = 0; i < __max_height; i++)
+		this->_head->next[i] = NULL;
+	this->_size = 0;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::iterator
+skiplist_map<Key, T, Compare, Alloc>::begin(void) {
+	return ++iterator(this->_head);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::const_iterator
+skiplist_map<Key, T, Compare, Alloc>::begin(void) const {
+	return ++const_iterator(this->_head);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::iterator
+skiplist_map<Key, T, Compare, Alloc>::end(void) {
+	return iterator(NULL);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::const_iterator
+skiplist_map<Key, T, Compare, Alloc>::end(void) const {
+	return const_iterator(NULL);
+}
+
+//동시에 바뀌는 중에는 근삿값이다.
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::size_type
+skiplist_map<Key, T, Compare, Alloc>::size(void) const {
+	return static_cast<size_type>(this->_size);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::size_type
+skiplist_map<Key, T, Compare, Alloc>::max_size(void) const {
+	return this->_alloc.max_size();
+}
+
+template <class Key, class T, class Compare, class Alloc>
+bool	skiplist_map<Key, T, Compare, Alloc>::empty(void) const {
+	return (this->size() == 0);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::mapped_type&
+skiplist_map<Key, T, Compare, Alloc>::operator[](const key_type &k) {
+	return (*((this->insert(ft::make_pair(k,mapped_type()))).first)).second;
+}
+
+//0층에 CAS로 걸면 들어간 것이다. 위층은 그 뒤에 하나씩 건다.
+//위층을 거는 동안 노드가 지워지면 거기서 멈춘다.
+template <class Key, class T, class Compare, class Alloc>
+ft::pair<typename skiplist_map<Key, T, Compare, Alloc>::iterator, bool>
+skiplist_map<Key, T, Compare, Alloc>::insert(const value_type &val)
+{
+	ft::epoch_guard guard;
+	node_ptr preds[__max_height];
+	node_ptr succs[__max_height];
+	node_ptr n = NULL;
+	int h = 0;
+
+	for (;;)
+	{
+		if (this->__find(val.first, preds, succs))
+		{
+			if (n != NULL)
+			{
+				this->_alloc.destroy(&n->val);
+				byte_allocator().deallocate(reinterpret_cast<char *>(n), __bytes(h));
+			}
+			return ft::make_pair(iterator(succs[0]), false);
+		}
+		if (n == NULL)
+		{
+			h = __random_height();
+			n = __alloc_node(h);
+			this->_alloc.construct(&n->val, val);
+		}
+		for (int i = 0; i < h; i++)
+			n->next[i] = succs[i];
+		if (__sync_bool_compare_and_swap(&preds[0]->next[0], succs[0], n))
+			break ;
+	}
+	__sync_fetch_and_add(&this->_size, 1);
+	for (int i = 1; i < h; i++)
+	{
+		for (;;)
+		{
+			node_ptr old = __load(n->next[i]);
+
+			if (__is_marked(old))
+				goto done;
+			if (old != succs[i] && !__sync_bool_compare_and_swap(&n->next[i], old, succs[i]))
+				goto done;
+			if (__sync_bool_compare_and_swap(&preds[i]->next[i], succs[i], n))
+				break ;
+			this->__find(val.first, preds, succs);
+			if (succs[0] != n)
+				goto done;
+		}
+	}
+done:
+	this->__finish(n);
+	return ft::make_pair(iterator(n), true);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::iterator
+skiplist_map<Key, T, Compare, Alloc>::insert(iterator position, const value_type &val) {
+	(void)position;
+	return this->insert(val).first;
+}
+
+template <class Key, class T, class Compare, class Alloc> template <class Ite>
+void	skiplist_map<Key, T, Compare, Alloc>::insert(Ite first, Ite last) {
+	ft::epoch_guard guard;
+
+	for (; first != last; ++first)
+		this->insert(*first);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	skiplist_map<Key, T, Compare, Alloc>::erase(iterator position) {
+	this->erase(position->first);
+}
+
+//위층부터 next에 표시를 하고, 0층에 표시를 단 스레드가 지운 것이다.
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::size_type
+skiplist_map<Key, T, Compare, Alloc>::erase(const key_type &k)
+{
+	ft::epoch_guard guard;
+	node_ptr preds[__max_height];
+	node_ptr succs[__max_height];
+	node_ptr victim;
+
+	if (!this->__find(k, preds, succs))
+		return 0;
+	victim = succs[0];
+	for (int i = victim->height - 1; i >= 1; i--)
+	{
+		node_ptr succ = __load(victim->next[i]);
+
+		while (!__is_marked(succ) && !__sync_bool_compare_and_swap(&victim->next[i], succ, __mark(succ)))
+			succ = __load(victim->next[i]);
+	}
+	for (;;)
+	{
+		node_ptr succ = __load(victim->next[0]);
+
+		if (__is_marked(succ))
+			return 0;
+		if (__sync_bool_compare_and_swap(&victim->next[0], succ, __mark(succ)))
+			break ;
+	}
+	__sync_fetch_and_sub(&this->_size, 1);
+	this->__finish(victim);
+	return 1;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	skiplist_map<Key, T, Compare, Alloc>::erase(iterator first, iterator last)
+{
+	ft::epoch_guard guard;
+	ft::vector<key_type> keys;
+
+	for (; first != last; ++first)
+		keys.push_back(first->first);
+	for (size_type i = 0; i < keys.size(); i++)
+		this->erase(keys[i]);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	skiplist_map<Key, T, Compare, Alloc>::swap(skiplist_map &x) {
+	std::swap(this->_head, x._head);
+	std::swap(this->_key_cmp, x._key_cmp);
+	std::swap(this->_alloc, x._alloc);
+	long tmp = this->_size;
+	this->_size = x._size;
+	x._size = tmp;
+}
+
+//하나씩 지우므로 다른 스레드와 함께 불러도 된다. 도중에 들어온 키는 남을 수 있다.
+template <class Key, class T, class Compare, class Alloc>
+void	skiplist_map<Key, T, Compare, Alloc>::clear(void)
+{
+	ft::epoch_guard guard;
+	iterator it = this->begin();
+
+	while (it != this->end())
+	{
+		key_type k = it->first;
+		++it;
+		this->erase(k);
+	}
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::key_compare
+skiplist_map<Key, T, Compare, Alloc>::key_comp(void) const {
+	return this->_key_cmp;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::value_compare
+skiplist_map<Key, T, Compare, Alloc>::value_comp(void) const {
+	return value_compare(this->_key_cmp);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::iterator
+skiplist_map<Key, T, Compare, Alloc>::find(const key_type &k) {
+	ft::epoch_guard guard;
+	node_ptr n = this->__lower(k);
+
+	if (n == NULL || this->_key_cmp(k, n->val.first))
+		return this->end();
+	return iterator(n);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::const_iterator
+skiplist_map<Key, T, Compare, Alloc>::find(const key_type &k) const {
+	ft::epoch_guard guard;
+	node_ptr n = this->__lower(k);
+
+	if (n == NULL || this->_key_cmp(k, n->val.first))
+		return this->end();
+	return const_iterator(n);
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::size_type
+skiplist_map<Key, T, Compare, Alloc>::count(const key_type &k) const {
+	return (this->find(k) != this->end());
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::iterator
+skiplist_map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) {
+	ft::epoch_guard guard;
+	return iterator(this->__lower(k));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::const_iterator
+skiplist_map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) const {
+	ft::epoch_guard guard;
+	return const_iterator(this->__lower(k));
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::iterator
+skiplist_map<Key, T, Compare, Alloc>::upper_bound(const key_type &k) {
+	ft::epoch_guard guard;
+	iterator it(this->__lower(k));
+
+	if (it != this->end() && !this->_key_cmp(k, it->first))
+		++it;
+	return it;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::const_iterator
+skiplist_map<Key, T, Compare, Alloc>::upper_bound(const key_type &k) const {
+	ft::epoch_guard guard;
+	const_iterator it(this->__lower(k));
+
+	if (it != this->end() && !this->_key_cmp(k, it->first))
+		++it;
+	return it;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+typename skiplist_map<Key, T, Compare, Alloc>::allocator_type
+skiplist_map<Key, T, Compare, Alloc>::get_allocator(void) const {
+	return this->_alloc;
+}
+
+template <class Key, class T, class Compare, class Alloc>
+void	swap(skiplist_map<Key, T, Compare, Alloc> &x, skiplist_map<Key, T, Compare, Alloc> &y) {
+	x.swap(y);
+}
+
+}
+
+#endif
@@ -0,0 +1,155 @@
+#include <map>
+#include <set>
+#include <pthread.h>
+#include <stdlib.h>
+#include "skiplist_map.hpp"
+#include "tester.hpp"
+
+typedef ft::skiplist_map<int, int>	map_t;
+
+static map_t		g_map;
+static const int	g_threads = 4;
+static const int	g_range = 4000;
+static const int	g_ops = 60000;
+static volatile int	g_writers_done = 0;
+static int			g_bad = 0;
+
+//값은 항상 키의 세 배라서, 다른 스레드가 읽은 값이 찢어졌는지 바로 알 수 있다.
+struct writer_job
+{
+	int				id;
+	std::set<int>	own;
+};
+
+//키 k % g_threads == id인 키만 넣고 지우므로, 끝난 뒤 맵에 남아 있어야 할 키를 스레드가 안다.
+//남의 키는 찾기만 한다.
+static void *
+writer(void *arg)
+{
+	writer_job *j = static_cast<writer_job *>(arg);
+	unsigned int seed = j->id + 1;
+	int bad = 0;
+
+	for (int i = 0; i < g_ops; i++)
+	{
+		int k = static_cast<int>(rand_r(&seed) % (g_range / g_threads)) * g_threads + j->id;
+		switch (rand_r(&seed) % 4)
+		{
+		case 0:
+			if (g_map.erase(k) != j->own.erase(k))
+				++bad;
+			break;
+		case 1:
+			if (g_map.insert(ft::make_pair(k, k * 3)).second != j->own.insert(k).second)
+				++bad;
+			break;
+		case 2:
+			if (g_map.count(k) != j->own.count(k))
+				++bad;
+			break;
+		default:
+		{
+			ft::epoch_guard guard;
+			int other = static_cast<int>(rand_r(&seed) % g_range);
+			map_t::iterator it = g_map.find(other);
+			if (it != g_map.end() && (it->first != other || it->second != other * 3))
+				++bad;
+		}
+		}
+	}
+	__sync_fetch_and_add(&g_bad, bad);
+	__sync_fetch_and_add(&g_writers_done, 1);
+	return NULL;
+}
+
+//쓰는 스레드들이 도는 동안 계속 처음부터 끝까지 훑는다. 순서가 어긋나거나 값이 틀리면 안 된다.
+static void *
+scanner(void *)
+{
+	int bad = 0;
+
+	while (__sync_fetch_and_add(&g_writers_done, 0) < g_threads)
+	{
+		ft::epoch_guard guard;
+		int prev = -1;
+		for (map_t::iterator it = g_map.begin(); it != g_map.end(); ++it)
+		{
+			if (it->first <= prev || it->second != it->first * 3)
+				++bad;
+			prev = it->first;
+		}
+		map_t::iterator lb = g_map.lower_bound(g_range / 2);
+		if (lb != g_map.end() && lb->first < g_range / 2)
+			++bad;
+	}
+	__sync_fetch_and_add(&g_bad, bad);
+	return NULL;
+}
+
+int main(void)
+{
+	srand(29);
+	//한 스레드에서는 ft::map과 같게 동작한다.
+	{
+		map_t m;
+		std::map<int, int> ref;
+		for (int i = 0; i < 50000; i++)
+		{
+			int k = rand() % 5000;
+			switch (rand() % 4)
+			{
+			case 0:
+				FT_CHECK(m.erase(k) == ref.erase(k));
+				break;
+			case 1:
+				FT_CHECK(m.insert(ft::make_pair(k, i)).second == ref.insert(std::make_pair(k, i)).second);
+				break;
+			case 2:
+				m[k] = i;
+				ref[k] = i;
+				break;
+			default:
+				FT_CHECK(m.count(k) == ref.count(k));
+			}
+		}
+		FT_CHECK(m.size() == ref.size());
+		bool same = true;
+		std::map<int, int>::iterator r = ref.begin();
+		for (map_t::iterator it = m.begin(); it != m.end(); ++it, ++r)
+			same = same && it->first == r->first && it->second == r->second;
+		FT_CHECK(same && r == ref.end());
+		FT_CHECK(m.lower_bound(2500)->first == ref.lower_bound(2500)->first);
+		FT_CHECK(m.upper_bound(2500)->first == ref.upper_bound(2500)->first);
+		map_t copy(m);
+		m.erase(m.begin(), m.lower_bound(2500));
+		FT_CHECK(copy.size() == ref.size() && m.begin()->first >= 2500);
+		m.clear();
+		FT_CHECK(m.empty() && m.begin() == m.end());
+	}
+
+	pthread_t th[g_threads + 1];
+	writer_job jobs[g_threads];
+	for (int t = 0; t < g_threads; t++)
+	{
+		jobs[t].id = t;
+		pthread_create(&th[t], NULL, writer, &jobs[t]);
+	}
+	pthread_create(&th[g_threads], NULL, scanner, NULL);
+	for (int t = 0; t <= g_threads; t++)
+		pthread_join(th[t], NULL);
+	FT_CHECK(g_bad == 0);
+
+	//끝난 뒤에는 각 스레드가 남겼다고 아는 키와 정확히 같다.
+	std::set<int> expect;
+	for (int t = 0; t < g_threads; t++)
+		expect.insert(jobs[t].own.begin(), jobs[t].own.end());
+	FT_CHECK(g_map.size() == expect.size());
+	bool same = true;
+	std::set<int>::iterator e = expect.begin();
+	for (map_t::iterator it = g_map.begin(); it != g_map.end(); ++it, ++e)
+		same = same && e != expect.end() && it->first == *e && it->second == *e * 3;
+	FT_CHECK(same && e == expect.end());
+	g_map.clear();
+	ft::epoch::synchronize();
+	return ft_test::result("skiplist_map");
+}
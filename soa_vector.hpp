@@ -0,0 +1,468 @@
+#ifndef SOA_VECTOR_CLASS_HPP
+# define SOA_VECTOR_CLASS_HPP
+
+# include <stdexcept>
+# include "utils.hpp"
+
+namespace ft
+{
+//사용하지 않는 칸. 이 칸은 메모리를 잡지 않는다.
+struct soa_nil {};
+
+//soa_vector에 한 줄(row)을 넣고 뺄 때 쓰는 값 타입.
+template <class T0, class T1, class T2 = soa_nil, class T3 = soa_nil>
+struct soa_row
+{
+	T0	f0;
+	T1	f1;
+	T2	f2;
+	T3	f3;
+
+	soa_row(void) : f0(), f1(), f2(), f3() {}
+	soa_row(const T0 &a, const T1 &b, const T2 &c = T2(), const T3 &d = T3())
+	: f0(a), f1(b), f2(c), f3(d) {}
+};
+
+//I번째 칸의 타입.
+template <int I, class T0, class T1, class T2, class T3>
+struct soa_element;
+
+template <class T0, class T1, class T2, class T3>
+struct soa_element<0, T0, T1, T2, T3> { typedef T0 type; };
+
+template <class T0, class T1, class T2, class T3>
+struct soa_element<1, T0, T1, T2, T3> { typedef T1 type; };
+
+template <class T0, class T1, class T2, class T3>
+struct soa_element<2, T0, T1, T2, T3> { typedef T2 type; };
+
+template <class T0, class T1, class T2, class T3>
+struct soa_element<3, T0, T1, T2, T3> { typedef T3 type; };
+
+template <int I>
+struct __soa_index {};
+
+//칸 하나. 모든 칸은 size와 capacity를 공유하므로 여기서는 배열만 관리한다.
+template <class T, class Alloc>
+class __soa_column
+{
+private:
+	typedef typename Alloc::template rebind<T>::other	allocator_type;
+
+	T				*_data;
+	allocator_type	_alloc;
+
+public:
+	__soa_column(void) : _data(NULL) {}
+
+	T*
+	data(void) const
+	{ return _data; }
+
+	void
+	construct(size_t i, const T &val)
+	{ _alloc.construct(_data + i, val); }
+
+	void
+	destroy(size_t i)
+	{ _alloc.destroy(_data + i); }
+
+	//새 배열에 앞의 size개를 복사해서 돌려준다. 복사하다 던지면 만든 것을 지우고 다시 던진다. 지금 배열은 그대로다.
+	T*
+	prepare(size_t new_capacity, size_t size)
+	{
+		T *new_data = _alloc.allocate(new_capacity);
+		size_t i = 0;
+
+		try
+		{
+			for (; i < size; i++)
+				_alloc.construct(new_data + i, _data[i]);
+		}
+		catch (...)
+		{
+			this->discard(new_data, i, new_capacity);
+			throw;
+		}
+		return new_data;
+	}
+
+	//prepare로 만든 배열을 쓰지 않고 버린다.
+	void
+	discard(T *buf, size_t size, size_t capacity)
+	{
+		for (size_t i = 0; i < size; i++)
+			_alloc.destroy(buf + i);
+		_alloc.deallocate(buf, capacity);
+	}
+
+	//지금 배열을 해제하고 prepare로 만든 배열로 바꾼다. 던지지 않는다.
+	void
+	adopt(T *new_data, size_t size, size_t old_capacity)
+	{
+		this->release(size, old_capacity);
+		_data = new_data;
+	}
+
+	void
+	release(size_t size, size_t capacity)
+	{
+		for (size_t i = 0; i < size; i++)
+			_alloc.destroy(_data + i);
+		if (capacity != 0)
+			_alloc.deallocate(_data, capacity);
+		_data = NULL;
+	}
+
+	void
+	swap(__soa_column &x)
+	{ std::swap(_data, x._data); }
+};
+
+template <class Alloc>
+class __soa_column<soa_nil, Alloc>
+{
+public:
+	soa_nil*	data(void) const { return NULL; }
+	void		construct(size_t, const soa_nil &) {}
+	void		destroy(size_t) {}
+	soa_nil*	prepare(size_t, size_t) { return NULL; }
+	void		discard(soa_nil *, size_t, size_t) {}
+	void		adopt(soa_nil *, size_t, size_t) {}
+	void		release(size_t, size_t) {}
+	void		swap(__soa_column &) {}
+};
+
+//구조체 배열(AoS) 대신 필드마다 따로 연속된 배열(SoA)에 저장하는 벡터.
+//필드 하나만 훑는 루프는 column<I>()로 그 필드의 배열만 읽으면 되고, 그대로 벡터화된다.
+//칸은 최대 4개까지이고 남는 칸은 soa_nil로 둔다.
+template <class T0, class T1, class T2 = soa_nil, class T3 = soa_nil, class Alloc = std::allocator<char> >
+class soa_vector
+{
+public:
+	typedef soa_row<T0, T1, T2, T3>		value_type;
+	typedef size_t						size_type;
+	typedef ptrdiff_t					difference_type;
+
+	//한 줄을 가리키는 프록시. 실제 값은 칸마다 흩어져 있다.
+	class reference
+	{
+	private:
+		soa_vector	*_v;
+		size_type	_i;
+
+	public:
+		reference(soa_vector *v_, size_type i_) : _v(v_), _i(i_) {}
+
+		template <int I>
+		typename soa_element<I, T0, T1, T2, T3>::type&
+		get(void) const
+		{ return _v->template column<I>()[_i]; }
+
+		operator value_type(void) const
+		{ return _v->__load(_i); }
+
+		reference&
+		operator=(const value_type &val)
+		{
+			_v->__store(_i, val);
+			return *this;
+		}
+
+		reference&
+		operator=(const reference &rhs)
+		{
+			_v->__store(_i, rhs._v->__load(rhs._i));
+			return *this;
+		}
+	};
+
+	class const_reference
+	{
+	private:
+		const soa_vector	*_v;
+		size_type			_i;
+
+	public:
+		const_reference(const soa_vector *v_, size_type i_) : _v(v_), _i(i_) {}
+
+		template <int I>
+		const typename soa_element<I, T0, T1, T2, T3>::type&
+		get(void) const
+		{ return _v->template column<I>()[_i]; }
+
+		operator value_type(void) const
+		{ return _v->__load(_i); }
+	};
+
+private:
+	size_type				_size;
+	size_type				_capacity;
+	__soa_column<T0, Alloc>	_c0;
+	__soa_column<T1, Alloc>	_c1;
+	__soa_column<T2, Alloc>	_c2;
+	__soa_column<T3, Alloc>	_c3;
+
+public:
+	soa_vector(void) : _size(0), _capacity(0) {}
+
+	soa_vector(const soa_vector &src) : _size(0), _capacity(0)
+	{
+		try
+		{
+			this->reserve(src._size);
+			for (size_type i = 0; i < src._size; i++)
+				this->push_back(src.__load(i));
+		}
+		catch (...)
+		{
+			this->__release();
+			throw;
+		}
+	}
+
+	//복사본을 다 만든 뒤 바꾸므로 복사가 던져도 원래 내용이 남는다.
+	soa_vector &
+	operator=(const soa_vector &rhs)
+	{
+		if (this == &rhs)
+			return *this;
+		soa_vector tmp(rhs);
+
+		this->swap(tmp);
+		return *this;
+	}
+
+	virtual ~soa_vector()
+	{ this->__release(); }
+
+	size_type
+	size(void) const
+	{ return _size; }
+
+	size_type
+	capacity(void) const
+	{ return _capacity; }
+
+	bool
+	empty(void) const
+	{ return _size == 0; }
+
+	//모든 칸을 새 배열에 복사한 뒤에야 옛 배열을 놓는다. 복사가 던지면 원래 상태 그대로다.
+	void
+	reserve(size_type n)
+	{
+		if (n <= _capacity)
+			return ;
+		T0 *n0 = NULL;
+		T1 *n1 = NULL;
+		T2 *n2 = NULL;
+		T3 *n3 = NULL;
+		int done = 0;
+
+		try
+		{
+			n0 = _c0.prepare(n, _size);
+			done = 1;
+			n1 = _c1.prepare(n, _size);
+			done = 2;
+			n2 = _c2.prepare(n, _size);
+			done = 3;
+			n3 = _c3.prepare(n, _size);
+		}
+		catch (...)
+		{
+			if (done > 2)
+				_c2.discard(n2, _size, n);
+			if (done > 1)
+				_c1.discard(n1, _size, n);
+			if (done > 0)
+				_c0.discard(n0, _size, n);
+			throw;
+		}
+		_c0.adopt(n0, _size, _capacity);
+		_c1.adopt(n1, _size, _capacity);
+		_c2.adopt(n2, _size, _capacity);
+		_c3.adopt(n3, _size, _capacity);
+		_capacity = n;
+	}
+
+	//한 칸이라도 복사가 던지면 이미 넣은 칸을 되돌린다.
+	void
+	push_back(const value_type &val)
+	{
+		if (_size == _capacity)
+			this->reserve(_capacity == 0 ? 1 : _capacity * 2);
+		int done = 0;
+
+		try
+		{
+			_c0.construct(_size, val.f0);
+			done = 1;
+			_c1.construct(_size, val.f1);
+			done = 2;
+			_c2.construct(_size, val.f2);
+			done = 3;
+			_c3.construct(_size, val.f3);
+		}
+		catch (...)
+		{
+			if (done > 2)
+				_c2.destroy(_size);
+			if (done > 1)
+				_c1.destroy(_size);
+			if (done > 0)
+				_c0.destroy(_size);
+			throw;
+		}
+		++_size;
+	}
+
+	void
+	push_back(const T0 &a, const T1 &b, const T2 &c = T2(), const T3 &d = T3())
+	{
+		this->push_back(value_type(a, b, c, d));
+	}
+
+	void
+	pop_back(void)
+	{
+		--_size;
+		_c0.destroy(_size);
+		_c1.destroy(_size);
+		_c2.destroy(_size);
+		_c3.destroy(_size);
+	}
+
+	void
+	clear(void)
+	{
+		while (_size != 0)
+			this->pop_back();
+	}
+
+	void
+	swap(soa_vector &x)
+	{
+		std::swap(_size, x._size);
+		std::swap(_capacity, x._capacity);
+		_c0.swap(x._c0);
+		_c1.swap(x._c1);
+		_c2.swap(x._c2);
+		_c3.swap(x._c3);
+	}
+
+	reference
+	operator[](size_type i)
+	{ return reference(this, i); }
+
+	const_reference
+	operator[](size_type i) const
+	{ return const_reference(this, i); }
+
+	reference
+	at(size_type i)
+	{
+		if (i >= _size)
+			throw std::out_of_range("soa_vector");
+		return reference(this, i);
+	}
+
+	const_reference
+	at(size_type i) const
+	{
+		if (i >= _size)
+			throw std::out_of_range("soa_vector");
+		return const_reference(this, i);
+	}
+
+	reference
+	back(void)
+	{ return reference(this, _size - 1); }
+
+	const_reference
+	back(void) const
+	{ return const_reference(this, _size - 1); }
+
+	//I번째 칸의 연속된 배열. [column<I>(), column<I>() + size())를 그대로 순회하면 된다.
+	template <int I>
+	typename soa_element<I, T0, T1, T2, T3>::type*
+	column(void)
+	{ return this->__column(__soa_index<I>()); }
+
+	template <int I>
+	const typename soa_element<I, T0, T1, T2, T3>::type*
+	column(void) const
+	{ return const_cast<soa_vector *>(this)->__column(__soa_index<I>()); }
+
+	template <int I>
+	typename soa_element<I, T0, T1, T2, T3>::type*
+	column_begin(void)
+	{ return this->template column<I>(); }
+
+	template <int I>
+	typename soa_element<I, T0, T1, T2, T3>::type*
+	column_end(void)
+	{ return this->template column<I>() + _size; }
+
+	template <int I>
+	const typename soa_element<I, T0, T1, T2, T3>::type*
+	column_begin(void) const
+	{ return this->template column<I>(); }
+
+	template <int I>
+	const typename soa_element<I, T0, T1, T2, T3>::type*
+	column_end(void) const
+	{ return this->template column<I>() + _size; }
+
+private:
+	void
+	__release(void)
+	{
+		_c0.release(_size, _capacity);
+		_c1.release(_size, _capacity);
+		_c2.release(_size, _capacity);
+		_c3.release(_size, _capacity);
+		_size = 0;
+		_capacity = 0;
+	}
+
+	T0*	__column(__soa_index<0>) { return _c0.data(); }
+	T1*	__column(__soa_index<1>) { return _c1.data(); }
+	T2*	__column(__soa_index<2>) { return _c2.data(); }
+	T3*	__column(__soa_index<3>) { return _c3.data(); }
+
+	value_type
+	__load(size_type i) const
+	{
+		soa_vector *self = const_cast<soa_vector *>(this);
+		value_type val;
+
+		if (!ft::is_same<T0, soa_nil>::value)
+			val.f0 = self->_c0.data()[i];
+		if (!ft::is_same<T1, soa_nil>::value)
+			val.f1 = self->_c1.data()[i];
+		if (!ft::is_same<T2, soa_nil>::value)
+			val.f2 = self->_c2.data()[i];
+		if (!ft::is_same<T3, soa_nil>::value)
+			val.f3 = self->_c3.data()[i];
+		return val;
+	}
+
+	void
+	__store(size_type i, const value_type &val)
+	{
+		if (!ft::is_same<T0, soa_nil>::value)
+			_c0.data()[i] = val.f0;
+		if (!ft::is_same<T1, soa_nil>::value)
+			_c1.data()[i] = val.f1;
+		if (!ft::is_same<T2, soa_nil>::value)
+			_c2.data()[i] = val.f2;
+		if (!ft::is_same<T3, soa_nil>::value)
+			_c3.data()[i] = val.f3;
+	}
+};
+
+}
+
+#endif
@@ -0,0 +1,113 @@
+#include <string>
+#include <stdexcept>
+#include "soa_vector.hpp"
+#include "tester.hpp"
+
+//복사가 정해진 횟수 뒤에 던지는 값. 살아 있는 개수를 세서 새는 것이 없는지 본다.
+struct Fragile
+{
+	static int	live;
+	static int	copies_left;
+	int			v;
+
+	Fragile(int v_ = 0) : v(v_) { ++live; }
+	Fragile(const Fragile &src) : v(src.v)
+	{
+		if (copies_left == 0)
+			throw std::runtime_error("copy");
+		if (copies_left > 0)
+			--copies_left;
+		++live;
+	}
+	Fragile &operator=(const Fragile &rhs) { v = rhs.v; return *this; }
+	~Fragile() { --live; }
+};
+
+int	Fragile::live = 0;
+int	Fragile::copies_left = -1;
+
+typedef ft::soa_vector<int, std::string, double>	rows_t;
+typedef ft::soa_vector<int, Fragile>				fragile_t;
+
+int main(void)
+{
+	rows_t v;
+
+	for (int i = 0; i < 1000; i++)
+		v.push_back(i, std::string(i % 7, 'x'), i * 0.5);
+	FT_CHECK(v.size() == 1000 && v.capacity() >= 1000);
+
+	//칸마다 연속된 배열.
+	long sum = 0;
+	for (const int *p = v.column_begin<0>(); p != v.column_end<0>(); ++p)
+		sum += *p;
+	FT_CHECK(sum == 999 * 1000 / 2);
+	FT_CHECK(v.column<2>()[10] == 5.0);
+	FT_CHECK(v.column<1>()[13] == "xxxxxx");
+
+	//줄 프록시로 읽고 쓴다.
+	v[3].get<0>() = 42;
+	FT_CHECK(v.column<0>()[3] == 42);
+	rows_t::value_type row = v[5];
+	FT_CHECK(row.f0 == 5 && row.f1 == "xxxxx" && row.f2 == 2.5);
+	v[6] = rows_t::value_type(-1, "row", 1.25);
+	FT_CHECK(v[6].get<0>() == -1 && v[6].get<1>() == "row" && v[6].get<2>() == 1.25);
+	v[7] = v[6];
+	FT_CHECK(v[7].get<1>() == "row");
+
+	bool thrown = false;
+	try { v.at(1000); } catch (const std::out_of_range &) { thrown = true; }
+	FT_CHECK(thrown);
+
+	rows_t copy(v);
+	rows_t assigned;
+	assigned = copy;
+	FT_CHECK(assigned.size() == 1000 && assigned[999].get<0>() == 999 && assigned.column<1>()[6] == "row");
+	v.pop_back();
+	FT_CHECK(v.size() == 999 && copy.size() == 1000);
+	copy.swap(v);
+	FT_CHECK(v.size() == 1000 && copy.size() == 999);
+	v.clear();
+	FT_CHECK(v.empty() && v.capacity() >= 1000);
+
+	//reserve 중에 복사가 던지면 내용과 용량이 그대로다.
+	{
+		fragile_t f;
+		for (int i = 0; i < 10; i++)
+			f.push_back(i, Fragile(i));
+		size_t cap = f.capacity();
+		int live = Fragile::live;
+
+		Fragile::copies_left = 5;
+		thrown = false;
+		try { f.reserve(100); } catch (const std::runtime_error &) { thrown = true; }
+		Fragile::copies_left = -1;
+		FT_CHECK(thrown);
+		FT_CHECK(f.size() == 10 && f.capacity() == cap && Fragile::live == live);
+		bool intact = true;
+		for (int i = 0; i < 10; i++)
+			intact = intact && f.column<0>()[i] == i && f.column<1>()[i].v == i;
+		FT_CHECK(intact);
+
+		//push_back에서 두 번째 칸이 던지면 첫 칸도 되돌린다.
+		f.reserve(100);
+		Fragile tmp(77);
+		live = Fragile::live;
+		Fragile::copies_left = 0;
+		thrown = false;
+		try { f.push_back(fragile_t::value_type(77, tmp)); } catch (const std::runtime_error &) { thrown = true; }
+		Fragile::copies_left = -1;
+		FT_CHECK(thrown && f.size() == 10 && Fragile::live == live);
+
+		//복사 생성과 대입이 중간에 던져도 새는 것이 없고, 대입 대상은 그대로다.
+		fragile_t g;
+		g.push_back(1, Fragile(1));
+		Fragile::copies_left = 3;
+		thrown = false;
+		try { g = f; } catch (const std::runtime_error &) { thrown = true; }
+		Fragile::copies_left = -1;
+		FT_CHECK(thrown && g.size() == 1 && g.column<1>()[0].v == 1);
+	}
+	FT_CHECK(Fragile::live == 0);
+	return ft_test::result("soa_vector");
+}
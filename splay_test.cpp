@@ -0,0 +1,157 @@
+#include <map>
+#include <set>
+#include <pthread.h>
+#include <stdlib.h>
+#include "map.hpp"
+#include "set.hpp"
+#include "tester.hpp"
+
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::__no_monoid, ft::splay_balance>	map_t;
+typedef ft::set<int, std::less<int>, std::allocator<int>, ft::splay_balance>	set_t;
+
+static const map_t	*g_shared;
+static int			g_miscount;
+
+//const 조회는 끌어올리지 않으므로 여러 스레드가 함께 읽어도 된다. (TSan으로 돌리면 경쟁이 없어야 한다)
+static void *
+reader(void *arg)
+{
+	long seed = reinterpret_cast<long>(arg);
+	int bad = 0;
+
+	for (int i = 0; i < 20000; i++)
+	{
+		int k = static_cast<int>((seed * 7919 + i * 104729L) % 20000);
+		map_t::const_iterator it = g_shared->find(k);
+		if (g_shared->count(k) != static_cast<size_t>(k % 2 == 0) || (k % 2 == 0 && it->second != k))
+			++bad;
+	}
+	__sync_fetch_and_add(&g_miscount, bad);
+	return NULL;
+}
+
+static bool
+same(const map_t &m, const std::map<int, int> &ref)
+{
+	if (m.size() != ref.size())
+		return false;
+	std::map<int, int>::const_iterator r = ref.begin();
+	for (map_t::const_iterator it = m.begin(); it != m.end(); ++it, ++r)
+		if (it->first != r->first || it->second != r->second)
+			return false;
+	std::map<int, int>::const_reverse_iterator rr = ref.rbegin();
+	for (map_t::const_reverse_iterator it = m.rbegin(); it != m.rend(); ++it, ++rr)
+		if (it->first != rr->first)
+			return false;
+	return true;
+}
+
+int main(void)
+{
+	srand(46);
+	{
+		map_t m;
+		std::map<int, int> ref;
+		const map_t &cm = m;
+		bool ok = true;
+
+		//치우친 조회를 섞는다. 찾기가 트리를 바꿔도 보이는 결과는 ft::map과 같아야 한다.
+		for (int i = 0; i < 40000; i++)
+		{
+			int k = rand() % 8 ? rand() % 50 : rand() % 5000;
+			switch (rand() % 6)
+			{
+			case 0:
+				ok = ok && m.erase(k) == ref.erase(k);
+				break;
+			case 1:
+				ok = ok && m.insert(ft::make_pair(k, i)).second == ref.insert(std::make_pair(k, i)).second;
+				break;
+			case 2:
+				ok = ok && cm.count(k) == ref.count(k)
+					&& (ref.count(k) == 0 ? cm.find(k) == cm.end() : cm.find(k)->second == ref[k]);
+				break;
+			case 3:
+			{
+				std::map<int, int>::iterator rlb = ref.lower_bound(k);
+				std::map<int, int>::iterator rub = ref.upper_bound(k);
+				ok = ok && (rlb == ref.end() ? m.lower_bound(k) == m.end() : m.lower_bound(k)->first == rlb->first);
+				ok = ok && (rub == ref.end() ? cm.upper_bound(k) == cm.end() : cm.upper_bound(k)->first == rub->first);
+				break;
+			}
+			default:
+				m[k] = i;
+				ref[k] = i;
+			}
+		}
+		FT_CHECK(ok && same(m, ref));
+
+		//찾기가 노드를 돌려도 값은 옮기지 않으므로 들고 있던 반복자는 그대로 쓸 수 있다.
+		map_t::iterator held = m.find(ref.begin()->first);
+		std::map<int, int>::iterator rheld = ref.begin();
+		for (int i = 0; i < 1000; i++)
+			m.find(rand() % 5000);
+		FT_CHECK(held->first == rheld->first && (++held)->first == (++rheld)->first);
+		m.erase(held);
+		ref.erase(rheld);
+		FT_CHECK(same(m, ref));
+
+		map_t copy(m);
+		map_t assigned;
+		assigned = m;
+		FT_CHECK(same(copy, ref) && same(assigned, ref) && copy == m);
+		m.erase(m.lower_bound(25), m.end());
+		ref.erase(ref.lower_bound(25), ref.end());
+		FT_CHECK(same(m, ref));
+	}
+
+	//차례로 넣으면 한쪽으로만 긴 사슬이 된다. 찾기, 복사, 지우기가 재귀 없이 끝나야 한다.
+	{
+		const int n = 200000;
+		set_t s;
+		for (int i = 0; i < n; i++)
+			s.insert(i);
+		FT_CHECK(s.size() == static_cast<size_t>(n) && s.count(0) == 1 && *s.find(n / 2) == n / 2);
+		set_t copy(s);
+		FT_CHECK(copy.size() == s.size() && *copy.begin() == 0 && *copy.rbegin() == n - 1);
+		bool ordered = true;
+		int prev = -1;
+		for (set_t::iterator it = copy.begin(); it != copy.end(); ++it)
+		{
+			ordered = ordered && *it == prev + 1;
+			prev = *it;
+		}
+		FT_CHECK(ordered && prev == n - 1);
+		s.erase(s.begin(), s.lower_bound(n - 10));
+		FT_CHECK(s.size() == 10 && *s.begin() == n - 10);
+		copy.clear();
+		FT_CHECK(copy.empty());
+
+		s.clear();
+		std::set<int> ref;
+		bool ok = true;
+		for (int i = 0; i < 20000; i++)
+		{
+			int k = rand() % 3000;
+			if (rand() % 3 == 0)
+				ok = ok && s.erase(k) == ref.erase(k);
+			else
+				ok = ok && s.insert(k).second == ref.insert(k).second;
+		}
+		FT_CHECK(ok && s.size() == ref.size() && ft::equal(s.begin(), s.end(), ref.begin()));
+	}
+
+	{
+		map_t shared;
+		for (int i = 0; i < 20000; i += 2)
+			shared[i] = i;
+		g_shared = &shared;
+		pthread_t th[4];
+		for (long t = 0; t < 4; t++)
+			pthread_create(&th[t], NULL, reader, reinterpret_cast<void *>(t));
+		for (int t = 0; t < 4; t++)
+			pthread_join(th[t], NULL);
+		FT_CHECK(g_miscount == 0);
+	}
+	return ft_test::result("splay");
+}
@@ -0,0 +1,36 @@
+#ifndef TESTER_HPP
+# define TESTER_HPP
+
+# include <iostream>
+
+//*_test.cpp가 함께 쓰는 검사. 실패하면 위치와 식을 찍고 개수를 센다.
+namespace ft_test
+{
+inline int &
+failures(void)
+{
+	static int n = 0;
+	return n;
+}
+
+inline void
+check(bool ok, const char *expr, const char *file, int line)
+{
+	if (ok)
+		return ;
+	++failures();
+	std::cerr << file << ":" << line << ": KO: " << expr << std::endl;
+}
+
+//main의 마지막에 부른다. 실패가 있으면 1.
+inline int
+result(const char *name)
+{
+	std::cout << name << ": " << (failures() == 0 ? "OK" : "KO") << std::endl;
+	return failures() != 0;
+}
+}
+
+# define FT_CHECK(expr) ft_test::check((expr), #expr, __FILE__, __LINE__)
+
+#endif
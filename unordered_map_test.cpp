@@ -0,0 +1,177 @@
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <stdlib.h>
+#include "unordered_map.hpp"
+#include "unordered_set.hpp"
+#include "tester.hpp"
+
+//해시가 곧 키라서 같은 그룹에 몰리고, 테이블이 꽉 차는 경우를 만들기 쉽다.
+struct Id
+{
+	size_t	operator()(int x) const { return static_cast<size_t>(x); }
+};
+
+//상태가 있는 할당자. 기본 생성된 것을 쓰면 count가 없어서 바로 드러난다.
+template <class T>
+struct Counted : public std::allocator<T>
+{
+	long	*count;
+
+	template <class U>
+	struct rebind { typedef Counted<U> other; };
+
+	Counted(void) : count(0) {}
+	explicit Counted(long *c) : count(c) {}
+	template <class U>
+	Counted(const Counted<U> &src) : std::allocator<T>(src), count(src.count) {}
+
+	T *
+	allocate(size_t n, const void * = 0)
+	{
+		*count += n * sizeof(T);
+		return std::allocator<T>::allocate(n);
+	}
+
+	void
+	deallocate(T *p, size_t n)
+	{
+		*count -= n * sizeof(T);
+		std::allocator<T>::deallocate(p, n);
+	}
+};
+
+template <class M>
+static bool
+same(const M &m, const std::map<int, int> &ref)
+{
+	if (m.size() != ref.size())
+		return false;
+	for (std::map<int, int>::const_iterator it = ref.begin(); it != ref.end(); ++it)
+	{
+		typename M::const_iterator found = m.find(it->first);
+		if (found == m.end() || found->second != it->second)
+			return false;
+	}
+	size_t n = 0;
+	for (typename M::const_iterator it = m.begin(); it != m.end(); ++it)
+		++n;
+	return n == ref.size();
+}
+
+int main(void)
+{
+	srand(3);
+	ft::unordered_map<int, int> m;
+	std::map<int, int> ref;
+
+	//옮기는 중에도 찾기, 지우기, 덮어쓰기가 맞는지 임의 순서로 본다.
+	for (int i = 0; i < 200000; i++)
+	{
+		int k = rand() % 20000;
+		int op = rand() % 4;
+		if (op == 0)
+		{
+			FT_CHECK(m.erase(k) == ref.erase(k));
+		}
+		else if (op == 1)
+			FT_CHECK(m.count(k) == ref.count(k));
+		else
+		{
+			m[k] = i;
+			ref[k] = i;
+		}
+	}
+	FT_CHECK(same(m, ref));
+	FT_CHECK(m.load_factor() <= m.max_load_factor());
+
+	ft::unordered_map<int, int> copy(m);
+	ft::unordered_map<int, int> assigned;
+	assigned = m;
+	FT_CHECK(same(copy, ref) && same(assigned, ref) && copy == m);
+	m.clear();
+	FT_CHECK(m.empty() && m.find(1) == m.end());
+
+	//지워진 칸으로 거의 찬 테이블에 계속 넣는다. 재해시가 옛 테이블을 꽉 찬 테이블로 쏟으면 멈춘다.
+	{
+		ft::unordered_map<int, int, Id> t;
+		std::map<int, int> tref;
+		t.reserve(1792);
+		for (int i = 0; i < 1792; i++)
+		{
+			t[i] = i;
+			tref[i] = i;
+		}
+		for (int i = 0; i < 1782; i++)
+		{
+			t.erase(i);
+			tref.erase(i);
+		}
+		for (int i = 0; i < 100; i++)
+		{
+			t[5000 + i] = i;
+			tref[5000 + i] = i;
+		}
+		FT_CHECK(same(t, tref));
+
+		//넣고 지우기를 섞어 크기가 거의 그대로인 채로 여러 번 재해시시킨다.
+		for (int round = 0; round < 200000; round++)
+		{
+			int k = 10000 + round;
+			t[k] = round;
+			tref[k] = round;
+			int victim = tref.begin()->first;
+			FT_CHECK(t.erase(victim) == 1);
+			tref.erase(victim);
+		}
+		FT_CHECK(same(t, tref));
+		FT_CHECK(t.load_factor() <= t.max_load_factor());
+	}
+
+	//rehash, reserve는 옮기는 중이어도 원소를 잃지 않는다.
+	{
+		ft::unordered_map<int, int> r;
+		std::map<int, int> rref;
+		for (int i = 0; i < 5000; i++)
+		{
+			r[i * 7] = i;
+			rref[i * 7] = i;
+		}
+		r.reserve(10);
+		FT_CHECK(same(r, rref));
+		r.rehash(100000);
+		FT_CHECK(same(r, rref) && r.bucket_count() >= 100000);
+	}
+
+	//테이블 메모리도 컨테이너에 넘긴 할당자로 받고 돌려준다.
+	{
+		typedef ft::unordered_map<int, int, ft::hash<int>, std::equal_to<int>, Counted<ft::pair<const int, int> > > counted_map;
+		long bytes = 0;
+		{
+			counted_map c(0, ft::hash<int>(), std::equal_to<int>(), Counted<ft::pair<const int, int> >(&bytes));
+			for (int i = 0; i < 10000; i++)
+				c[i] = i;
+			FT_CHECK(bytes > 0);
+			c.clear();
+			FT_CHECK(bytes == 0);
+			for (int i = 0; i < 100; i++)
+				c[i] = i;
+		}
+		FT_CHECK(bytes == 0);
+	}
+
+	ft::unordered_set<std::string> s;
+	std::set<std::string> sref;
+	for (int i = 0; i < 5000; i++)
+	{
+		std::string k(1 + rand() % 8, static_cast<char>('a' + rand() % 4));
+		FT_CHECK(s.insert(k).second == sref.insert(k).second);
+	}
+	FT_CHECK(s.size() == sref.size());
+	bool all = true;
+	for (std::set<std::string>::iterator it = sref.begin(); it != sref.end(); ++it)
+		all = all && s.count(*it) == 1;
+	FT_CHECK(all);
+	return ft_test::result("unordered_map");
+}
@@ -0,0 +1,321 @@
+#ifndef UNORDERED_SET_CLASS_HPP
+# define UNORDERED_SET_CLASS_HPP
+
+# include "hash_table.hpp"
+
+namespace ft
+{
+//정렬이 필요없는 점 조회용 셋. 트리 대신 열린 주소법 해시 테이블에 값을 그대로 저장한다.
+template < class Key, class Hash = ft::hash<Key>, class Pred = std::equal_to<Key>,
+		class Alloc = std::allocator< Key > >
+class unordered_set
+{
+public:
+	typedef Key											key_type;
+	typedef Key											value_type;
+	typedef Hash										hasher;
+	typedef Pred										key_equal;
+	typedef Alloc										allocator_type;
+	typedef typename allocator_type::reference			reference;
+	typedef typename allocator_type::const_reference	const_reference;
+	typedef typename allocator_type::pointer			pointer;
+	typedef typename allocator_type::const_pointer		const_pointer;
+	typedef ptrdiff_t									difference_type;
+	typedef size_t										size_type;
+
+private:
+	typedef ft::hash_table<value_type, key_type, ft::__identity<value_type>, hasher, key_equal, allocator_type>	table_type;
+
+public:
+	typedef typename table_type::const_iterator			iterator;
+	typedef typename table_type::const_iterator			const_iterator;
+
+	explicit unordered_set(size_type n = 0, const hasher &hf = hasher(),
+			const key_equal &eql = key_equal(), const allocator_type &alloc = allocator_type());
+	template <class Ite>
+	unordered_set(typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+			Ite last, size_type n = 0, const hasher &hf = hasher(),
+			const key_equal &eql = key_equal(), const allocator_type &alloc = allocator_type());
+	unordered_set(const unordered_set &src);
+	virtual ~unordered_set(void);
+
+	unordered_set	&operator=(unordered_set const &rhs);
+
+	iterator		begin(void);
+	const_iterator	begin(void) const;
+	iterator		end(void);
+	const_iterator	end(void) const;
+
+	size_type	size(void) const;
+	size_type	max_size(void) const;
+	bool		empty(void) const;
+
+	ft::pair<iterator, bool>	insert(const value_type &val);
+	iterator					insert(iterator position, const value_type &val);
+	template <class Ite> void	insert(Ite first, Ite last);
+
+	void		erase(iterator position);
+	size_type	erase(const key_type &k);
+	void		erase(iterator first, iterator last);
+
+	void		swap(unordered_set &x);
+	void		clear(void);
+
+	hasher		hash_function(void) const;
+	key_equal	key_eq(void) const;
+
+	iterator		find(const key_type &k);
+	const_iterator	find(const key_type &k) const;
+	size_type		count(const key_type &k) const;
+	pair<iterator,iterator>				equal_range(const key_type &k);
+	pair<const_iterator,const_iterator>	equal_range(const key_type &k) const;
+
+	size_type	bucket_count(void) const;
+	float		load_factor(void) const;
+	float		max_load_factor(void) const;
+	void		rehash(size_type n);
+	void		reserve(size_type n);
+
+private:
+	table_type	_table;
+
+};
+
+template <class Key, class Hash, class Pred, class Alloc>
+unordered_set<Key, Hash, Pred, Alloc>::unordered_set(size_type n, const hasher &hf,
+		const key_equal &eql, const allocator_type &alloc) : _table(hf, eql, alloc)
+{
+	if (n != 0)
+		this->_table.reserve(n);
+}
+
+template <class Key, class Hash, class Pred, class Alloc> template <class Ite>
+unordered_set<Key, Hash, Pred, Alloc>::unordered_set(
+	typename ft::enable_if<!ft::is_integral<Ite>::value, Ite>::type first,
+	Ite last, size_type n, const hasher &hf, const key_equal &eql,
+	const allocator_type &alloc) : _table(hf, eql, alloc)
+{
+	if (n != 0)
+		this->_table.reserve(n);
+	this->insert(first, last);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+unordered_set<Key, Hash, Pred, Alloc>::unordered_set(unordered_set const &src) : \
+		_table(src._table)
+{
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+unordered_set<Key, Hash, Pred, Alloc>::~unordered_set(void) {
+	this->clear();
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+unordered_set<Key, Hash, Pred, Alloc>&
+unordered_set<Key, Hash, Pred, Alloc>::operator=(unordered_set const &rhs) {
+	if (this == &rhs)
+		return (*this);
+	this->_table = rhs._table;
+	return (*this);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+typename unordered_set<Key, Hash, Pred, Alloc>::iterator
+unordered_set<Key, Hash, Pred, Alloc>::begin(void) {
+	return this->_table.begin();
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+typename unordered_set<Key, Hash, Pred, Alloc>::const_iterator
+unordered_set<Key, Hash, Pred, Alloc>::begin(void) const {
+	return this->_table.begin();
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+typename unordered_set<Key, Hash, Pred, Alloc>::iterator
+unordered_set<Key, Hash, Pred, Alloc>::end(void) {
+	return this->_table.end();
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+typename unordered_set<Key, Hash, Pred, Alloc>::const_iterator
+unordered_set<Key, Hash, Pred, Alloc>::end(void) const {
+	return this->_table.end();
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+typename unordered_set<Key, Hash, Pred, Alloc>::size_type
+unordered_set<Key, Hash, Pred, Alloc>::size(void) const {
+	return this->_table.size();
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+typename unordered_set<Key, Hash, Pred, Alloc>::size_type
+unordered_set<Key, Hash, Pred, Alloc>::max_size(void) const {
+	return this->_table.max_size();
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+bool	unordered_set<Key, Hash, Pred, Alloc>::empty(void) const {
+	return (this->_table.size() == 0);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+ft::pair<typename unordered_set<Key, Hash, Pred, Alloc>::iterator, bool>
+unordered_set<Key, Hash, Pred, Alloc>::insert(const value_type &val) {
+	return this->_table.insert(val);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+typename unordered_set<Key, Hash, Pred, Alloc>::iterator
+unordered_set<Key, Hash, Pred, Alloc>::insert(iterator, const value_type &val) {
+	return this->_table.insert(val).first;
+}
+
+template <class Key, class Hash, class Pred, class Alloc> template <class Ite>
+void	unordered_set<Key, Hash, Pred, Alloc>::insert(Ite first, Ite last) {
+	while (first != last)
+		this->_table.insert(*first++);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+void	unordered_set<Key, Hash, Pred, Alloc>::erase(iterator position)
+{
+	this->_table.erase(position);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+typename unordered_set<Key, Hash, Pred, Alloc>::size_type
+unordered_set<Key, Hash, Pred, Alloc>::erase(const key_type &k)
+{
+	return this->_table.erase_key(k);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+void	unordered_set<Key, Hash, Pred, Alloc>::erase(iterator first, iterator last)
+{
+	while (first != last)
+		this->_table.erase(first++);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+void	unordered_set<Key, Hash, Pred, Alloc>::swap(unordered_set &x) {
+	this->_table.swap(x._table);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+void	unordered_set<Key, Hash, Pred, Alloc>::clear(void)
+{
+	this->_table.clear();
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+typename unordered_set<Key, Hash, Pred, Alloc>::hasher
+unordered_set<Key, Hash, Pred, Alloc>::hash_function(void) const {
+	return this->_table.hash_function();
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+typename unordered_set<Key, Hash, Pred, Alloc>::key_equal
+unordered_set<Key, Hash, Pred, Alloc>::key_eq(void) const {
+	return this->_table.key_eq();
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+typename unordered_set<Key, Hash, Pred, Alloc>::iterator
+unordered_set<Key, Hash, Pred, Alloc>::find(const key_type &k)
+{
+	return this->_table.find(k);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+typename unordered_set<Key, Hash, Pred, Alloc>::const_iterator
+unordered_set<Key, Hash, Pred, Alloc>::find(const key_type &k) const
+{
+	return this->_table.find(k);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+typename unordered_set<Key, Hash, Pred, Alloc>::size_type
+unordered_set<Key, Hash, Pred, Alloc>::count(const key_type &k) const
+{
+	return this->_table.find(k) != this->_table.end();
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+ft::pair<typename unordered_set<Key, Hash, Pred, Alloc>::iterator, typename unordered_set<Key, Hash, Pred, Alloc>::iterator>
+unordered_set<Key, Hash, Pred, Alloc>::equal_range(const key_type &k) {
+	iterator it = this->find(k);
+	iterator next = it;
+
+	if (it != this->end())
+		++next;
+	return ft::pair<iterator, iterator>(it, next);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+ft::pair<typename unordered_set<Key, Hash, Pred, Alloc>::const_iterator, typename unordered_set<Key, Hash, Pred, Alloc>::const_iterator>
+unordered_set<Key, Hash, Pred, Alloc>::equal_range(const key_type &k) const {
+	const_iterator it = this->find(k);
+	const_iterator next = it;
+
+	if (it != this->end())
+		++next;
+	return ft::pair<const_iterator, const_iterator>(it, next);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+typename unordered_set<Key, Hash, Pred, Alloc>::size_type
+unordered_set<Key, Hash, Pred, Alloc>::bucket_count(void) const {
+	return this->_table.bucket_count();
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+float	unordered_set<Key, Hash, Pred, Alloc>::load_factor(void) const {
+	return this->_table.load_factor();
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+float	unordered_set<Key, Hash, Pred, Alloc>::max_load_factor(void) const {
+	return this->_table.max_load_factor();
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+void	unordered_set<Key, Hash, Pred, Alloc>::rehash(size_type n) {
+	this->_table.rehash(n);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+void	unordered_set<Key, Hash, Pred, Alloc>::reserve(size_type n) {
+	this->_table.reserve(n);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+bool	operator==(const unordered_set<Key, Hash, Pred, Alloc> &lhs,
+					const unordered_set<Key, Hash, Pred, Alloc> &rhs)
+{
+	if (lhs.size() != rhs.size())
+		return false;
+	for (typename unordered_set<Key, Hash, Pred, Alloc>::const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+	{
+		if (rhs.find(*it) == rhs.end())
+			return false;
+	}
+	return true;
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+bool	operator!=(const unordered_set<Key, Hash, Pred, Alloc> &lhs,
+					const unordered_set<Key, Hash, Pred, Alloc> &rhs) {
+	return !(lhs == rhs);
+}
+
+template <class Key, class Hash, class Pred, class Alloc>
+void	swap(unordered_set<Key, Hash, Pred, Alloc> &x, unordered_set<Key, Hash, Pred, Alloc> &y) {
+	x.swap(y);
+}
+
+}
+
+#endif
@@ -7,6 +7,14 @@
 # include <limits>
 # include <cstddef>
 # include <sstream>
+# include <cstring>
+# if defined(__SSE2__)
+#  include <emmintrin.h>
+# endif
+# if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  include <immintrin.h>
+#  define FT_HAVE_AVX2_TARGET 1
+# endif
 # include "iterator_traits.hpp"
 
 namespace ft {
@@ -21,6 +29,10 @@ struct enable_if<true, T> {
 	typedef T type;
 };
 
+//컴파일 타임 분기용 태그.
+template <bool B>
+struct __bool_tag {};
+
 //int계열 부울 탬플릿 특수화.
 template <typename T>
 struct is_integral
@@ -64,6 +76,173 @@ struct is_integral<long>
 	static bool const value = true;
 };
 
+//두 타입이 같은지 판별하는 탬플릿.
+template <typename T, typename U>
+struct is_same
+{
+	static bool const value = false;
+};
+
+template <typename T>
+struct is_same<T, T>
+{
+	static bool const value = true;
+};
+
+//패딩이나 NaN이 없어서 바이트 단위로 비교해도 되는 타입.
+template <typename T>
+struct is_bitwise_comparable
+{
+	static bool const value = false;
+};
+
+template <>
+struct is_bitwise_comparable<bool>
+{
+	static bool const value = true;
+};
+
+template <>
+struct is_bitwise_comparable<char>
+{
+	static bool const value = true;
+};
+
+template <>
+struct is_bitwise_comparable<signed char>
+{
+	static bool const value = true;
+};
+
+template <>
+struct is_bitwise_comparable<unsigned char>
+{
+	static bool const value = true;
+};
+
+template <>
+struct is_bitwise_comparable<wchar_t>
+{
+	static bool const value = true;
+};
+
+template <>
+struct is_bitwise_comparable<short>
+{
+	static bool const value = true;
+};
+
+template <>
+struct is_bitwise_comparable<unsigned short>
+{
+	static bool const value = true;
+};
+
+template <>
+struct is_bitwise_comparable<int>
+{
+	static bool const value = true;
+};
+
+template <>
+struct is_bitwise_comparable<unsigned int>
+{
+	static bool const value = true;
+};
+
+template <>
+struct is_bitwise_comparable<long>
+{
+	static bool const value = true;
+};
+
+template <>
+struct is_bitwise_comparable<unsigned long>
+{
+	static bool const value = true;
+};
+
+//두 메모리 영역에서 처음으로 다른 바이트의 위치를 반환. 모두 같으면 n.
+inline size_t
+__mismatch_scalar(const unsigned char *a, const unsigned char *b, size_t n)
+{
+	size_t i = 0;
+	while (i < n && a[i] == b[i])
+		++i;
+	return i;
+}
+
+# if defined(__SSE2__)
+//16바이트씩 비교 후 movemask로 다른 바이트를 찾는다.
+inline size_t
+__mismatch_sse2(const unsigned char *a, const unsigned char *b, size_t n)
+{
+	size_t i = 0;
+	for (; i + 16 <= n; i += 16)
+	{
+		__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+		__m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+		unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+		if (mask != 0xFFFFu)
+			return i + __builtin_ctz(~mask & 0xFFFFu);
+	}
+	return i + __mismatch_scalar(a + i, b + i, n - i);
+}
+# endif
+
+# if defined(FT_HAVE_AVX2_TARGET)
+//32바이트 버전. avx2를 지원하는 cpu에서만 호출된다.
+__attribute__((target("avx2"))) inline size_t
+__mismatch_avx2(const unsigned char *a, const unsigned char *b, size_t n)
+{
+	size_t i = 0;
+	for (; i + 32 <= n; i += 32)
+	{
+		__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+		__m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+		unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+		if (mask != 0xFFFFFFFFu)
+			return i + __builtin_ctz(~mask);
+	}
+	return i + __mismatch_scalar(a + i, b + i, n - i);
+}
+
+//cpu가 avx2를 지원하는지 한 번만 검사하고 기억한다.
+//여러 스레드가 처음에 함께 검사해도 같은 값을 쓰므로 원자적으로 읽고 쓰기만 하면 된다.
+inline bool
+__cpu_has_avx2(void)
+{
+	static int has_avx2 = -1;
+	int v = __atomic_load_n(&has_avx2, __ATOMIC_RELAXED);
+
+	if (v < 0)
+	{
+		__builtin_cpu_init();
+		v = __builtin_cpu_supports("avx2") ? 1 : 0;
+		__atomic_store_n(&has_avx2, v, __ATOMIC_RELAXED);
+	}
+	return v == 1;
+}
+# endif
+
+//실행중인 cpu에 맞는 커널을 골라 첫번째로 다른 바이트 위치를 찾는다.
+inline size_t
+__mismatch_bytes(const void *a, const void *b, size_t n)
+{
+	const unsigned char *pa = static_cast<const unsigned char *>(a);
+	const unsigned char *pb = static_cast<const unsigned char *>(b);
+
+# if defined(FT_HAVE_AVX2_TARGET)
+	if (__cpu_has_avx2())
+		return __mismatch_avx2(pa, pb, n);
+# endif
+# if defined(__SSE2__)
+	return __mismatch_sse2(pa, pb, n);
+# else
+	return __mismatch_scalar(pa, pb, n);
+# endif
+}
+
 //두 반복자의의 요소를 비교하는 템플릿 함수. C1부분만 모두 동일하면 true반환
 template <class C1, class C2>
 bool	equal(C1 begin1, C1 end1, C2 begin2)
@@ -117,6 +296,27 @@ struct	pair
 };
 
 
+//값에서 키를 꺼내는 함수 객체. (pair는 first, 나머지는 값 자체)
+template <typename Pair>
+struct __select_first
+{
+	typedef typename Pair::first_type	result_type;
+
+	const result_type &
+	operator()(const Pair &p) const
+	{ return p.first; }
+};
+
+template <typename T>
+struct __identity
+{
+	typedef T	result_type;
+
+	const T &
+	operator()(const T &v) const
+	{ return v; }
+};
+
 template <class T1, class T2>
 pair<T1, T2>
 make_pair(const T1& x, const T2& y)
@@ -1,6 +1,7 @@
 #ifndef VECTOR_CLASS_HPP
 # define VECTOR_CLASS_HPP
 
+# include <typeinfo>
 # include "iterator_vec.hpp"
 # include "reverse_iterator.hpp"
 
@@ -272,7 +273,7 @@ public:
 				it++;
 			}
 			insert_location = new_begin + i;
-			new_begin[i++] = val;
+			_alloc.construct(new_begin + i++, val);
 			while (i < _size + 1)
 			{
 				_alloc.construct(new_begin + i, _begin[i - 1]);
@@ -468,7 +469,7 @@ public:
 	}
 	
 	void
-	swap(vector<value_type>& x)
+	swap(vector& x)
 	{
 		std::swap(this->_alloc, x._alloc);
 		std::swap(this->_capacity, x._capacity);
@@ -493,7 +494,7 @@ public:
 	const_reference
 	operator[](unsigned int offset) const
 	{
-		reference(*(_begin + offset));
+		return const_reference(*(_begin + offset));
 	}
 
 	iterator
@@ -556,6 +557,10 @@ public:
 	data(void)
 	{ return _begin; }
 
+	const_pointer
+	data(void) const
+	{ return _begin; }
+
 	reference
 	at(size_type pos)
 	{
@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <vector>
+#include <pthread.h>
+#include <stdlib.h>
+#include "vector.hpp"
+#include "tester.hpp"
+
+//바이트 커널 셋은 같은 답을 내야 한다. 다른 바이트를 0..n-1 모든 자리에 두고, 시작 주소도 어긋나게 한다.
+static bool
+kernels_agree(void)
+{
+	unsigned char a[160];
+	unsigned char b[160];
+	bool ok = true;
+
+	for (size_t off = 0; off < 4; off++)
+		for (size_t n = 0; n <= 100; n++)
+			for (size_t pos = 0; pos <= n; pos++)
+			{
+				for (size_t i = 0; i < n + off; i++)
+					a[i] = b[i] = static_cast<unsigned char>(i * 31 + 7);
+				if (pos < n)
+					b[off + pos] ^= 0x80;
+				const unsigned char *pa = a + off;
+				const unsigned char *pb = b + off;
+				ok = ok && ft::__mismatch_scalar(pa, pb, n) == pos;
+# if defined(__SSE2__)
+				ok = ok && ft::__mismatch_sse2(pa, pb, n) == pos;
+# endif
+# if defined(FT_HAVE_AVX2_TARGET)
+				if (ft::__cpu_has_avx2())
+					ok = ok && ft::__mismatch_avx2(pa, pb, n) == pos;
+# endif
+				ok = ok && ft::__mismatch_bytes(pa, pb, n) == pos;
+			}
+	return ok;
+}
+
+//ft::vector의 ==, <, <=, >, >=를 std와 맞춘다. 길이 0..100, 모든 자리에 다른 값, 길이만 다른 경우.
+template <class T>
+static bool
+compare_agrees(T lo, T hi)
+{
+	bool ok = true;
+
+	for (size_t n = 0; n <= 100; n++)
+		for (size_t pos = 0; pos <= n; pos++)
+			for (int variant = 0; variant < 3; variant++)
+			{
+				std::vector<T> ra, rb;
+				for (size_t i = 0; i < n; i++)
+				{
+					T v = static_cast<T>(lo + static_cast<T>(i * 37 % 11));
+					ra.push_back(v);
+					rb.push_back(v);
+				}
+				if (pos < n && variant == 0)
+					rb[pos] = hi;
+				else if (pos < n && variant == 1)
+					rb[pos] = lo;
+				else if (variant == 2 && pos < n)
+					rb.resize(pos);
+				ft::vector<T> a(ra.begin(), ra.end());
+				ft::vector<T> b(rb.begin(), rb.end());
+				bool eq = ra.size() == rb.size() && std::equal(ra.begin(), ra.end(), rb.begin());
+				bool lt = std::lexicographical_compare(ra.begin(), ra.end(), rb.begin(), rb.end());
+				bool gt = std::lexicographical_compare(rb.begin(), rb.end(), ra.begin(), ra.end());
+				ok = ok && (a == b) == eq && (a != b) == !eq;
+				ok = ok && (a < b) == lt && (b < a) == gt && (a <= b) == !gt && (a >= b) == !lt;
+				size_t m = rb.size();
+				ok = ok && ft::equal(a.begin(), a.begin() + m, b.begin()) == std::equal(ra.begin(), ra.begin() + m, rb.begin());
+			}
+	return ok;
+}
+
+//여러 스레드가 처음으로 함께 avx2 검사를 지나간다. (make sanitize)
+static void *
+comparer(void *)
+{
+	ft::vector<int> a(64, -1);
+	ft::vector<int> b(64, -1);
+	int bad = 0;
+
+	b[63] = 1;
+	for (int i = 0; i < 1000; i++)
+		if (!(a < b) || a == b)
+			++bad;
+	return bad ? reinterpret_cast<void *>(1) : NULL;
+}
+
+int main(void)
+{
+	pthread_t th[4];
+	for (int t = 0; t < 4; t++)
+		pthread_create(&th[t], NULL, comparer, NULL);
+	bool ok = true;
+	for (int t = 0; t < 4; t++)
+	{
+		void *bad;
+		pthread_join(th[t], &bad);
+		ok = ok && bad == NULL;
+	}
+	FT_CHECK(ok);
+
+	FT_CHECK(kernels_agree());
+	//음수는 바이트 순서로는 크지만 값으로는 작다. 여러 바이트 타입은 첫 다른 바이트가 최하위 바이트일 수 있다.
+	FT_CHECK(compare_agrees<int>(-5, 1 << 20));
+	FT_CHECK(compare_agrees<int>(300, -300));
+	FT_CHECK(compare_agrees<char>(-3, 100));
+	FT_CHECK(compare_agrees<signed char>(-100, 90));
+	FT_CHECK(compare_agrees<unsigned char>(3, 250));
+	FT_CHECK(compare_agrees<unsigned>(1u << 31, 2));
+	FT_CHECK(compare_agrees<long>(-1L << 40, 1));
+	return ft_test::result("vector_compare");
+}